@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <components/bsa/ba2file.hpp>
+#include <components/bsa/ba2gnrlfile.hpp>
+#include <components/esm/fourcc.hpp>
+#include <components/misc/strings/lower.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint32_t filesCount = 64 * 1024;
+    constexpr std::uint32_t filesPerFolder = 256;
+    constexpr std::uint32_t fileSize = 64;
+
+    template <class T>
+    void write(std::ostream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::string makeFileName(std::uint32_t index)
+    {
+        return "meshes\\folder" + std::to_string(index / filesPerFolder) + "\\file" + std::to_string(index) + ".nif";
+    }
+
+    // Writes a general BA2 archive with uncompressed files
+    std::filesystem::path generateArchive()
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "openmw_bsa_openfiles.ba2";
+        std::ofstream stream(path, std::ios::binary);
+
+        constexpr std::uint64_t headerSize = 24;
+        constexpr std::uint64_t recordSize = 36;
+        const std::uint64_t dataOffset = headerSize + recordSize * filesCount;
+        const std::uint64_t fileTableOffset = dataOffset + static_cast<std::uint64_t>(fileSize) * filesCount;
+
+        write(stream, ESM::fourCC("BTDX"));
+        write(stream, static_cast<std::uint32_t>(Bsa::BA2Version::Fallout4));
+        write(stream, ESM::fourCC("GNRL"));
+        write(stream, filesCount);
+        write(stream, fileTableOffset);
+
+        for (std::uint32_t i = 0; i < filesCount; ++i)
+        {
+            const std::string name = Misc::StringUtils::lowerCase(makeFileName(i));
+            const std::size_t folderEnd = name.rfind('\\');
+            const std::size_t extensionStart = name.rfind('.');
+            write(stream, Bsa::generateHash(name.substr(folderEnd + 1, extensionStart - folderEnd - 1)));
+            write(stream, Bsa::generateExtensionHash(std::string_view(name).substr(extensionStart)));
+            write(stream, Bsa::generateHash(name.substr(0, folderEnd)));
+            write(stream, std::uint32_t{ 0 });
+            write(stream, dataOffset + static_cast<std::uint64_t>(fileSize) * i);
+            write(stream, std::uint32_t{ 0 });
+            write(stream, fileSize);
+            write(stream, std::uint32_t{ 0xBAADF00D });
+        }
+
+        const std::vector<char> content(fileSize, 'x');
+        for (std::uint32_t i = 0; i < filesCount; ++i)
+            stream.write(content.data(), content.size());
+
+        for (std::uint32_t i = 0; i < filesCount; ++i)
+        {
+            const std::string name = makeFileName(i);
+            write(stream, static_cast<std::uint16_t>(name.size()));
+            stream.write(name.data(), name.size());
+        }
+
+        return path;
+    }
+
+    const std::filesystem::path& getArchivePath()
+    {
+        static const std::filesystem::path path = generateArchive();
+        return path;
+    }
+
+    void openFileByName(benchmark::State& state)
+    {
+        Bsa::BA2GNRLFile file;
+        file.open(getArchivePath(), state.range(0) != 0);
+        const Bsa::BSAFile::FileList& files = file.getList();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(file.getFile(files[i].name()));
+            if (++i >= files.size())
+                i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void openFileByFileStruct(benchmark::State& state)
+    {
+        Bsa::BA2GNRLFile file;
+        file.open(getArchivePath(), state.range(0) != 0);
+        const Bsa::BSAFile::FileList& files = file.getList();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(file.getFile(&files[i]));
+            if (++i >= files.size())
+                i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(openFileByName)->ArgName("memoryMapped")->Arg(0)->Arg(1);
+BENCHMARK(openFileByFileStruct)->ArgName("memoryMapped")->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,205 @@
+#include <benchmark/benchmark.h>
+
+#include <components/bsa/ba2dx10file.hpp>
+#include <components/bsa/ba2file.hpp>
+#include <components/bsa/decompress.hpp>
+#include <components/esm/fourcc.hpp>
+#include <components/misc/workerpool.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint8_t formatBC1 = 71;
+
+    template <class T>
+    void write(std::ostream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    struct Chunk
+    {
+        std::vector<char> mData;
+        std::vector<char> mPacked;
+    };
+
+    // Generates compressible data similar to block compressed textures
+    std::vector<char> generateData(std::size_t size, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<int> distribution(0, 15);
+        std::vector<char> result(size);
+        std::generate(result.begin(), result.end(), [&] { return static_cast<char>(distribution(random) * 17); });
+        return result;
+    }
+
+    std::vector<char> compress(const std::vector<char>& data)
+    {
+        uLongf size = compressBound(static_cast<uLong>(data.size()));
+        std::vector<char> result(size);
+        if (compress2(reinterpret_cast<Bytef*>(result.data()), &size, reinterpret_cast<const Bytef*>(data.data()),
+                static_cast<uLong>(data.size()), Z_DEFAULT_COMPRESSION)
+            != Z_OK)
+            throw std::runtime_error("Failed to compress chunk");
+        result.resize(size);
+        return result;
+    }
+
+    // Chunks of a square BC1 texture with a full mip chain, one chunk per mip level
+    std::vector<Chunk> generateChunks(std::uint16_t size)
+    {
+        std::minstd_rand random;
+        std::vector<Chunk> result;
+        for (std::uint32_t mipSize = size; mipSize >= 4; mipSize /= 2)
+        {
+            Chunk chunk;
+            chunk.mData = generateData(mipSize * mipSize / 2, random);
+            chunk.mPacked = compress(chunk.mData);
+            result.push_back(std::move(chunk));
+        }
+        return result;
+    }
+
+    const std::vector<Chunk>& getChunks(std::uint16_t size)
+    {
+        static std::map<std::uint16_t, std::vector<Chunk>> chunks;
+        auto it = chunks.find(size);
+        if (it == chunks.end())
+            it = chunks.emplace(size, generateChunks(size)).first;
+        return it->second;
+    }
+
+    // Writes a DX10 BA2 archive with a single texture
+    std::filesystem::path generateArchive(std::uint16_t size)
+    {
+        const std::filesystem::path path
+            = std::filesystem::temp_directory_path() / ("openmw_bsa_textures_" + std::to_string(size) + ".ba2");
+        const std::vector<Chunk>& chunks = getChunks(size);
+        const std::string name = "textures\\texture.dds";
+
+        constexpr std::uint64_t headerSize = 24;
+        constexpr std::uint64_t recordSize = 24;
+        constexpr std::uint64_t chunkRecordSize = 24;
+        const std::uint64_t dataOffset = headerSize + recordSize + chunkRecordSize * chunks.size();
+        std::uint64_t fileTableOffset = dataOffset;
+        for (const Chunk& chunk : chunks)
+            fileTableOffset += chunk.mPacked.size();
+
+        std::ofstream stream(path, std::ios::binary);
+
+        write(stream, ESM::fourCC("BTDX"));
+        write(stream, static_cast<std::uint32_t>(Bsa::BA2Version::Fallout4));
+        write(stream, ESM::fourCC("DX10"));
+        write(stream, std::uint32_t{ 1 });
+        write(stream, fileTableOffset);
+
+        write(stream, Bsa::generateHash("texture"));
+        write(stream, Bsa::generateExtensionHash(".dds"));
+        write(stream, Bsa::generateHash("textures"));
+        write(stream, std::uint8_t{ 0 });
+        write(stream, static_cast<std::uint8_t>(chunks.size()));
+        write(stream, std::uint16_t{ chunkRecordSize });
+        write(stream, size);
+        write(stream, size);
+        write(stream, static_cast<std::uint8_t>(chunks.size()));
+        write(stream, formatBC1);
+        write(stream, std::uint16_t{ 0 });
+
+        std::uint64_t offset = dataOffset;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            write(stream, offset);
+            write(stream, static_cast<std::uint32_t>(chunks[i].mPacked.size()));
+            write(stream, static_cast<std::uint32_t>(chunks[i].mData.size()));
+            write(stream, static_cast<std::uint16_t>(i));
+            write(stream, static_cast<std::uint16_t>(i));
+            write(stream, std::uint32_t{ 0xBAADF00D });
+            offset += chunks[i].mPacked.size();
+        }
+
+        for (const Chunk& chunk : chunks)
+            stream.write(chunk.mPacked.data(), chunk.mPacked.size());
+
+        write(stream, static_cast<std::uint16_t>(name.size()));
+        stream.write(name.data(), name.size());
+
+        return path;
+    }
+
+    void readTexture(benchmark::State& state)
+    {
+        const std::uint16_t size = static_cast<std::uint16_t>(state.range(0));
+        Bsa::BA2DX10File file;
+        file.open(generateArchive(size), true);
+        const Bsa::BSAFile::FileStruct& texture = file.getList().front();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(file.getFile(&texture));
+        state.SetBytesProcessed(state.iterations() * size * size * 2 / 3);
+    }
+
+    template <class Decompress>
+    void decompressChunks(benchmark::State& state, Decompress&& decompress)
+    {
+        const std::vector<Chunk>& chunks = getChunks(static_cast<std::uint16_t>(state.range(0)));
+        std::vector<std::size_t> offsets;
+        std::size_t size = 0;
+        for (const Chunk& chunk : chunks)
+        {
+            offsets.push_back(size);
+            size += chunk.mData.size();
+        }
+        std::vector<char> output(size);
+        const auto decompressChunk = [&](std::size_t i) {
+            const std::vector<char>& packed = chunks[i].mPacked;
+            Bsa::decompressZlib(std::string_view(packed.data(), packed.size()), output.data() + offsets[i],
+                chunks[i].mData.size());
+        };
+        for (auto _ : state)
+        {
+            decompress(chunks.size(), decompressChunk);
+            benchmark::DoNotOptimize(output);
+        }
+        state.SetBytesProcessed(state.iterations() * size);
+    }
+
+    void decompressChunksSequentially(benchmark::State& state)
+    {
+        decompressChunks(state, [](std::size_t count, const auto& decompressChunk) {
+            for (std::size_t i = 0; i < count; ++i)
+                decompressChunk(i);
+        });
+    }
+
+    void decompressChunksInParallel(benchmark::State& state)
+    {
+        decompressChunks(state, [](std::size_t count, const auto& decompressChunk) {
+            Misc::WorkerPool::get().parallelFor(count, decompressChunk);
+        });
+    }
+}
+
+BENCHMARK(readTexture)->ArgName("size")->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(decompressChunksSequentially)
+    ->ArgName("size")
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(decompressChunksInParallel)
+    ->ArgName("size")
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 #include "components/esm/refid.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <random>
 #include <string>
@@ -233,6 +234,56 @@ namespace
                 i = 0;
         }
     }
+
+    const std::vector<std::string>& getSharedStringRefIdValues()
+    {
+        static const std::vector<std::string> values = [] {
+            std::minstd_rand random;
+            return generateSerializedStringRefIds(32, random, [](ESM::RefId v) { return v.getRefIdString(); });
+        }();
+        return values;
+    }
+
+    // All threads intern the same values which are already present like scripts and Lua bindings do
+    void createExistingStringRefIdConcurrently(benchmark::State& state)
+    {
+        const std::vector<std::string>& values = getSharedStringRefIdValues();
+        std::size_t i = static_cast<std::size_t>(state.thread_index()) * 997 % values.size();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ESM::StringRefId(values[i]));
+            if (++i >= values.size())
+                i = 0;
+        }
+    }
+
+    void deserializeExistingStringRefIdConcurrently(benchmark::State& state)
+    {
+        const std::vector<std::string>& values = getSharedStringRefIdValues();
+        std::size_t i = static_cast<std::size_t>(state.thread_index()) * 997 % values.size();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ESM::StringRefId::deserializeExisting(values[i]));
+            if (++i >= values.size())
+                i = 0;
+        }
+    }
+
+    // Each thread interns values never seen before like loading content files on multiple threads does
+    void createNewStringRefIdConcurrently(benchmark::State& state)
+    {
+        static std::atomic<std::size_t> run{ 0 };
+        std::string value = "new string ref id " + std::to_string(run.fetch_add(1)) + " "
+            + std::to_string(state.thread_index()) + " ";
+        const std::size_t prefixSize = value.size();
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            value.resize(prefixSize);
+            value += std::to_string(i++);
+            benchmark::DoNotOptimize(ESM::StringRefId(value));
+        }
+    }
 }
 
 BENCHMARK(serializeRefId)->RangeMultiplier(4)->Range(8, 64);
@@ -245,5 +296,8 @@ BENCHMARK(serializeTextIndexRefId);
 BENCHMARK(deserializeTextIndexRefId);
 BENCHMARK(serializeTextESM3ExteriorCellRefId);
 BENCHMARK(deserializeTextESM3ExteriorCellRefId);
+BENCHMARK(createExistingStringRefIdConcurrently)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(deserializeExistingStringRefIdConcurrently)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(createNewStringRefIdConcurrently)->ThreadRange(1, 8)->UseRealTime();
 
 BENCHMARK_MAIN();
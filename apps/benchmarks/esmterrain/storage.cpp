@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm/exteriorcelllocation.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/loadland.hpp>
+#include <components/esmterrain/storage.hpp>
+
+#include <osg/Array>
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace
+{
+    // Land covers [-worldSize / 2, worldSize / 2) cells by each axis
+    constexpr int worldSize = 16;
+
+    osg::ref_ptr<const ESMTerrain::LandObject> makeLand(int cellX, int cellY, std::minstd_rand& random)
+    {
+        constexpr int dataTypes
+            = ESM::Land::DATA_VNML | ESM::Land::DATA_VHGT | ESM::Land::DATA_VCLR | ESM::Land::DATA_VTEX;
+        ESM::Land land;
+        land.mX = cellX;
+        land.mY = cellY;
+        land.mDataTypes = dataTypes;
+        land.mLandData = std::make_unique<ESM::Land::LandData>();
+        ESM::Land::LandData& data = *land.mLandData;
+        std::uniform_int_distribution<int> normalDistribution(-64, 64);
+        std::uniform_int_distribution<int> colourDistribution(0, 255);
+        for (int y = 0; y < ESM::Land::LAND_SIZE; ++y)
+        {
+            for (int x = 0; x < ESM::Land::LAND_SIZE; ++x)
+            {
+                const std::size_t index = static_cast<std::size_t>(y * ESM::Land::LAND_SIZE + x);
+                const float globalX = cellX + x / static_cast<float>(ESM::Land::LAND_SIZE - 1);
+                const float globalY = cellY + y / static_cast<float>(ESM::Land::LAND_SIZE - 1);
+                data.mHeights[index] = 1000 * std::sin(globalX) * std::cos(globalY);
+                data.mNormals[index * 3] = static_cast<std::int8_t>(normalDistribution(random));
+                data.mNormals[index * 3 + 1] = static_cast<std::int8_t>(normalDistribution(random));
+                data.mNormals[index * 3 + 2] = 127;
+                for (std::size_t i = 0; i < 3; ++i)
+                    data.mColours[index * 3 + i] = static_cast<std::uint8_t>(colourDistribution(random));
+            }
+        }
+        data.mTextures.fill(0);
+        data.mDataLoaded = dataTypes;
+        return new ESMTerrain::LandObject(land, dataTypes);
+    }
+
+    class SyntheticStorage final : public ESMTerrain::Storage
+    {
+    public:
+        SyntheticStorage()
+            : ESMTerrain::Storage(nullptr)
+        {
+            std::minstd_rand random;
+            for (int x = -worldSize / 2; x < worldSize / 2; ++x)
+                for (int y = -worldSize / 2; y < worldSize / 2; ++y)
+                    mLands.emplace(std::pair(x, y), makeLand(x, y, random));
+        }
+
+        osg::ref_ptr<const ESMTerrain::LandObject> getLand(ESM::ExteriorCellLocation cellLocation) override
+        {
+            const auto it = mLands.find(std::pair(cellLocation.mX, cellLocation.mY));
+            if (it == mLands.end())
+                return nullptr;
+            return it->second;
+        }
+
+        const std::string* getLandTexture(std::uint16_t /*index*/, int /*plugin*/) override { return nullptr; }
+
+        void getBounds(float& minX, float& maxX, float& minY, float& maxY, ESM::RefId /*worldspace*/) override
+        {
+            minX = -worldSize / 2;
+            minY = -worldSize / 2;
+            maxX = worldSize / 2;
+            maxY = worldSize / 2;
+        }
+
+    private:
+        std::map<std::pair<int, int>, osg::ref_ptr<const ESMTerrain::LandObject>> mLands;
+    };
+
+    // Builds vertex buffers for all chunks covering the land. Chunk size is doubled with each LOD level like the
+    // terrain quad tree does to keep the number of vertices per chunk the same.
+    void fillVertexBuffers(benchmark::State& state)
+    {
+        const int lodLevel = static_cast<int>(state.range(0));
+        const float chunkSize = std::ldexp(0.125f, lodLevel);
+        SyntheticStorage storage;
+        osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+        std::size_t vertices = 0;
+
+        for (auto _ : state)
+        {
+            for (float x = -worldSize / 2 + chunkSize / 2; x < worldSize / 2; x += chunkSize)
+            {
+                for (float y = -worldSize / 2 + chunkSize / 2; y < worldSize / 2; y += chunkSize)
+                {
+                    storage.fillVertexBuffers(lodLevel, chunkSize, osg::Vec2f(x, y), ESM::Cell::sDefaultWorldspaceId,
+                        *positions, *normals, *colours);
+                    vertices += positions->size();
+                }
+            }
+            benchmark::DoNotOptimize(positions->getDataPointer());
+            benchmark::DoNotOptimize(normals->getDataPointer());
+            benchmark::DoNotOptimize(colours->getDataPointer());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(vertices));
+    }
+}
+
+BENCHMARK(fillVertexBuffers)->DenseRange(0, 6)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,250 @@
+#include <benchmark/benchmark.h>
+
+#include <components/compiler/context.hpp>
+#include <components/compiler/extensions.hpp>
+#include <components/compiler/extensions0.hpp>
+#include <components/compiler/fileparser.hpp>
+#include <components/compiler/opcodes.hpp>
+#include <components/compiler/scanner.hpp>
+#include <components/compiler/streamerrorhandler.hpp>
+#include <components/esm/refid.hpp>
+#include <components/interpreter/context.hpp>
+#include <components/interpreter/installopcodes.hpp>
+#include <components/interpreter/interpreter.hpp>
+#include <components/interpreter/opcodes.hpp>
+#include <components/interpreter/program.hpp>
+#include <components/interpreter/runtime.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class CompilerContext : public Compiler::Context
+    {
+    public:
+        bool canDeclareLocals() const override { return true; }
+
+        char getGlobalType(const std::string& name) const override { return ' '; }
+
+        std::pair<char, bool> getMemberType(const std::string& name, const ESM::RefId& id) const override
+        {
+            return { ' ', false };
+        }
+
+        bool isId(const ESM::RefId& name) const override { return name == "player"; }
+    };
+
+    class InterpreterContext : public Interpreter::Context
+    {
+    public:
+        ESM::RefId getTarget() const override { return ESM::RefId(); }
+
+        int getLocalShort(int index) const override { return mShorts[index]; }
+
+        int getLocalLong(int index) const override { return mLongs[index]; }
+
+        float getLocalFloat(int index) const override { return mFloats[index]; }
+
+        void setLocalShort(int index, int value) override { mShorts[index] = value; }
+
+        void setLocalLong(int index, int value) override { mLongs[index] = value; }
+
+        void setLocalFloat(int index, float value) override { mFloats[index] = value; }
+
+        void messageBox(std::string_view message, const std::vector<std::string>& buttons) override {}
+
+        void report(const std::string& message) override {}
+
+        int getGlobalShort(std::string_view name) const override { return {}; }
+
+        int getGlobalLong(std::string_view name) const override { return {}; }
+
+        float getGlobalFloat(std::string_view name) const override { return {}; }
+
+        void setGlobalShort(std::string_view name, int value) override {}
+
+        void setGlobalLong(std::string_view name, int value) override {}
+
+        void setGlobalFloat(std::string_view name, float value) override {}
+
+        std::vector<std::string> getGlobals() const override { return {}; }
+
+        char getGlobalType(std::string_view name) const override { return ' '; }
+
+        std::string getActionBinding(std::string_view action) const override { return {}; }
+
+        std::string_view getActorName() const override { return {}; }
+
+        std::string_view getNPCRace() const override { return {}; }
+
+        std::string_view getNPCClass() const override { return {}; }
+
+        std::string_view getNPCFaction() const override { return {}; }
+
+        std::string_view getNPCRank() const override { return {}; }
+
+        std::string_view getPCName() const override { return {}; }
+
+        std::string_view getPCRace() const override { return {}; }
+
+        std::string_view getPCClass() const override { return {}; }
+
+        std::string_view getPCRank() const override { return {}; }
+
+        std::string_view getPCNextRank() const override { return {}; }
+
+        int getPCBounty() const override { return {}; }
+
+        std::string_view getCurrentCellName() const override { return {}; }
+
+        int getMemberShort(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+
+        int getMemberLong(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+
+        float getMemberFloat(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+
+        void setMemberShort(ESM::RefId id, std::string_view name, int value, bool global) override {}
+
+        void setMemberLong(ESM::RefId id, std::string_view name, int value, bool global) override {}
+
+        void setMemberFloat(ESM::RefId id, std::string_view name, float value, bool global) override {}
+
+    private:
+        std::vector<int> mShorts = std::vector<int>(8);
+        std::vector<int> mLongs = std::vector<int>(8);
+        std::vector<float> mFloats = std::vector<float>(8);
+    };
+
+    class GetSecondsPassed : public Interpreter::Opcode0
+    {
+    public:
+        void execute(Interpreter::Runtime& runtime) override { runtime.push(1.0f / 60.0f); }
+    };
+
+    class AddItem : public Interpreter::Opcode0
+    {
+    public:
+        void execute(Interpreter::Runtime& runtime) override
+        {
+            benchmark::DoNotOptimize(runtime.getRefIdLiteral(runtime[0].mInteger));
+            runtime.pop();
+            benchmark::DoNotOptimize(runtime.getRefIdLiteral(runtime[0].mInteger));
+            runtime.pop();
+            runtime.pop();
+        }
+    };
+
+    Interpreter::Program compile(const std::string& source)
+    {
+        Compiler::Extensions extensions;
+        Compiler::registerExtensions(extensions);
+        CompilerContext context;
+        context.setExtensions(&extensions);
+        Compiler::StreamErrorHandler errorHandler;
+        Compiler::FileParser parser(errorHandler, context);
+        std::istringstream input(source);
+        Compiler::Scanner scanner(errorHandler, input, context.getExtensions());
+        scanner.scan(parser);
+        if (!errorHandler.isGood())
+            throw std::runtime_error("Failed to compile benchmark script");
+        return parser.getProgram();
+    }
+
+    // Script without branches so every instruction of the program is executed exactly once per run
+    std::string makeStraightScript(std::size_t lines)
+    {
+        std::string result = "Begin straight\nshort s\nlong l\nfloat f\n";
+        for (std::size_t i = 0; i < lines; ++i)
+        {
+            result += "set s to s + 1\n";
+            result += "set l to l * 3 - s\n";
+            result += "set f to f + GetSecondsPassed * 0.5\n";
+        }
+        result += "End\n";
+        return result;
+    }
+
+    std::string makeRefIdScript(std::size_t lines)
+    {
+        std::string result = "Begin refids\n";
+        for (std::size_t i = 0; i < lines; ++i)
+            result += "player->AddItem \"item_" + std::to_string(i % 16) + "\", 1\n";
+        result += "End\n";
+        return result;
+    }
+
+    constexpr int loopIterations = 1000;
+
+    const std::string loopScript = R"mwscript(Begin loop
+short i
+float f
+set i to 0
+while ( i < 1000 )
+    set i to i + 1
+    if ( i > 500 )
+        set f to f - GetSecondsPassed
+    else
+        set f to f + GetSecondsPassed
+    endif
+endwhile
+End
+)mwscript";
+
+    void installBenchmarkOpcodes(Interpreter::Interpreter& interpreter)
+    {
+        Interpreter::installOpcodes(interpreter);
+        interpreter.installSegment5<GetSecondsPassed>(Compiler::Misc::opcodeGetSecondsPassed);
+        interpreter.installSegment5<AddItem>(Compiler::Container::opcodeAddItemExplicit);
+    }
+
+    void runStraightScript(benchmark::State& state)
+    {
+        const Interpreter::Program program = compile(makeStraightScript(state.range(0)));
+        Interpreter::Interpreter interpreter;
+        installBenchmarkOpcodes(interpreter);
+        InterpreterContext context;
+
+        for (auto _ : state)
+            interpreter.run(program, context);
+
+        state.counters["instructions"] = benchmark::Counter(
+            static_cast<double>(state.iterations() * program.mInstructions.size()), benchmark::Counter::kIsRate);
+    }
+
+    void runRefIdScript(benchmark::State& state)
+    {
+        const Interpreter::Program program = compile(makeRefIdScript(state.range(0)));
+        Interpreter::Interpreter interpreter;
+        installBenchmarkOpcodes(interpreter);
+        InterpreterContext context;
+
+        for (auto _ : state)
+            interpreter.run(program, context);
+
+        state.counters["instructions"] = benchmark::Counter(
+            static_cast<double>(state.iterations() * program.mInstructions.size()), benchmark::Counter::kIsRate);
+    }
+
+    void runLoopScript(benchmark::State& state)
+    {
+        const Interpreter::Program program = compile(loopScript);
+        Interpreter::Interpreter interpreter;
+        installBenchmarkOpcodes(interpreter);
+        InterpreterContext context;
+
+        for (auto _ : state)
+            interpreter.run(program, context);
+
+        state.SetItemsProcessed(state.iterations() * loopIterations);
+    }
+
+    BENCHMARK(runStraightScript)->Arg(10)->Arg(100)->Arg(1000);
+    BENCHMARK(runRefIdScript)->Arg(10)->Arg(100);
+    BENCHMARK(runLoopScript);
+}
+
+BENCHMARK_MAIN();
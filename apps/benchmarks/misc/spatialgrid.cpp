@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <components/misc/spatialgrid.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Actors are crowded within a single exterior cell
+    constexpr float worldSize = 8192;
+    // Distance used by actors collision avoidance
+    constexpr float collisionCheckDistance = 200;
+    // Default fMaxHeadTrackDistance
+    constexpr float headTrackDistance = 400;
+    constexpr float cellSize = 512;
+
+    struct Actor
+    {
+        osg::Vec3f mPosition;
+    };
+
+    std::vector<Actor> makeActors(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(0, worldSize);
+        std::vector<Actor> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result.push_back(Actor{ osg::Vec3f(distribution(random), distribution(random), 0) });
+        return result;
+    }
+
+    // Same pattern as Actors::update: each actor looks for neighbours to avoid collisions and track heads
+    std::size_t countNeighboursByLinearSearch(const std::vector<Actor>& actors)
+    {
+        std::size_t result = 0;
+        for (const Actor& actor : actors)
+            for (float distance : { collisionCheckDistance, headTrackDistance })
+                for (const Actor& other : actors)
+                    if ((other.mPosition - actor.mPosition).length2() <= distance * distance)
+                        ++result;
+        return result;
+    }
+
+    std::size_t countNeighboursBySpatialGrid(const std::vector<Actor>& actors, Misc::SpatialGrid<const Actor*>& grid)
+    {
+        grid.rebuild(
+            actors, [](const Actor& actor) { return &actor; }, [](const Actor* actor) { return actor->mPosition; });
+        std::size_t result = 0;
+        for (const Actor& actor : actors)
+            for (float distance : { collisionCheckDistance, headTrackDistance })
+                grid.forEachNear(actor.mPosition, distance + cellSize, [&](const Actor* other) {
+                    if ((other->mPosition - actor.mPosition).length2() <= distance * distance)
+                        ++result;
+                });
+        return result;
+    }
+
+    void linearSearch(benchmark::State& state)
+    {
+        const std::vector<Actor> actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(countNeighboursByLinearSearch(actors));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void spatialGrid(benchmark::State& state)
+    {
+        const std::vector<Actor> actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        Misc::SpatialGrid<const Actor*> grid(cellSize);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(countNeighboursBySpatialGrid(actors, grid));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(linearSearch)->Arg(50)->Arg(100)->Arg(500)->Arg(1000);
+BENCHMARK(spatialGrid)->Arg(50)->Arg(100)->Arg(500)->Arg(1000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+
+#include "apps/openmw/mwdialogue/infoindex.hpp"
+
+#include <components/esm3/loaddial.hpp>
+#include <components/misc/strings/algorithm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t infosCount = 50000;
+    constexpr std::size_t actorsCount = 5000;
+    constexpr std::size_t racesCount = 10;
+    constexpr std::size_t classesCount = 50;
+    constexpr std::size_t factionsCount = 30;
+    constexpr std::size_t cellsCount = 500;
+
+    std::vector<ESM::RefId> makeIds(std::string_view prefix, std::size_t count)
+    {
+        std::vector<ESM::RefId> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result.push_back(ESM::RefId::stringRefId(std::string(prefix) + std::to_string(i)));
+        return result;
+    }
+
+    struct Content
+    {
+        std::vector<ESM::RefId> mActors = makeIds("actor", actorsCount);
+        std::vector<ESM::RefId> mRaces = makeIds("race", racesCount);
+        std::vector<ESM::RefId> mClasses = makeIds("class", classesCount);
+        std::vector<ESM::RefId> mFactions = makeIds("faction", factionsCount);
+        std::vector<ESM::RefId> mCells = makeIds("cell", cellsCount);
+    };
+
+    // Large content mods add most of the responses for specific actors, the rest are for races, classes, factions
+    // and cells or are generic ones filtered by select structs only
+    ESM::Dialogue makeDialogue(const Content& content, std::minstd_rand& random)
+    {
+        ESM::Dialogue result;
+        result.blank();
+        std::uniform_int_distribution<int> kind(0, 9);
+        const auto pick = [&](const std::vector<ESM::RefId>& ids) {
+            return ids[std::uniform_int_distribution<std::size_t>(0, ids.size() - 1)(random)];
+        };
+        for (std::size_t i = 0; i < infosCount; ++i)
+        {
+            ESM::DialInfo info;
+            info.blank();
+            switch (kind(random))
+            {
+                case 0:
+                    info.mRace = pick(content.mRaces);
+                    break;
+                case 1:
+                    info.mClass = pick(content.mClasses);
+                    break;
+                case 2:
+                    info.mFaction = pick(content.mFactions);
+                    break;
+                case 3:
+                    info.mCell = pick(content.mCells);
+                    break;
+                case 4:
+                    break;
+                default:
+                    info.mActor = pick(content.mActors);
+                    break;
+            }
+            result.mInfo.push_back(std::move(info));
+        }
+        return result;
+    }
+
+    MWDialogue::InfoIndex::Speaker makeSpeaker(const Content& content, std::size_t index)
+    {
+        return MWDialogue::InfoIndex::Speaker{
+            .mId = content.mActors[index % actorsCount],
+            .mIsNpc = true,
+            .mRace = content.mRaces[index % racesCount],
+            .mClass = content.mClasses[index % classesCount],
+            .mFaction = content.mFactions[index % factionsCount],
+            .mCell = content.mCells[index % cellsCount].getRefIdString(),
+        };
+    }
+
+    // Speaker requirements checked by Filter::testActor and Filter::testPlayer before select structs
+    bool matchesSpeaker(const ESM::DialInfo& info, const MWDialogue::InfoIndex::Speaker& speaker)
+    {
+        return (info.mActor.empty() || info.mActor == speaker.mId)
+            && (info.mRace.empty() || info.mRace == speaker.mRace)
+            && (info.mClass.empty() || info.mClass == speaker.mClass)
+            && (info.mFaction.empty() || info.mFaction == speaker.mFaction)
+            && (info.mCell.empty() || Misc::StringUtils::ciStartsWith(speaker.mCell, info.mCell.getRefIdString()));
+    }
+
+    void listByLinearSearch(benchmark::State& state)
+    {
+        const Content content;
+        std::minstd_rand random;
+        const ESM::Dialogue dialogue = makeDialogue(content, random);
+        std::size_t index = 0;
+        for (auto _ : state)
+        {
+            const MWDialogue::InfoIndex::Speaker speaker = makeSpeaker(content, index++);
+            std::size_t count = 0;
+            for (const ESM::DialInfo& info : dialogue.mInfo)
+                if (matchesSpeaker(info, speaker))
+                    ++count;
+            benchmark::DoNotOptimize(count);
+        }
+    }
+
+    void listByInfoIndex(benchmark::State& state)
+    {
+        const Content content;
+        std::minstd_rand random;
+        const ESM::Dialogue dialogue = makeDialogue(content, random);
+        const MWDialogue::InfoIndex infoIndex(dialogue);
+        std::size_t index = 0;
+        for (auto _ : state)
+        {
+            const MWDialogue::InfoIndex::Speaker speaker = makeSpeaker(content, index++);
+            std::size_t count = 0;
+            infoIndex.forEachCandidate(speaker, [&](const ESM::DialInfo& info) {
+                if (matchesSpeaker(info, speaker))
+                    ++count;
+                return true;
+            });
+            benchmark::DoNotOptimize(count);
+        }
+    }
+
+    void buildInfoIndex(benchmark::State& state)
+    {
+        const Content content;
+        std::minstd_rand random;
+        const ESM::Dialogue dialogue = makeDialogue(content, random);
+        for (auto _ : state)
+        {
+            MWDialogue::InfoIndex infoIndex(dialogue);
+            benchmark::DoNotOptimize(infoIndex);
+        }
+    }
+}
+
+BENCHMARK(listByLinearSearch);
+BENCHMARK(listByInfoIndex);
+BENCHMARK(buildInfoIndex);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include "apps/openmw/mwmechanics/pathgrid.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Distance between neighbour points similar to autogenerated pathgrids
+    constexpr int pointsDistance = 256;
+
+    // Square lattice with jittered points connected to their neighbours in both directions. Vanilla exterior cells
+    // have tens to a couple of hundreds points, the largest interiors have several hundreds.
+    ESM::Pathgrid makePathgrid(int side)
+    {
+        std::minstd_rand random;
+        std::uniform_int_distribution<int> jitter(-pointsDistance / 4, pointsDistance / 4);
+        ESM::Pathgrid result;
+        result.blank();
+        for (int y = 0; y < side; ++y)
+            for (int x = 0; x < side; ++x)
+                result.mPoints.emplace_back(
+                    x * pointsDistance + jitter(random), y * pointsDistance + jitter(random), jitter(random));
+        for (int y = 0; y < side; ++y)
+        {
+            for (int x = 0; x < side; ++x)
+            {
+                const std::size_t index = static_cast<std::size_t>(y * side + x);
+                const auto connect = [&](std::size_t other) {
+                    result.mEdges.push_back(ESM::Pathgrid::Edge{ index, other });
+                    result.mEdges.push_back(ESM::Pathgrid::Edge{ other, index });
+                };
+                if (x + 1 < side)
+                    connect(index + 1);
+                if (y + 1 < side)
+                    connect(index + side);
+            }
+        }
+        result.mData.mPoints = static_cast<std::uint16_t>(result.mPoints.size());
+        return result;
+    }
+
+    // AI packages repeatedly go to a limited set of points: wander nodes, travel and escort destinations
+    std::vector<std::pair<std::size_t, std::size_t>> makeQueries(std::size_t pointsCount, std::size_t endsCount)
+    {
+        std::minstd_rand random;
+        std::uniform_int_distribution<std::size_t> point(0, pointsCount - 1);
+        std::vector<std::size_t> ends;
+        for (std::size_t i = 0; i < endsCount; ++i)
+            ends.push_back(point(random));
+        std::uniform_int_distribution<std::size_t> end(0, ends.size() - 1);
+        std::vector<std::pair<std::size_t, std::size_t>> result;
+        for (std::size_t i = 0; i < 1024; ++i)
+            result.emplace_back(point(random), ends[end(random)]);
+        return result;
+    }
+
+    void aStarSearch(benchmark::State& state)
+    {
+        const ESM::Pathgrid pathgrid = makePathgrid(static_cast<int>(state.range(0)));
+        const MWMechanics::PathgridGraph graph(pathgrid);
+        const auto queries = makeQueries(pathgrid.mPoints.size(), static_cast<std::size_t>(state.range(1)));
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            const auto& [start, end] = queries[i++ % queries.size()];
+            benchmark::DoNotOptimize(graph.aStarSearch(start, end));
+        }
+    }
+
+    void findPath(benchmark::State& state)
+    {
+        const ESM::Pathgrid pathgrid = makePathgrid(static_cast<int>(state.range(0)));
+        const MWMechanics::PathgridGraph graph(pathgrid);
+        const auto queries = makeQueries(pathgrid.mPoints.size(), static_cast<std::size_t>(state.range(1)));
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            const auto& [start, end] = queries[i++ % queries.size()];
+            benchmark::DoNotOptimize(graph.findPath(start, end));
+        }
+    }
+
+    // Each search is the first one for its end point
+    void findPathFirstSearch(benchmark::State& state)
+    {
+        const ESM::Pathgrid pathgrid = makePathgrid(static_cast<int>(state.range(0)));
+        const auto queries = makeQueries(pathgrid.mPoints.size(), pathgrid.mPoints.size());
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            const MWMechanics::PathgridGraph graph(pathgrid);
+            state.ResumeTiming();
+            const auto& [start, end] = queries[i++ % queries.size()];
+            benchmark::DoNotOptimize(graph.findPath(start, end));
+        }
+    }
+}
+
+// Side of the lattice: 64, 256 and 576 points; number of distinct end points
+BENCHMARK(aStarSearch)->Args({ 8, 4 })->Args({ 16, 16 })->Args({ 24, 16 });
+BENCHMARK(findPath)->Args({ 8, 4 })->Args({ 16, 16 })->Args({ 24, 16 });
+BENCHMARK(findPathFirstSearch)->Arg(8)->Arg(16)->Arg(24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include "apps/openmw/mwsound/null_output.hpp"
+#include "apps/openmw/mwsound/sound_decoder.hpp"
+#include "apps/openmw/mwsound/soundloader.hpp"
+
+#include <components/sceneutil/workqueue.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int sampleRate = 44100;
+    // Typical sound effect duration
+    constexpr std::size_t samplesCount = sampleRate / 2;
+    constexpr std::size_t soundsCount = 32;
+
+    // Generates a tone instead of reading a file to have a comparable decoding cost without the data files
+    struct ToneDecoder final : MWSound::Sound_Decoder
+    {
+        std::size_t mPosition = 0;
+
+        explicit ToneDecoder(const VFS::Manager* vfs)
+            : Sound_Decoder(vfs)
+        {
+        }
+
+        void open(VFS::Path::NormalizedView fname) override { mPosition = 0; }
+
+        void close() override {}
+
+        std::string getName() override { return "tone"; }
+
+        void getInfo(int* samplerate, MWSound::ChannelConfig* chans, MWSound::SampleType* type) override
+        {
+            *samplerate = sampleRate;
+            *chans = MWSound::ChannelConfig_Mono;
+            *type = MWSound::SampleType_Int16;
+        }
+
+        size_t read(char* buffer, size_t bytes) override
+        {
+            std::size_t written = 0;
+            for (; written + sizeof(std::int16_t) <= bytes && mPosition < samplesCount; written += sizeof(std::int16_t))
+            {
+                const float value = std::sin(static_cast<float>(mPosition++) * 440.0f * 6.2831853f / sampleRate);
+                const std::int16_t sample = static_cast<std::int16_t>(value * 32767);
+                std::memcpy(buffer + written, &sample, sizeof(sample));
+            }
+            return written;
+        }
+
+        size_t getSampleOffset() override { return mPosition; }
+    };
+
+    std::vector<VFS::Path::Normalized> makePaths()
+    {
+        std::vector<VFS::Path::Normalized> result;
+        for (std::size_t i = 0; i < soundsCount; ++i)
+            result.emplace_back("fx/sound" + std::to_string(i) + ".wav");
+        return result;
+    }
+
+    struct Pipeline
+    {
+        VFS::Manager mVFS;
+        MWSound::Null_Output mOutput;
+        MWSound::SoundLoader mLoader{ mOutput, [this] { return std::make_shared<ToneDecoder>(&mVFS); } };
+        std::vector<VFS::Path::Normalized> mPaths = makePaths();
+        std::vector<MWSound::SoundLoader::Loaded> mLoaded;
+
+        Pipeline() { mOutput.init({}, {}, MWSound::HrtfMode::Disable); }
+
+        void unloadAll()
+        {
+            for (const MWSound::SoundLoader::Loaded& loaded : mLoaded)
+                mOutput.unloadSound(loaded.mHandle);
+            mLoaded.clear();
+        }
+    };
+
+    // Main thread decodes each sound when it's played for the first time
+    void loadOnMainThread(benchmark::State& state)
+    {
+        Pipeline pipeline;
+        for (auto _ : state)
+        {
+            for (const VFS::Path::Normalized& path : pipeline.mPaths)
+            {
+                const auto [handle, size] = pipeline.mLoader.load(path);
+                pipeline.mOutput.unloadSound(handle);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(soundsCount));
+    }
+
+    // Main thread only requests decoding and creates buffers for decoded sounds, the time it waits is not measured
+    void requestOnMainThread(benchmark::State& state)
+    {
+        Pipeline pipeline;
+        const osg::ref_ptr<SceneUtil::WorkQueue> workQueue
+            = new SceneUtil::WorkQueue(static_cast<std::size_t>(state.range(0)));
+        pipeline.mLoader.setWorkQueue(workQueue);
+        for (auto _ : state)
+        {
+            for (const VFS::Path::Normalized& path : pipeline.mPaths)
+                pipeline.mLoader.request(path, SceneUtil::WorkPriority::Normal);
+            while (pipeline.mLoader.getPendingCount() > 0)
+            {
+                state.PauseTiming();
+                std::this_thread::yield();
+                state.ResumeTiming();
+                pipeline.mLoader.update(pipeline.mLoaded);
+            }
+            pipeline.unloadAll();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(soundsCount));
+    }
+
+    // Time until all requested sounds are ready
+    void loadByWorkQueue(benchmark::State& state)
+    {
+        Pipeline pipeline;
+        const osg::ref_ptr<SceneUtil::WorkQueue> workQueue
+            = new SceneUtil::WorkQueue(static_cast<std::size_t>(state.range(0)));
+        pipeline.mLoader.setWorkQueue(workQueue);
+        for (auto _ : state)
+        {
+            for (const VFS::Path::Normalized& path : pipeline.mPaths)
+                pipeline.mLoader.request(path, SceneUtil::WorkPriority::Normal);
+            while (pipeline.mLoader.getPendingCount() > 0)
+            {
+                std::this_thread::yield();
+                pipeline.mLoader.update(pipeline.mLoaded);
+            }
+            pipeline.unloadAll();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(soundsCount));
+    }
+}
+
+BENCHMARK(loadOnMainThread);
+BENCHMARK(requestOnMainThread)->Arg(1)->Arg(2)->Arg(4);
+BENCHMARK(loadByWorkQueue)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+BENCHMARK_MAIN();
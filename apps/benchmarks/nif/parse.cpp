@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+
+#include <components/files/memorystream.hpp>
+#include <components/nif/niffile.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    class NifWriter
+    {
+    public:
+        template <class T>
+        void write(const T& value)
+        {
+            mData.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void writeRaw(std::string_view value) { mData.append(value); }
+
+        void writeString(std::string_view value)
+        {
+            write(static_cast<std::uint32_t>(value.size()));
+            mData.append(value);
+        }
+
+        void writeVec3(float x, float y, float z)
+        {
+            write(x);
+            write(y);
+            write(z);
+        }
+
+        // NiAVObject fields of version 4.0.0.2 with identity transform and without properties and bounds
+        void writeAVObject(std::string_view name)
+        {
+            writeString(name);
+            write(std::int32_t{ -1 }); // Extra data
+            write(std::int32_t{ -1 }); // Controller
+            write(std::uint16_t{ 0 }); // Flags
+            writeVec3(0, 0, 0);
+            for (int i = 0; i < 3; ++i)
+                writeVec3(i == 0, i == 1, i == 2);
+            write(1.0f); // Scale
+            writeVec3(0, 0, 0); // Velocity
+            write(std::uint32_t{ 0 }); // Properties
+            write(std::int32_t{ 0 }); // Has bounding volume
+        }
+
+        std::string release() { return std::move(mData); }
+
+    private:
+        std::string mData;
+    };
+
+    void writeTriShapeData(NifWriter& writer, std::uint16_t numVertices)
+    {
+        writer.writeString("NiTriShapeData");
+        writer.write(numVertices);
+        writer.write(std::int32_t{ 1 }); // Has vertices
+        for (std::uint16_t i = 0; i < numVertices; ++i)
+            writer.writeVec3(static_cast<float>(i / 2), static_cast<float>(i % 2), 0);
+        writer.write(std::int32_t{ 1 }); // Has normals
+        for (std::uint16_t i = 0; i < numVertices; ++i)
+            writer.writeVec3(0, 0, 1);
+        writer.writeVec3(0, 0, 0); // Bounding sphere center
+        writer.write(static_cast<float>(numVertices)); // Bounding sphere radius
+        writer.write(std::int32_t{ 0 }); // Has vertex colors
+        writer.write(std::uint16_t{ 1 }); // Number of UV sets
+        writer.write(std::int32_t{ 1 }); // Has UV
+        for (std::uint16_t i = 0; i < numVertices; ++i)
+        {
+            writer.write(static_cast<float>(i / 2));
+            writer.write(static_cast<float>(i % 2));
+        }
+        const std::uint16_t numTriangles = numVertices - 2;
+        writer.write(numTriangles);
+        writer.write(static_cast<std::uint32_t>(numTriangles * 3));
+        for (std::uint16_t i = 0; i < numTriangles; ++i)
+        {
+            writer.write(i);
+            writer.write(static_cast<std::uint16_t>(i + 1 + i % 2));
+            writer.write(static_cast<std::uint16_t>(i + 2 - i % 2));
+        }
+        writer.write(std::uint16_t{ 0 }); // Match groups
+    }
+
+    // Morrowind NIF file with a root NiNode and the given number of NiTriShape children. Each shape has a strip of
+    // triangles with vertices, normals and texture coordinates like most of the real meshes.
+    std::string makeNifFile(std::size_t numShapes, std::uint16_t numVertices)
+    {
+        NifWriter writer;
+        writer.writeRaw("NetImmerse File Format, Version 4.0.0.2\n");
+        writer.write(static_cast<std::uint32_t>(Nif::NIFFile::VER_MW));
+        writer.write(static_cast<std::uint32_t>(1 + numShapes * 2));
+
+        writer.writeString("NiNode");
+        writer.writeAVObject("Root");
+        writer.write(static_cast<std::uint32_t>(numShapes));
+        for (std::size_t i = 0; i < numShapes; ++i)
+            writer.write(static_cast<std::int32_t>(1 + i * 2));
+        writer.write(std::uint32_t{ 0 }); // Effects
+
+        for (std::size_t i = 0; i < numShapes; ++i)
+        {
+            writer.writeString("NiTriShape");
+            writer.writeAVObject("Tri Shape " + std::to_string(i));
+            writer.write(static_cast<std::int32_t>(2 + i * 2)); // Data
+            writer.write(std::int32_t{ -1 }); // Skin instance
+            writeTriShapeData(writer, numVertices);
+        }
+
+        writer.write(std::uint32_t{ 1 }); // Roots
+        writer.write(std::int32_t{ 0 });
+        return writer.release();
+    }
+
+    // Files have different number of shapes like a set of meshes loaded for a cell
+    std::vector<std::string> makeNifFiles(std::uint16_t numVertices)
+    {
+        std::vector<std::string> result;
+        for (std::size_t i = 1; i <= 32; ++i)
+            result.push_back(makeNifFile(i % 8 + 1, numVertices));
+        return result;
+    }
+
+    void parseNifFiles(benchmark::State& state)
+    {
+        const std::vector<std::string> files = makeNifFiles(static_cast<std::uint16_t>(state.range(0)));
+        std::size_t size = 0;
+        for (const std::string& file : files)
+            size += file.size();
+
+        for (auto _ : state)
+        {
+            for (const std::string& data : files)
+            {
+                Nif::NIFFile file("meshes/generated.nif");
+                Nif::Reader reader(file, nullptr);
+                reader.parse(std::make_unique<Files::IMemStream>(data.data(), data.size()));
+                benchmark::DoNotOptimize(file.mRecords.data());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(files.size()));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+    }
+}
+
+BENCHMARK(parseNifFiles)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <components/resource/objectcache.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include <osg/Object>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t itemsCount = 16 * 1024;
+
+    using GenericCache = Resource::GenericObjectCache<std::string>;
+    using ShardedCache = Resource::ShardedObjectCache<std::string, VFS::Path::Hash>;
+
+    struct Object : osg::Object
+    {
+        Object() = default;
+
+        Object(const Object& other, const osg::CopyOp& copyOp = osg::CopyOp())
+            : osg::Object(other, copyOp)
+        {
+        }
+
+        META_Object(ResourceBenchmark, Object)
+    };
+
+    const std::vector<std::string>& getKeys()
+    {
+        static const std::vector<std::string> keys = [] {
+            std::vector<std::string> result;
+            result.reserve(itemsCount);
+            for (std::size_t i = 0; i < itemsCount; ++i)
+                result.push_back("meshes/x/object_" + std::to_string(i) + ".nif");
+            std::shuffle(result.begin(), result.end(), std::minstd_rand());
+            return result;
+        }();
+        return keys;
+    }
+
+    template <class Cache>
+    Cache& getCache()
+    {
+        static const osg::ref_ptr<Cache> cache = [] {
+            osg::ref_ptr<Cache> result(new Cache);
+            for (const std::string& key : getKeys())
+                result->addEntryToObjectCache(key, new Object);
+            return result;
+        }();
+        return *cache;
+    }
+
+    // All threads share the same cache and look up different keys like worker threads loading unrelated resources.
+    template <class Cache>
+    void getRefFromObjectCache(benchmark::State& state)
+    {
+        Cache& cache = getCache<Cache>();
+        const std::vector<std::string>& keys = getKeys();
+        std::size_t i = static_cast<std::size_t>(state.thread_index()) * keys.size() / state.threads();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(cache.getRefFromObjectCache(keys[i]));
+            if (++i >= keys.size())
+                i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <class Cache>
+    void addEntryToObjectCache(benchmark::State& state)
+    {
+        Cache& cache = getCache<Cache>();
+        const std::vector<std::string>& keys = getKeys();
+        const osg::ref_ptr<osg::Object> object(new Object);
+        std::size_t i = static_cast<std::size_t>(state.thread_index()) * keys.size() / state.threads();
+        for (auto _ : state)
+        {
+            cache.addEntryToObjectCache(keys[i], object.get());
+            if (++i >= keys.size())
+                i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK_TEMPLATE(getRefFromObjectCache, GenericCache)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(getRefFromObjectCache, ShardedCache)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(addEntryToObjectCache, GenericCache)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(addEntryToObjectCache, ShardedCache)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm3/esmreader.hpp>
+#include <components/misc/resourcehelpers.hpp>
+#include <components/resource/resourcesystem.hpp>
+#include <components/resource/scenediskcache.hpp>
+#include <components/resource/scenemanager.hpp>
+#include <components/vfs/filesystemarchive.hpp>
+#include <components/vfs/manager.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Uses real game data: OPENMW_BENCHMARK_DATA is a data directory and OPENMW_BENCHMARK_CONTENT is a content file
+    // in it. All NIF files referenced by the content file records are loaded.
+    struct GameData
+    {
+        VFS::Manager mVfs;
+        std::vector<VFS::Path::Normalized> mMeshes;
+    };
+
+    std::vector<VFS::Path::Normalized> getReferencedMeshes(
+        const std::filesystem::path& contentFile, const VFS::Manager& vfs)
+    {
+        std::vector<VFS::Path::Normalized> result;
+        ESM::ESMReader reader;
+        reader.open(contentFile);
+        while (reader.hasMoreRecs())
+        {
+            reader.getRecName();
+            reader.getRecHeader();
+            while (reader.hasMoreSubs())
+            {
+                reader.getSubName();
+                if (reader.retSubName() != "MODL")
+                {
+                    reader.skipHSub();
+                    continue;
+                }
+                VFS::Path::Normalized path(Misc::ResourceHelpers::correctMeshPath(reader.getHString()));
+                if (path.value().ends_with(".nif") && vfs.exists(path))
+                    result.push_back(std::move(path));
+            }
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    const GameData* getGameData()
+    {
+        static const std::unique_ptr<GameData> data = []() -> std::unique_ptr<GameData> {
+            const char* const dataPath = std::getenv("OPENMW_BENCHMARK_DATA");
+            const char* const contentFile = std::getenv("OPENMW_BENCHMARK_CONTENT");
+            if (dataPath == nullptr || contentFile == nullptr)
+                return nullptr;
+            auto result = std::make_unique<GameData>();
+            result->mVfs.addArchive(std::make_unique<VFS::FileSystemArchive>(dataPath));
+            result->mVfs.buildIndex();
+            result->mMeshes = getReferencedMeshes(std::filesystem::path(dataPath) / contentFile, result->mVfs);
+            return result;
+        }();
+        return data.get();
+    }
+
+    std::filesystem::path getCacheDirectory()
+    {
+        return std::filesystem::temp_directory_path() / "openmw_scenediskcache_benchmark";
+    }
+
+    void loadMeshes(benchmark::State& state, const GameData& data, Resource::ResourceSystem& resourceSystem)
+    {
+        for (auto _ : state)
+        {
+            // Drop parsed NIF files and images too like they are on a new launch
+            resourceSystem.clearCache();
+            for (const VFS::Path::Normalized& mesh : data.mMeshes)
+                benchmark::DoNotOptimize(resourceSystem.getSceneManager()->getTemplate(mesh, false));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.mMeshes.size()));
+    }
+
+    void convertMeshes(benchmark::State& state)
+    {
+        const GameData* const data = getGameData();
+        if (data == nullptr)
+        {
+            state.SkipWithError("OPENMW_BENCHMARK_DATA and OPENMW_BENCHMARK_CONTENT are not set");
+            return;
+        }
+        Resource::ResourceSystem resourceSystem(&data->mVfs, 0, nullptr);
+        loadMeshes(state, *data, resourceSystem);
+    }
+
+    void loadMeshesFromDiskCache(benchmark::State& state)
+    {
+        const GameData* const data = getGameData();
+        if (data == nullptr)
+        {
+            state.SkipWithError("OPENMW_BENCHMARK_DATA and OPENMW_BENCHMARK_CONTENT are not set");
+            return;
+        }
+        std::filesystem::remove_all(getCacheDirectory());
+        Resource::ResourceSystem resourceSystem(&data->mVfs, 0, nullptr);
+        Resource::SceneManager& sceneManager = *resourceSystem.getSceneManager();
+        sceneManager.setDiskCache(std::make_unique<Resource::SceneDiskCache>(
+            getCacheDirectory(), Resource::makeSceneDiskCacheKey(data->mVfs)));
+        // Fill the cache like the first launch does
+        for (const VFS::Path::Normalized& mesh : data->mMeshes)
+            sceneManager.getTemplate(mesh, false);
+        loadMeshes(state, *data, resourceSystem);
+        std::filesystem::remove_all(getCacheDirectory());
+    }
+}
+
+BENCHMARK(convertMeshes)->Unit(benchmark::kMillisecond);
+BENCHMARK(loadMeshesFromDiskCache)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
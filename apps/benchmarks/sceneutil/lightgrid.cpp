@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <components/sceneutil/lightgrid.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Large interior with lights and objects spread over many rooms in front of the camera
+    constexpr float roomsWidth = 8192;
+    constexpr float roomsHeight = 1024;
+    constexpr float roomsDepth = 8192;
+    // Typical light radius scaled by the default light bounds multiplier
+    constexpr float minLightRadius = 150 * 1.65f;
+    constexpr float maxLightRadius = 500 * 1.65f;
+    constexpr float minObjectRadius = 10;
+    constexpr float maxObjectRadius = 200;
+    constexpr std::size_t objectsCount = 2000;
+
+    std::vector<osg::BoundingSphere> makeBounds(
+        std::minstd_rand& random, std::size_t count, float minRadius, float maxRadius)
+    {
+        std::uniform_real_distribution<float> x(-roomsWidth / 2, roomsWidth / 2);
+        std::uniform_real_distribution<float> y(-roomsHeight / 2, roomsHeight / 2);
+        std::uniform_real_distribution<float> z(-roomsDepth, 0);
+        std::uniform_real_distribution<float> radius(minRadius, maxRadius);
+        std::vector<osg::BoundingSphere> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result.emplace_back(osg::Vec3f(x(random), y(random), z(random)), radius(random));
+        return result;
+    }
+
+    // Same pattern as LightListCallback::pushLightState before using the grid: each node checks all lights
+    std::size_t assignLightsByLinearSearch(
+        const std::vector<osg::BoundingSphere>& lights, const std::vector<osg::BoundingSphere>& objects)
+    {
+        std::size_t result = 0;
+        std::vector<const osg::BoundingSphere*> lightList;
+        for (const osg::BoundingSphere& object : objects)
+        {
+            lightList.clear();
+            for (const osg::BoundingSphere& light : lights)
+                if (light.intersects(object))
+                    lightList.push_back(&light);
+            result += lightList.size();
+        }
+        return result;
+    }
+
+    // Grid is built once per frame and each node looks up only the lights from its clusters
+    std::size_t assignLightsByGrid(const std::vector<osg::BoundingSphere>& lights,
+        const std::vector<osg::BoundingSphere>& objects, SceneUtil::LightGrid& grid)
+    {
+        grid.build(lights);
+        std::size_t result = 0;
+        std::vector<const osg::BoundingSphere*> lightList;
+        for (const osg::BoundingSphere& object : objects)
+        {
+            lightList.clear();
+            grid.forEachCandidate(object, [&](std::size_t index) {
+                if (lights[index].intersects(object))
+                    lightList.push_back(&lights[index]);
+            });
+            result += lightList.size();
+        }
+        return result;
+    }
+
+    void linearSearch(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<osg::BoundingSphere> lights
+            = makeBounds(random, static_cast<std::size_t>(state.range(0)), minLightRadius, maxLightRadius);
+        const std::vector<osg::BoundingSphere> objects
+            = makeBounds(random, objectsCount, minObjectRadius, maxObjectRadius);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(assignLightsByLinearSearch(lights, objects));
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(objects.size()));
+    }
+
+    void lightGrid(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        const std::vector<osg::BoundingSphere> lights
+            = makeBounds(random, static_cast<std::size_t>(state.range(0)), minLightRadius, maxLightRadius);
+        const std::vector<osg::BoundingSphere> objects
+            = makeBounds(random, objectsCount, minObjectRadius, maxObjectRadius);
+        SceneUtil::LightGrid grid;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(assignLightsByGrid(lights, objects, grid));
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(objects.size()));
+    }
+}
+
+BENCHMARK(linearSearch)->Arg(8)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK(lightGrid)->Arg(8)->Arg(32)->Arg(128)->Arg(512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <components/vfs/fileindex.hpp>
+#include <components/vfs/filemap.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t filesCount = 200 * 1024;
+
+    constexpr std::array<std::string_view, 6> roots = { "meshes", "textures", "icons", "sound", "music", "bookart" };
+
+    constexpr std::array<std::string_view, 4> extensions = { ".nif", ".dds", ".tga", ".wav" };
+
+    template <class Random>
+    std::string generateName(std::size_t size, Random& random)
+    {
+        std::uniform_int_distribution<int> distribution('a', 'z');
+        std::string result;
+        result.reserve(size);
+        std::generate_n(std::back_inserter(result), size, [&] { return static_cast<char>(distribution(random)); });
+        return result;
+    }
+
+    // Generates a tree similar to vanilla data files: a few roots with nested directories and files.
+    template <class Random>
+    std::vector<VFS::Path::Normalized> generatePaths(std::size_t count, Random& random)
+    {
+        std::uniform_int_distribution<std::size_t> rootDistribution(0, roots.size() - 1);
+        std::uniform_int_distribution<std::size_t> extensionDistribution(0, extensions.size() - 1);
+        std::uniform_int_distribution<std::size_t> depthDistribution(0, 3);
+        std::uniform_int_distribution<std::size_t> nameSizeDistribution(4, 16);
+        std::vector<VFS::Path::Normalized> result;
+        result.reserve(count);
+        while (result.size() < count)
+        {
+            std::string path(roots[rootDistribution(random)]);
+            for (std::size_t i = 0, n = depthDistribution(random); i < n; ++i)
+            {
+                path += VFS::Path::separator;
+                path += generateName(nameSizeDistribution(random), random);
+            }
+            path += VFS::Path::separator;
+            path += generateName(nameSizeDistribution(random), random);
+            path += extensions[extensionDistribution(random)];
+            result.emplace_back(std::move(path));
+        }
+        return result;
+    }
+
+    struct Data
+    {
+        VFS::FileMap mFiles;
+        std::vector<VFS::Path::Normalized> mPresent;
+        std::vector<VFS::Path::Normalized> mAbsent;
+    };
+
+    const Data& getData()
+    {
+        static const Data data = [] {
+            std::minstd_rand random;
+            Data result;
+            for (VFS::Path::Normalized& path : generatePaths(filesCount, random))
+                result.mFiles.emplace(std::move(path), nullptr);
+            for (const auto& [path, file] : result.mFiles)
+                result.mPresent.push_back(path);
+            std::shuffle(result.mPresent.begin(), result.mPresent.end(), random);
+            for (VFS::Path::Normalized& path : generatePaths(filesCount, random))
+                if (!result.mFiles.contains(path))
+                    result.mAbsent.push_back(std::move(path));
+            return result;
+        }();
+        return data;
+    }
+
+    template <class Find>
+    void lookup(benchmark::State& state, const std::vector<VFS::Path::Normalized>& paths, Find&& find)
+    {
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(find(paths[i].view()));
+            if (++i >= paths.size())
+                i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void findPresentInFileMap(benchmark::State& state)
+    {
+        const Data& data = getData();
+        lookup(state, data.mPresent, [&](std::string_view path) { return data.mFiles.find(path); });
+    }
+
+    void findAbsentInFileMap(benchmark::State& state)
+    {
+        const Data& data = getData();
+        lookup(state, data.mAbsent, [&](std::string_view path) { return data.mFiles.find(path); });
+    }
+
+    void findPresentInFileIndex(benchmark::State& state)
+    {
+        const Data& data = getData();
+        VFS::FileIndex index;
+        index.build(data.mFiles);
+        lookup(state, data.mPresent, [&](std::string_view path) { return index.find(path); });
+    }
+
+    void findAbsentInFileIndex(benchmark::State& state)
+    {
+        const Data& data = getData();
+        VFS::FileIndex index;
+        index.build(data.mFiles);
+        lookup(state, data.mAbsent, [&](std::string_view path) { return index.find(path); });
+    }
+
+    void buildFileIndex(benchmark::State& state)
+    {
+        const Data& data = getData();
+        for (auto _ : state)
+        {
+            VFS::FileIndex index;
+            index.build(data.mFiles);
+            benchmark::DoNotOptimize(index);
+        }
+        state.SetItemsProcessed(state.iterations() * data.mFiles.size());
+    }
+}
+
+BENCHMARK(findPresentInFileMap);
+BENCHMARK(findAbsentInFileMap);
+BENCHMARK(findPresentInFileIndex);
+BENCHMARK(findAbsentInFileIndex);
+BENCHMARK(buildFileIndex);
+
+BENCHMARK_MAIN();
@@ -132,6 +132,12 @@ namespace
         return BulletHelpers::getHeightfieldShift(cellPosition.x(), cellPosition.x(), cellSize, minHeight, maxHeight);
     }
 
+    void waitUntilDone(const PathQuery& query)
+    {
+        while (!query.isDone())
+            std::this_thread::yield();
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, find_path_for_empty_should_return_empty)
     {
         EXPECT_EQ(findPath(*mNavigator, mAgentBounds, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
@@ -195,6 +201,116 @@ namespace
         EXPECT_THAT(mPath, ElementsAre(Vec3fEq(56.66666412353515625, 460, 1.99998295307159423828125))) << mPath;
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, request_path_for_empty_should_be_done_with_navmesh_not_found)
+    {
+        const SharedPathQuery query = mNavigator->requestPath(PathRequest{ .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance });
+        ASSERT_TRUE(query->isDone());
+        EXPECT_EQ(query->getResult().mStatus, Status::NavMeshNotFound);
+        EXPECT_THAT(query->getResult().mPath, IsEmpty());
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, request_path_should_not_be_processed_before_dispatch)
+    {
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        const SharedPathQuery query = mNavigator->requestPath(PathRequest{ .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance });
+        EXPECT_FALSE(query->isDone());
+        EXPECT_EQ(mNavigator->getStats().mPathFinder.mQueued, 0);
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, request_path_then_dispatch_should_return_same_path_as_find_path)
+    {
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(defaultHeightfieldData);
+        const int cellSize = heightfieldTileSize * static_cast<int>(surface.mSize - 1);
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        auto updateGuard = mNavigator->makeUpdateGuard();
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface, updateGuard.get());
+        mNavigator->update(mPlayerPosition, updateGuard.get());
+        updateGuard.reset();
+        mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+
+        ASSERT_EQ(findPath(*mNavigator, mAgentBounds, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+            Status::Success);
+
+        const SharedPathQuery query = mNavigator->requestPath(PathRequest{ .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance });
+        mNavigator->dispatchPathQueries();
+        waitUntilDone(*query);
+
+        EXPECT_EQ(query->getResult().mStatus, Status::Success);
+        EXPECT_THAT(query->getResult().mPath, ElementsAreArray(mPath));
+
+        mNavigator->dispatchPathQueries();
+        const AsyncPathFinderStats stats = mNavigator->getStats().mPathFinder;
+        EXPECT_EQ(stats.mDone, 1);
+        EXPECT_EQ(stats.mCancelled, 0);
+        EXPECT_GT(stats.mMaxLatency, 0);
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, request_path_without_threads_should_be_done_on_dispatch)
+    {
+        mSettings.mAsyncPathFinderThreads = 0;
+        mNavigator.reset(new NavigatorImpl(
+            mSettings, std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max())));
+
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(defaultHeightfieldData);
+        const int cellSize = heightfieldTileSize * static_cast<int>(surface.mSize - 1);
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface, nullptr);
+        mNavigator->update(mPlayerPosition, nullptr);
+        mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+
+        const SharedPathQuery query = mNavigator->requestPath(PathRequest{ .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance });
+        mNavigator->dispatchPathQueries();
+
+        ASSERT_TRUE(query->isDone());
+        EXPECT_EQ(query->getResult().mStatus, Status::Success);
+        EXPECT_THAT(query->getResult().mPath,
+            ElementsAre( //
+                Vec3fEq(56.66664886474609375, 460, 1.99999392032623291015625),
+                Vec3fEq(460, 56.66664886474609375, 1.99999392032623291015625)));
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, dropped_path_query_should_be_cancelled)
+    {
+        mSettings.mAsyncPathFinderThreads = 0;
+        mNavigator.reset(new NavigatorImpl(
+            mSettings, std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max())));
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        mNavigator->requestPath(PathRequest{ .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance });
+        mNavigator->dispatchPathQueries();
+
+        const AsyncPathFinderStats stats = mNavigator->getStats().mPathFinder;
+        EXPECT_EQ(stats.mDone, 0);
+        EXPECT_EQ(stats.mCancelled, 1);
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, add_object_should_change_navmesh)
     {
         mSettings.mWaitUntilMinDistanceToPlayer = 0;
@@ -6,9 +6,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <functional>
 #include <map>
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 MATCHER(IsPrint, "")
 {
@@ -241,6 +245,37 @@ namespace ESM
             EXPECT_TRUE(!(b < a));
         }
 
+        TEST(ESMRefIdTest, stringRefIdsCreatedForManyValuesShouldBeFoundByDeserialization)
+        {
+            std::vector<StringRefId> ids;
+            for (int i = 0; i < 10000; ++i)
+                ids.emplace_back("many string ref ids " + std::to_string(i));
+            for (int i = 0; i < 10000; ++i)
+            {
+                const std::optional<StringRefId> id
+                    = StringRefId::deserializeExisting("MANY STRING REF IDS " + std::to_string(i));
+                ASSERT_TRUE(id.has_value()) << i;
+                EXPECT_EQ(*id, ids[i]);
+            }
+        }
+
+        TEST(ESMRefIdTest, stringRefIdsCreatedConcurrentlyForTheSameValueShouldBeEqual)
+        {
+            constexpr std::size_t threadsCount = 4;
+            constexpr int valuesCount = 1000;
+            std::array<std::vector<StringRefId>, threadsCount> ids;
+            std::vector<std::thread> threads;
+            for (std::size_t i = 0; i < threadsCount; ++i)
+                threads.emplace_back([&, i] {
+                    for (int j = 0; j < valuesCount; ++j)
+                        ids[i].emplace_back("concurrent string ref id " + std::to_string(j));
+                });
+            for (std::thread& thread : threads)
+                thread.join();
+            for (std::size_t i = 1; i < threadsCount; ++i)
+                EXPECT_EQ(ids[i], ids[0]);
+        }
+
         struct ESMRefIdToStringTest : TestWithParam<std::pair<RefId, std::string>>
         {
         };
@@ -363,6 +363,73 @@ namespace ESMTerrain
                     Sample{ .mCellX = 3, .mCellY = 3, .mLocalX = 2, .mLocalY = 2, .mVertexX = 1, .mVertexY = 1 }));
         }
 
+        struct CollectRows
+        {
+            std::vector<Sample>& mSamples;
+            std::size_t mSampleSize;
+
+            void operator()(const CellRowSamples& row)
+            {
+                for (std::size_t i = 0; i < row.mCount; ++i)
+                    mSamples.push_back(Sample{
+                        .mCellX = row.mCellX,
+                        .mCellY = row.mCellY,
+                        .mLocalX = row.mBeginX + i * mSampleSize,
+                        .mLocalY = row.mY,
+                        .mVertexX = row.mVertexX + i,
+                        .mVertexY = row.mVertexY,
+                    });
+            }
+        };
+
+        TEST(ESMTerrainSampleCellGridRows, shouldMergeSamplesOfTheSameCellRow)
+        {
+            const std::size_t cellSize = 3;
+            const std::size_t sampleSize = 1;
+            const std::size_t beginX = 0;
+            const std::size_t beginY = 0;
+            const std::size_t distance = 5;
+            std::vector<CellRowSamples> rows;
+            sampleCellGridRows(
+                cellSize, sampleSize, beginX, beginY, distance, [&](const CellRowSamples& v) { rows.push_back(v); });
+            ASSERT_EQ(rows.size(), 10);
+            EXPECT_EQ(rows[0].mCellX, 0);
+            EXPECT_EQ(rows[0].mBeginX, 0);
+            EXPECT_EQ(rows[0].mCount, 3);
+            EXPECT_EQ(rows[3].mCellX, 1);
+            EXPECT_EQ(rows[3].mBeginX, 1);
+            EXPECT_EQ(rows[3].mCount, 2);
+            EXPECT_EQ(rows[3].mVertexX, 3);
+        }
+
+        struct ESMTerrainSampleCellGridRowsParams
+        {
+            std::size_t mSampleSize;
+            std::size_t mBeginX;
+            std::size_t mBeginY;
+            std::size_t mDistance;
+        };
+
+        struct ESMTerrainSampleCellGridRowsTest : TestWithParam<ESMTerrainSampleCellGridRowsParams>
+        {
+        };
+
+        TEST_P(ESMTerrainSampleCellGridRowsTest, shouldProduceSameSamplesAsSampleCellGrid)
+        {
+            const std::size_t cellSize = 5;
+            const auto& [sampleSize, beginX, beginY, distance] = GetParam();
+            std::vector<Sample> expected;
+            sampleCellGrid(cellSize, sampleSize, beginX, beginY, distance, Collect{ expected });
+            std::vector<Sample> samples;
+            sampleCellGridRows(cellSize, sampleSize, beginX, beginY, distance, CollectRows{ samples, sampleSize });
+            EXPECT_THAT(samples, ElementsAreArray(expected));
+        }
+
+        INSTANTIATE_TEST_SUITE_P(Params, ESMTerrainSampleCellGridRowsTest,
+            Values(ESMTerrainSampleCellGridRowsParams{ 1, 0, 0, 9 }, ESMTerrainSampleCellGridRowsParams{ 2, 0, 0, 9 },
+                ESMTerrainSampleCellGridRowsParams{ 1, 2, 1, 5 }, ESMTerrainSampleCellGridRowsParams{ 1, 3, 2, 3 },
+                ESMTerrainSampleCellGridRowsParams{ 8, 0, 0, 17 }, ESMTerrainSampleCellGridRowsParams{ 4, 4, 0, 9 }));
+
         auto tie(const CellSample& v)
         {
             return std::tie(v.mCellX, v.mCellY, v.mSrcRow, v.mSrcCol, v.mDstRow, v.mDstCol);
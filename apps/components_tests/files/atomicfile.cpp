@@ -0,0 +1,52 @@
+#include <components/files/atomicfile.hpp>
+#include <components/testing/util.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <iterator>
+#include <string>
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+    using namespace Files;
+
+    TEST(FilesAtomicFileTest, readFileContentShouldReturnNulloptForMissingFile)
+    {
+        EXPECT_EQ(readFileContent(outputFilePath("atomicfile_missing")), std::nullopt);
+    }
+
+    TEST(FilesAtomicFileTest, readFileContentShouldReturnWrittenData)
+    {
+        const std::filesystem::path path = outputFilePath("atomicfile_written");
+        const std::string data("a\0b", 3);
+        writeFileAtomically(path, data);
+        EXPECT_EQ(readFileContent(path), data);
+    }
+
+    TEST(FilesAtomicFileTest, writeFileAtomicallyShouldReplaceContent)
+    {
+        const std::filesystem::path path = outputFilePath("atomicfile_replaced");
+        writeFileAtomically(path, "long content");
+        writeFileAtomically(path, "short");
+        EXPECT_EQ(readFileContent(path), "short");
+    }
+
+    TEST(FilesAtomicFileTest, writeFileAtomicallyShouldNotLeaveTemporaryFile)
+    {
+        const std::filesystem::path directory = outputFilePath("atomicfile_directory");
+        std::filesystem::create_directories(directory);
+        writeFileAtomically(directory / "file", "content");
+        const std::filesystem::directory_iterator begin(directory);
+        EXPECT_EQ(std::distance(begin, std::filesystem::directory_iterator()), 1);
+    }
+
+    TEST(FilesAtomicFileTest, writeFileAtomicallyShouldThrowWhenDirectoryIsMissing)
+    {
+        EXPECT_THROW(writeFileAtomically(outputFilePath("atomicfile_missing_directory") / "file", "content"),
+            std::exception);
+    }
+}
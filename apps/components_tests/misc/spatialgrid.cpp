@@ -0,0 +1,115 @@
+#include <components/misc/spatialgrid.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    std::vector<int> getNear(const SpatialGrid<int>& grid, const osg::Vec3f& position, float radius)
+    {
+        std::vector<int> result;
+        grid.forEachNear(position, radius, [&](int value) { result.push_back(value); });
+        return result;
+    }
+
+    TEST(MiscSpatialGridTest, forEachNearOnEmptyShouldNotCallFunction)
+    {
+        const SpatialGrid<int> grid(100);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(0, 0, 0), 1000), IsEmpty());
+    }
+
+    TEST(MiscSpatialGridTest, forEachNearShouldReturnValuesFromIntersectingCells)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(10, 10, 0), 1);
+        grid.insert(osg::Vec3f(150, 10, 0), 2);
+        grid.insert(osg::Vec3f(-50, -50, 0), 3);
+        grid.insert(osg::Vec3f(350, 10, 0), 4);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(110, 50, 0), 30), UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialGridTest, forEachNearShouldIgnoreZ)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(10, 10, 1000), 1);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(10, 10, 0), 10), ElementsAre(1));
+    }
+
+    TEST(MiscSpatialGridTest, forEachNearShouldSupportNegativeCoordinates)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(-10, -10, 0), 1);
+        grid.insert(osg::Vec3f(10, 10, 0), 2);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(-20, -20, 0), 5), ElementsAre(1));
+    }
+
+    TEST(MiscSpatialGridTest, forEachNearShouldSupportRadiusLargerThanGrid)
+    {
+        SpatialGrid<int> grid(1);
+        grid.insert(osg::Vec3f(0, 0, 0), 1);
+        grid.insert(osg::Vec3f(1e6f, -1e6f, 0), 2);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(0, 0, 0), 1e7f), UnorderedElementsAre(1, 2));
+        EXPECT_THAT(getNear(grid, osg::Vec3f(0, 0, 0), std::numeric_limits<float>::max()), UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialGridTest, forEachNearMovingShouldReturnValuesFromNeighbouringCells)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(10, 10, 0), 1);
+        grid.insert(osg::Vec3f(150, 10, 0), 2);
+        grid.insert(osg::Vec3f(250, 10, 0), 3);
+        grid.insert(osg::Vec3f(350, 10, 0), 4);
+        std::vector<int> result;
+        grid.forEachNearMoving(osg::Vec3f(10, 10, 0), 5, [&](int value) { result.push_back(value); });
+        EXPECT_THAT(result, UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialGridTest, eraseShouldRemoveAllItemsWithValue)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(0, 0, 0), 1);
+        grid.insert(osg::Vec3f(500, 0, 0), 1);
+        grid.insert(osg::Vec3f(0, 0, 0), 2);
+        grid.erase(1);
+        EXPECT_EQ(grid.size(), 1);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(0, 0, 0), 1000), ElementsAre(2));
+    }
+
+    TEST(MiscSpatialGridTest, rebuildShouldReplaceItemsKeepingOrderWithinCell)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(0, 0, 0), 42);
+        const std::vector<std::pair<osg::Vec3f, int>> values{
+            { osg::Vec3f(10, 10, 0), 3 },
+            { osg::Vec3f(250, 10, 0), 1 },
+            { osg::Vec3f(20, 20, 0), 2 },
+        };
+        grid.rebuild(
+            values, [](const auto& v) { return v.second; },
+            [&](int value) {
+                for (const auto& [position, v] : values)
+                    if (v == value)
+                        return position;
+                return osg::Vec3f();
+            });
+        EXPECT_EQ(grid.size(), 3);
+        EXPECT_THAT(getNear(grid, osg::Vec3f(50, 50, 0), 10), ElementsAre(3, 2));
+        EXPECT_THAT(getNear(grid, osg::Vec3f(250, 50, 0), 10), ElementsAre(1));
+    }
+
+    TEST(MiscSpatialGridTest, clearShouldRemoveAllItems)
+    {
+        SpatialGrid<int> grid(100);
+        grid.insert(osg::Vec3f(0, 0, 0), 1);
+        grid.clear();
+        EXPECT_TRUE(grid.empty());
+        EXPECT_THAT(getNear(grid, osg::Vec3f(0, 0, 0), 1000), IsEmpty());
+    }
+}
@@ -0,0 +1,102 @@
+#include <components/nif/niffile.hpp>
+#include <components/nif/nifstream.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Nif
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        template <class T>
+        void append(std::string& data, const T& value)
+        {
+            data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        struct NifNIFStreamTest : Test
+        {
+            NIFFile mFile{ "test.nif" };
+            Reader mReader{ mFile, nullptr };
+        };
+
+        TEST_F(NifNIFStreamTest, shouldReadValuesAndArrays)
+        {
+            std::string data;
+            append(data, std::uint32_t{ 42 });
+            append(data, std::int16_t{ -3 });
+            for (float value : { 1.5f, 2.5f, 3.5f, 4.5f })
+                append(data, value);
+            append(data, std::uint8_t{ 7 });
+            NIFStream stream(mReader, data, nullptr);
+            EXPECT_EQ(stream.get<std::uint32_t>(), 42);
+            EXPECT_EQ(stream.get<std::int16_t>(), -3);
+            std::vector<float> values;
+            stream.readVector(values, 3);
+            EXPECT_THAT(values, ElementsAre(1.5f, 2.5f, 3.5f));
+            std::array<float, 1> array;
+            stream.readArray(array);
+            EXPECT_THAT(array, ElementsAre(4.5f));
+            EXPECT_EQ(stream.get<std::uint8_t>(), 7);
+        }
+
+        TEST_F(NifNIFStreamTest, shouldReadVectorsContiguously)
+        {
+            std::string data;
+            for (float value : { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f })
+                append(data, value);
+            NIFStream stream(mReader, data, nullptr);
+            std::vector<osg::Vec3f> values;
+            stream.readVector(values, 2);
+            EXPECT_THAT(values, ElementsAre(osg::Vec3f(1, 2, 3), osg::Vec3f(4, 5, 6)));
+        }
+
+        TEST_F(NifNIFStreamTest, shouldReadStrings)
+        {
+            std::string data = "Version line\n";
+            append(data, std::uint32_t{ 5 });
+            data.append("ab\0cd", 5);
+            append(data, std::uint8_t{ 3 });
+            data += "xyz";
+            append(data, std::uint32_t{ 4 });
+            data.append("a\0b\0", 4);
+            NIFStream stream(mReader, data, nullptr);
+            EXPECT_EQ(stream.getVersionString(), "Version line");
+            EXPECT_EQ(stream.getSizedString(), "ab");
+            EXPECT_EQ(stream.getExportString(), "xyz");
+            EXPECT_EQ(stream.getStringPalette(), std::string("a\0b\0", 4));
+        }
+
+        TEST_F(NifNIFStreamTest, shouldSkipData)
+        {
+            std::string data;
+            append(data, std::uint32_t{ 1 });
+            append(data, std::uint32_t{ 2 });
+            NIFStream stream(mReader, data, nullptr);
+            stream.skip(4);
+            EXPECT_EQ(stream.get<std::uint32_t>(), 2);
+        }
+
+        TEST_F(NifNIFStreamTest, shouldThrowExceptionOnUnexpectedEnd)
+        {
+            std::string data;
+            append(data, std::uint16_t{ 1 });
+            NIFStream stream(mReader, data, nullptr);
+            EXPECT_THROW(stream.get<std::uint32_t>(), std::runtime_error);
+            std::vector<std::uint16_t> values;
+            EXPECT_THROW(stream.readVector(values, 2), std::runtime_error);
+            EXPECT_THROW(stream.getSizedString(3), std::runtime_error);
+            EXPECT_THROW(stream.skip(3), std::runtime_error);
+            EXPECT_EQ(stream.get<std::uint16_t>(), 1);
+        }
+    }
+}
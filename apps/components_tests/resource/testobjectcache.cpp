@@ -1,9 +1,14 @@
 #include <components/resource/objectcache.hpp>
+#include <components/resource/objectsize.hpp>
+#include <components/vfs/pathutil.hpp>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <osg/Group>
+#include <osg/Image>
 #include <osg/Object>
+#include <osg/Texture2D>
 
 namespace Resource
 {
@@ -373,5 +378,269 @@ namespace Resource
             cache->addEntryToObjectCache(key, value);
             EXPECT_TRUE(cache->checkInObjectCache(std::string_view("key"), 0));
         }
+
+        osg::ref_ptr<osg::Image> makeImage(int width)
+        {
+            osg::ref_ptr<osg::Image> result(new osg::Image);
+            result->allocateImage(width, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+            return result;
+        }
+
+        TEST(ResourceGenericObjectCacheTest, getStatsShouldReturnEstimatedSizeOfItems)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMaxBytes(1024);
+
+            cache->addEntryToObjectCache(1, makeImage(16));
+            cache->addEntryToObjectCache(2, makeImage(32));
+            cache->addEntryToObjectCache(3, nullptr);
+
+            EXPECT_EQ(cache->getStats().mBytes, 16 * 4 + 32 * 4);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, addEntryToObjectCacheShouldReplaceEstimatedSizeOfExistingItem)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMaxBytes(1024);
+
+            cache->addEntryToObjectCache(1, makeImage(16));
+            cache->addEntryToObjectCache(1, makeImage(8));
+
+            EXPECT_EQ(cache->getStats().mBytes, 8 * 4);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, removeFromObjectCacheShouldSubtractEstimatedSizeOfItem)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMaxBytes(1024);
+
+            cache->addEntryToObjectCache(1, makeImage(16));
+            cache->addEntryToObjectCache(2, makeImage(32));
+            cache->removeFromObjectCache(1);
+
+            EXPECT_EQ(cache->getStats().mBytes, 32 * 4);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldRemoveLeastRecentlyUsedItemsWhenOverBudget)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            const double expiryDelay = 100;
+
+            cache->setMaxBytes(2 * 16 * 4);
+            cache->addEntryToObjectCache(1, makeImage(16), 3);
+            cache->addEntryToObjectCache(2, makeImage(16), 1);
+            cache->addEntryToObjectCache(3, makeImage(16), 2);
+
+            cache->update(4, expiryDelay);
+
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(2), std::nullopt);
+            EXPECT_NE(cache->getRefFromObjectCacheOrNone(1), std::nullopt);
+            EXPECT_NE(cache->getRefFromObjectCacheOrNone(3), std::nullopt);
+
+            const CacheStats stats = cache->getStats();
+            EXPECT_EQ(stats.mSize, 2);
+            EXPECT_EQ(stats.mEvicted, 1);
+            EXPECT_EQ(stats.mExpired, 0);
+            EXPECT_EQ(stats.mBytes, 2 * 16 * 4);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldNotRemoveReferencedItemsWhenOverBudget)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            const double expiryDelay = 100;
+
+            cache->setMaxBytes(0);
+            const osg::ref_ptr<osg::Image> image = makeImage(16);
+            cache->addEntryToObjectCache(1, image, 1);
+            cache->addEntryToObjectCache(2, makeImage(16), 2);
+
+            cache->update(3, expiryDelay);
+
+            EXPECT_EQ(cache->getRefFromObjectCache(1), image);
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(2), std::nullopt);
+            EXPECT_EQ(cache->getStats().mBytes, 16 * 4);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, clearShouldResetEstimatedSize)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->setMaxBytes(1024);
+
+            cache->addEntryToObjectCache(1, makeImage(16));
+            cache->clear();
+
+            EXPECT_EQ(cache->getStats().mBytes, 0);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, addEntryToObjectCacheShouldNotEstimateSizeWithoutBudget)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            cache->addEntryToObjectCache(1, makeImage(16));
+
+            EXPECT_EQ(cache->getStats().mBytes, 0);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, setMaxBytesShouldEstimateSizeOfExistingItems)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            cache->addEntryToObjectCache(1, makeImage(16));
+            cache->setMaxBytes(1024);
+
+            EXPECT_EQ(cache->getStats().mBytes, 16 * 4);
+
+            cache->setMaxBytes(std::numeric_limits<std::size_t>::max());
+
+            EXPECT_EQ(cache->getStats().mBytes, 0);
+        }
+
+        TEST(ResourceObjectSizeTest, estimateObjectSizeShouldNotCountImagesFromFilesReferencedByNode)
+        {
+            const osg::ref_ptr<osg::Image> internal = makeImage(16);
+            const osg::ref_ptr<osg::Image> external = makeImage(32);
+            external->setFileName("textures/image.dds");
+            osg::ref_ptr<osg::Group> node(new osg::Group);
+            node->getOrCreateStateSet()->setTextureAttribute(0, new osg::Texture2D(internal));
+            node->getOrCreateStateSet()->setTextureAttribute(1, new osg::Texture2D(external));
+
+            EXPECT_EQ(estimateObjectSize(*node), 16 * 4);
+            EXPECT_EQ(estimateObjectSize(*external), 32 * 4);
+        }
+
+        using ShardedCache = ShardedObjectCache<std::string, VFS::Path::Hash>;
+
+        TEST(ResourceShardedObjectCacheTest, shouldStoreValues)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+            osg::ref_ptr<Object> value1(new Object);
+            osg::ref_ptr<Object> value2(new Object);
+            cache->addEntryToObjectCache("a", value1);
+            cache->addEntryToObjectCache("b", value2);
+            EXPECT_EQ(cache->getRefFromObjectCache(std::string("a")), value1);
+            EXPECT_EQ(cache->getRefFromObjectCache(std::string("b")), value2);
+        }
+
+        TEST(ResourceShardedObjectCacheTest, shouldSupportHeterogeneousLookup)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+            osg::ref_ptr<Object> value(new Object);
+            cache->addEntryToObjectCache(VFS::Path::Normalized("meshes/a.nif"), value);
+            EXPECT_EQ(cache->getRefFromObjectCache(std::string("meshes/a.nif")), value);
+            EXPECT_EQ(cache->getRefFromObjectCache(std::string_view("meshes/a.nif")), value);
+            EXPECT_EQ(cache->getRefFromObjectCache(VFS::Path::NormalizedView("meshes/a.nif")), value);
+            EXPECT_TRUE(cache->checkInObjectCache(std::string_view("meshes/a.nif"), 0));
+            cache->removeFromObjectCache(VFS::Path::NormalizedView("meshes/a.nif"));
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(std::string_view("meshes/a.nif")), std::nullopt);
+        }
+
+        TEST(ResourceShardedObjectCacheTest, updateShouldRemoveExpiredItems)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+
+            const double referenceTime = 1;
+            const double expiryDelay = 1;
+
+            osg::ref_ptr<Object> value(new Object);
+            cache->addEntryToObjectCache("a", value);
+            cache->addEntryToObjectCache("b", nullptr);
+            value = nullptr;
+
+            cache->update(referenceTime, expiryDelay);
+            ASSERT_EQ(cache->getStats().mSize, 2);
+            ASSERT_EQ(cache->getStats().mExpired, 0);
+
+            cache->update(referenceTime + expiryDelay, expiryDelay);
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(std::string_view("a")), std::nullopt);
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(std::string_view("b")), std::nullopt);
+            EXPECT_EQ(cache->getStats().mExpired, 2);
+        }
+
+        TEST(ResourceShardedObjectCacheTest, callShouldIterateOverAllItems)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+
+            osg::ref_ptr<Object> value1(new Object);
+            osg::ref_ptr<Object> value2(new Object);
+            osg::ref_ptr<Object> value3(new Object);
+            cache->addEntryToObjectCache("a", value1);
+            cache->addEntryToObjectCache("b", value2);
+            cache->addEntryToObjectCache("c", value3);
+
+            std::vector<std::pair<std::string, osg::Object*>> actual;
+            cache->call([&](const std::string& key, osg::Object* value) { actual.emplace_back(key, value); });
+
+            EXPECT_THAT(actual,
+                UnorderedElementsAre(Pair("a", value1.get()), Pair("b", value2.get()), Pair("c", value3.get())));
+        }
+
+        TEST(ResourceShardedObjectCacheTest, getStatsShouldSumOverAllItems)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+
+            for (int i = 0; i < 100; ++i)
+                cache->addEntryToObjectCache(std::to_string(i), nullptr);
+            for (int i = 0; i < 150; ++i)
+                cache->getRefFromObjectCache(std::to_string(i));
+
+            const CacheStats stats = cache->getStats();
+
+            EXPECT_EQ(stats.mSize, 100);
+            EXPECT_EQ(stats.mGet, 150);
+            EXPECT_EQ(stats.mHit, 100);
+        }
+
+        TEST(ResourceShardedObjectCacheTest, lowerBoundShouldReturnFirstNotLessThatGivenKeyOverAllItems)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+
+            for (int i = 0; i < 100; i += 2)
+                cache->addEntryToObjectCache(std::to_string(1000 + i), nullptr);
+
+            EXPECT_THAT(cache->lowerBound(std::string_view("1051")), Optional(Pair("1052", _)));
+            EXPECT_THAT(cache->lowerBound(std::string_view("0")), Optional(Pair("1000", _)));
+            EXPECT_EQ(cache->lowerBound(std::string_view("2")), std::nullopt);
+        }
+
+        TEST(ResourceShardedObjectCacheTest, clearShouldRemoveAllItems)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+
+            for (int i = 0; i < 100; ++i)
+                cache->addEntryToObjectCache(std::to_string(i), nullptr);
+
+            cache->clear();
+
+            EXPECT_EQ(cache->getStats().mSize, 0);
+        }
+
+        TEST(ResourceShardedObjectCacheTest, updateShouldApplyBudgetToAllShards)
+        {
+            osg::ref_ptr<ShardedCache> cache(new ShardedCache);
+
+            const double expiryDelay = 100;
+            constexpr int count = 64;
+
+            cache->setMaxBytes(count / 2 * 16 * 4);
+            for (int i = 0; i < count; ++i)
+                cache->addEntryToObjectCache("key" + std::to_string(i), makeImage(16), i + 1);
+
+            cache->update(count + 1, expiryDelay);
+
+            for (int i = 0; i < count; ++i)
+            {
+                const std::string key = "key" + std::to_string(i);
+                if (i < count / 2)
+                    EXPECT_EQ(cache->getRefFromObjectCacheOrNone(key), std::nullopt) << key;
+                else
+                    EXPECT_NE(cache->getRefFromObjectCacheOrNone(key), std::nullopt) << key;
+            }
+
+            const CacheStats stats = cache->getStats();
+            EXPECT_EQ(stats.mEvicted, count / 2);
+            EXPECT_EQ(stats.mBytes, count / 2 * 16 * 4);
+        }
     }
 }
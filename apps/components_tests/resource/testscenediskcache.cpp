@@ -0,0 +1,199 @@
+#include <components/nifosg/matrixtransform.hpp>
+#include <components/resource/scenediskcache.hpp>
+#include <components/sceneutil/texturetype.hpp>
+#include <components/testing/util.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <osg/AlphaFunc>
+#include <osg/Geometry>
+#include <osg/Image>
+#include <osg/Material>
+#include <osg/Texture2D>
+#include <osg/ValueObject>
+
+#include <filesystem>
+#include <string>
+
+namespace Resource
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        struct ResourceSceneDiskCacheTest : Test
+        {
+            osg::ref_ptr<osg::Image> mImage = new osg::Image;
+            osg::ref_ptr<osg::Group> mScene = new osg::Group;
+            osg::ref_ptr<NifOsg::MatrixTransform> mTransform = new NifOsg::MatrixTransform;
+            osg::ref_ptr<osg::Geometry> mGeometry = new osg::Geometry;
+            GetSceneImage mGetImage = [&](VFS::Path::NormalizedView path) {
+                return path.value() == "textures/foo.dds" ? mImage : osg::ref_ptr<osg::Image>();
+            };
+
+            ResourceSceneDiskCacheTest()
+            {
+                mImage->setFileName("textures/foo.dds");
+
+                mScene->setName("root");
+                mScene->setUserValue("fileHash", std::string("hash"));
+                mScene->getOrCreateUserDataContainer()->addDescription("NightDaySwitch");
+                mScene->addChild(mTransform);
+
+                mTransform->setName("Bip01");
+                mTransform->setScale(2);
+                mTransform->setTranslation(osg::Vec3f(1, 2, 3));
+                mTransform->setUserValue("recIndex", 7);
+                mTransform->addChild(mGeometry);
+
+                osg::ref_ptr<osg::Vec3Array> vertices = new osg::Vec3Array;
+                vertices->push_back(osg::Vec3f(0, 0, 0));
+                vertices->push_back(osg::Vec3f(1, 0, 0));
+                vertices->push_back(osg::Vec3f(0, 1, 0));
+                mGeometry->setVertexArray(vertices);
+                osg::ref_ptr<osg::Vec2Array> texCoords = new osg::Vec2Array(3);
+                mGeometry->setTexCoordArray(0, texCoords, osg::Array::BIND_PER_VERTEX);
+                osg::ref_ptr<osg::DrawElementsUShort> triangles
+                    = new osg::DrawElementsUShort(osg::PrimitiveSet::TRIANGLES);
+                triangles->push_back(0);
+                triangles->push_back(1);
+                triangles->push_back(2);
+                mGeometry->addPrimitiveSet(triangles);
+
+                osg::StateSet* const stateSet = mGeometry->getOrCreateStateSet();
+                osg::ref_ptr<osg::Material> material = new osg::Material;
+                material->setDiffuse(osg::Material::FRONT_AND_BACK, osg::Vec4f(0.5f, 0.25f, 1, 1));
+                stateSet->setAttributeAndModes(material, osg::StateAttribute::ON);
+                stateSet->setAttributeAndModes(
+                    new osg::AlphaFunc(osg::AlphaFunc::GREATER, 0.5f), osg::StateAttribute::ON);
+                stateSet->setTextureAttributeAndModes(0, new osg::Texture2D(mImage), osg::StateAttribute::ON);
+                stateSet->setTextureAttributeAndModes(
+                    0, new SceneUtil::TextureType("diffuseMap"), osg::StateAttribute::ON);
+                stateSet->addUniform(new osg::Uniform("emissiveMult", 1.5f));
+                stateSet->setRenderBinDetails(1, "SORT_BACK_TO_FRONT");
+            }
+
+            osg::ref_ptr<osg::Node> roundTrip(const osg::Node& node) const
+            {
+                std::string data;
+                EXPECT_TRUE(serializeScene(node, data));
+                return deserializeScene(data, mGetImage);
+            }
+        };
+
+        TEST_F(ResourceSceneDiskCacheTest, shouldRestoreNodesHierarchy)
+        {
+            const osg::ref_ptr<osg::Node> result = roundTrip(*mScene);
+            ASSERT_NE(result->asGroup(), nullptr);
+            EXPECT_EQ(result->getName(), "root");
+            ASSERT_EQ(result->asGroup()->getNumChildren(), 1);
+            auto* const transform = dynamic_cast<NifOsg::MatrixTransform*>(result->asGroup()->getChild(0));
+            ASSERT_NE(transform, nullptr);
+            EXPECT_EQ(transform->getName(), "Bip01");
+            EXPECT_EQ(transform->getMatrix(), mTransform->getMatrix());
+            EXPECT_EQ(transform->mScale, 2);
+            ASSERT_EQ(transform->getNumChildren(), 1);
+            EXPECT_NE(transform->getChild(0)->asGeometry(), nullptr);
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, shouldRestoreUserValues)
+        {
+            const osg::ref_ptr<osg::Node> result = roundTrip(*mScene);
+            std::string fileHash;
+            EXPECT_TRUE(result->getUserValue("fileHash", fileHash));
+            EXPECT_EQ(fileHash, "hash");
+            ASSERT_NE(result->getUserDataContainer(), nullptr);
+            EXPECT_THAT(result->getUserDataContainer()->getDescriptions(), ElementsAre("NightDaySwitch"));
+            int recIndex = 0;
+            EXPECT_TRUE(result->asGroup()->getChild(0)->getUserValue("recIndex", recIndex));
+            EXPECT_EQ(recIndex, 7);
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, shouldRestoreGeometry)
+        {
+            const osg::ref_ptr<osg::Node> result = roundTrip(*mGeometry);
+            const osg::Geometry* const geometry = result->asGeometry();
+            ASSERT_NE(geometry, nullptr);
+            const auto* const vertices = dynamic_cast<const osg::Vec3Array*>(geometry->getVertexArray());
+            ASSERT_NE(vertices, nullptr);
+            EXPECT_THAT(
+                vertices->asVector(), ElementsAre(osg::Vec3f(0, 0, 0), osg::Vec3f(1, 0, 0), osg::Vec3f(0, 1, 0)));
+            EXPECT_EQ(geometry->getNormalArray(), nullptr);
+            ASSERT_EQ(geometry->getNumTexCoordArrays(), 1);
+            EXPECT_EQ(geometry->getTexCoordArray(0)->getNumElements(), 3);
+            EXPECT_EQ(geometry->getTexCoordArray(0)->getBinding(), osg::Array::BIND_PER_VERTEX);
+            ASSERT_EQ(geometry->getNumPrimitiveSets(), 1);
+            const auto* const triangles = dynamic_cast<const osg::DrawElementsUShort*>(geometry->getPrimitiveSet(0));
+            ASSERT_NE(triangles, nullptr);
+            EXPECT_EQ(triangles->getMode(), osg::PrimitiveSet::TRIANGLES);
+            EXPECT_THAT(triangles->asVector(), ElementsAre(0, 1, 2));
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, shouldRestoreStateSet)
+        {
+            const osg::ref_ptr<osg::Node> result = roundTrip(*mGeometry);
+            const osg::StateSet* const stateSet = result->getStateSet();
+            ASSERT_NE(stateSet, nullptr);
+            EXPECT_EQ(stateSet->compare(*mGeometry->getStateSet(), true), 0);
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, shouldLoadImagesUsingCallback)
+        {
+            const osg::ref_ptr<osg::Node> result = roundTrip(*mGeometry);
+            const auto* const texture = dynamic_cast<const osg::Texture2D*>(
+                result->getStateSet()->getTextureAttribute(0, osg::StateAttribute::TEXTURE));
+            ASSERT_NE(texture, nullptr);
+            EXPECT_EQ(texture->getImage(), mImage.get());
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, shouldShareStateSetsSharedInOriginalScene)
+        {
+            osg::ref_ptr<osg::Geometry> other = new osg::Geometry;
+            other->setStateSet(mGeometry->getStateSet());
+            mTransform->addChild(other);
+            const osg::ref_ptr<osg::Node> result = roundTrip(*mScene);
+            const osg::Group* const transform = result->asGroup()->getChild(0)->asGroup();
+            ASSERT_EQ(transform->getNumChildren(), 2);
+            EXPECT_EQ(transform->getChild(0)->getStateSet(), transform->getChild(1)->getStateSet());
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, serializeSceneShouldReturnFalseForNodesWithCallbacks)
+        {
+            mTransform->addUpdateCallback(new osg::Callback);
+            std::string data;
+            EXPECT_FALSE(serializeScene(*mScene, data));
+            EXPECT_THAT(data, IsEmpty());
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, serializeSceneShouldReturnFalseForImagesNotFromVfs)
+        {
+            mImage->setFileName("");
+            std::string data;
+            EXPECT_FALSE(serializeScene(*mScene, data));
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, deserializeSceneShouldThrowExceptionForTruncatedData)
+        {
+            std::string data;
+            ASSERT_TRUE(serializeScene(*mScene, data));
+            data.pop_back();
+            EXPECT_THROW(deserializeScene(data, mGetImage), std::runtime_error);
+        }
+
+        TEST_F(ResourceSceneDiskCacheTest, readShouldReturnWrittenSceneOnlyForTheSameKey)
+        {
+            const std::filesystem::path directory = TestingOpenMW::outputFilePath("scenediskcache");
+            std::filesystem::remove_all(directory);
+            constexpr VFS::Path::NormalizedView path("meshes/foo.nif");
+            const SceneDiskCacheKey key{ .mFileHash = { 1, 2 }, .mSettings = 3 };
+            SceneDiskCache(directory, 42).write(path, key, *mScene);
+            EXPECT_NE(SceneDiskCache(directory, 42).read(path, key, mGetImage), nullptr);
+            EXPECT_EQ(SceneDiskCache(directory, 13).read(path, key, mGetImage), nullptr);
+            EXPECT_EQ(SceneDiskCache(directory, 42).read(path, SceneDiskCacheKey{ { 1, 3 }, 3 }, mGetImage), nullptr);
+            EXPECT_EQ(SceneDiskCache(directory, 42).read(path, SceneDiskCacheKey{ { 1, 2 }, 4 }, mGetImage), nullptr);
+            EXPECT_EQ(SceneDiskCache(directory, 42).read(VFS::Path::NormalizedView("meshes/bar.nif"), key, mGetImage),
+                nullptr);
+        }
+    }
+}
@@ -0,0 +1,146 @@
+#include <components/sceneutil/lightgrid.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    std::set<std::size_t> getCandidates(const LightGrid& grid, const osg::BoundingSphere& bound)
+    {
+        std::set<std::size_t> result;
+        grid.forEachCandidate(bound, [&](std::size_t index) { result.insert(index); });
+        return result;
+    }
+
+    std::set<std::size_t> getIntersecting(
+        const std::vector<osg::BoundingSphere>& lights, const LightGrid& grid, const osg::BoundingSphere& bound)
+    {
+        std::set<std::size_t> result;
+        grid.forEachCandidate(bound, [&](std::size_t index) {
+            if (lights[index].intersects(bound))
+                result.insert(index);
+        });
+        return result;
+    }
+
+    // Lights along X axis far enough to be placed into different clusters
+    std::vector<osg::BoundingSphere> makeLightsRow(std::size_t count)
+    {
+        std::vector<osg::BoundingSphere> result;
+        for (std::size_t i = 0; i < count; ++i)
+            result.emplace_back(osg::Vec3f(static_cast<float>(i) * 1000, 0, 0), 10);
+        return result;
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateOnEmptyShouldNotCallFunction)
+    {
+        LightGrid grid;
+        grid.build({});
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(0, 0, 0), 1000)), IsEmpty());
+        EXPECT_EQ(grid.getCellCount(), 0);
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldReturnAllLightsWhenThereAreFew)
+    {
+        LightGrid grid;
+        grid.build(makeLightsRow(3));
+        EXPECT_EQ(grid.getCellCount(), 1);
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(0, 0, 0), 1)), ElementsAre(0, 1, 2));
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldReturnLightsFromOverlappingClusters)
+    {
+        const std::vector<osg::BoundingSphere> lights = makeLightsRow(64);
+        LightGrid grid;
+        grid.build(lights);
+        EXPECT_GT(grid.getCellCount(), 1);
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(5, 5, 0), 1)), Contains(0));
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(5, 5, 0), 1)), Not(Contains(63)));
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(63000, 0, 0), 1)), Contains(63));
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(63000, 0, 0), 1)), Not(Contains(0)));
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldReturnEachLightOnceInAscendingOrder)
+    {
+        std::vector<osg::BoundingSphere> lights = makeLightsRow(64);
+        lights[10].radius() = 20000;
+        LightGrid grid;
+        grid.build(lights);
+        std::vector<std::size_t> candidates;
+        grid.forEachCandidate(osg::BoundingSphere(osg::Vec3f(12000, 0, 0), 3000),
+            [&](std::size_t index) { candidates.push_back(index); });
+        EXPECT_THAT(candidates, Contains(10));
+        EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+        EXPECT_EQ(std::adjacent_find(candidates.begin(), candidates.end()), candidates.end());
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldNotCallFunctionForBoundOutsideOfGrid)
+    {
+        LightGrid grid;
+        grid.build(makeLightsRow(64));
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(0, 0, 100), 10)), IsEmpty());
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(-100, 0, 0), 10)), IsEmpty());
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldReturnAllLightsForBoundCoveringGrid)
+    {
+        LightGrid grid;
+        grid.build(makeLightsRow(64));
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(0, 0, 0), 1e6f)), SizeIs(64));
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldIgnoreInvalidBounds)
+    {
+        const std::vector<osg::BoundingSphere> lights{
+            osg::BoundingSphere(osg::Vec3f(0, 0, 0), 10),
+            osg::BoundingSphere(),
+            osg::BoundingSphere(osg::Vec3f(0, 0, 0), 0),
+        };
+        LightGrid grid;
+        grid.build(lights);
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere(osg::Vec3f(0, 0, 0), 1)), ElementsAre(0, 2));
+        EXPECT_THAT(getCandidates(grid, osg::BoundingSphere()), IsEmpty());
+    }
+
+    TEST(SceneUtilLightGridTest, forEachCandidateShouldReturnSameIntersectingLightsAsLinearSearch)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> position(-2000, 2000);
+        std::uniform_real_distribution<float> radius(50, 500);
+        std::vector<osg::BoundingSphere> lights;
+        for (std::size_t i = 0; i < 200; ++i)
+            lights.emplace_back(osg::Vec3f(position(random), position(random), position(random)), radius(random));
+        LightGrid grid;
+        grid.build(lights);
+        EXPECT_GT(grid.getCellCount(), 1);
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            const osg::BoundingSphere bound(
+                osg::Vec3f(position(random), position(random), position(random)), radius(random));
+            std::set<std::size_t> expected;
+            for (std::size_t j = 0; j < lights.size(); ++j)
+                if (lights[j].intersects(bound))
+                    expected.insert(j);
+            EXPECT_EQ(getIntersecting(lights, grid, bound), expected);
+        }
+    }
+
+    TEST(SceneUtilLightGridTest, buildShouldReplaceContent)
+    {
+        LightGrid grid;
+        grid.build(std::vector<osg::BoundingSphere>{ osg::BoundingSphere(osg::Vec3f(0, 0, 0), 10) });
+        const std::vector<osg::BoundingSphere> lights{ osg::BoundingSphere(osg::Vec3f(100, 0, 0), 10) };
+        grid.build(lights);
+        EXPECT_THAT(getIntersecting(lights, grid, osg::BoundingSphere(osg::Vec3f(0, 0, 0), 1)), IsEmpty());
+        EXPECT_THAT(getIntersecting(lights, grid, osg::BoundingSphere(osg::Vec3f(100, 0, 0), 1)), ElementsAre(0));
+    }
+}
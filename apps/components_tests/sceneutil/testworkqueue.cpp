@@ -0,0 +1,117 @@
+#include <components/sceneutil/workqueue.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    struct CountItem final : WorkItem
+    {
+        std::atomic<int>& mCounter;
+
+        explicit CountItem(std::atomic<int>& counter)
+            : mCounter(counter)
+        {
+        }
+
+        void doWork() override { ++mCounter; }
+    };
+
+    struct BlockItem final : WorkItem
+    {
+        std::shared_future<void> mUnblock;
+
+        explicit BlockItem(std::shared_future<void> unblock)
+            : mUnblock(std::move(unblock))
+        {
+        }
+
+        void doWork() override { mUnblock.wait(); }
+    };
+
+    struct RecordItem final : WorkItem
+    {
+        std::string mName;
+        std::mutex& mMutex;
+        std::vector<std::string>& mNames;
+
+        explicit RecordItem(std::string name, std::mutex& mutex, std::vector<std::string>& names)
+            : mName(std::move(name))
+            , mMutex(mutex)
+            , mNames(names)
+        {
+        }
+
+        void doWork() override
+        {
+            const std::lock_guard lock(mMutex);
+            mNames.push_back(mName);
+        }
+    };
+
+    TEST(SceneUtilWorkQueueTest, shouldProcessAllItems)
+    {
+        std::atomic<int> counter{ 0 };
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(4));
+        std::vector<osg::ref_ptr<WorkItem>> items;
+        for (int i = 0; i < 100; ++i)
+        {
+            items.emplace_back(new CountItem(counter));
+            queue->addWorkItem(items.back());
+        }
+        for (const osg::ref_ptr<WorkItem>& item : items)
+            item->waitTillDone();
+        EXPECT_EQ(counter, 100);
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldProcessItemsWithHigherPriorityFirst)
+    {
+        std::promise<void> unblock;
+        std::mutex mutex;
+        std::vector<std::string> names;
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(1));
+        osg::ref_ptr<WorkItem> block(new BlockItem(unblock.get_future().share()));
+        queue->addWorkItem(block);
+        while (queue->getNumItems() != 0)
+            std::this_thread::yield();
+        osg::ref_ptr<WorkItem> low(new RecordItem("low", mutex, names));
+        osg::ref_ptr<WorkItem> normal(new RecordItem("normal", mutex, names));
+        osg::ref_ptr<WorkItem> high(new RecordItem("high", mutex, names));
+        queue->addWorkItem(low, WorkPriority::Low);
+        queue->addWorkItem(normal, WorkPriority::Normal);
+        queue->addWorkItem(high, WorkPriority::High);
+        unblock.set_value();
+        low->waitTillDone();
+        normal->waitTillDone();
+        high->waitTillDone();
+        EXPECT_THAT(names, ElementsAre("high", "normal", "low"));
+    }
+
+    TEST(SceneUtilWorkQueueTest, shouldSkipCancelledItems)
+    {
+        std::promise<void> unblock;
+        std::atomic<int> counter{ 0 };
+        osg::ref_ptr<WorkQueue> queue(new WorkQueue(1));
+        osg::ref_ptr<WorkItem> block(new BlockItem(unblock.get_future().share()));
+        queue->addWorkItem(block);
+        osg::ref_ptr<WorkItem> cancelled(new CountItem(counter));
+        osg::ref_ptr<WorkItem> item(new CountItem(counter));
+        queue->addWorkItem(cancelled);
+        queue->addWorkItem(item);
+        cancelled->cancel();
+        unblock.set_value();
+        cancelled->waitTillDone();
+        item->waitTillDone();
+        EXPECT_TRUE(cancelled->isCancelled());
+        EXPECT_EQ(counter, 1);
+    }
+}
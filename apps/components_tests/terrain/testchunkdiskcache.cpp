@@ -0,0 +1,204 @@
+#include <components/terrain/chunkdiskcache.hpp>
+#include <components/testing/util.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <osg/Image>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Terrain
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        std::vector<unsigned char> getImageData(const osg::Image& image)
+        {
+            return std::vector<unsigned char>(image.data(), image.data() + image.getTotalDataSize());
+        }
+
+        std::size_t countFiles(const std::filesystem::path& directory)
+        {
+            std::size_t result = 0;
+            for (const auto& entry : std::filesystem::directory_iterator(directory))
+                if (entry.is_regular_file())
+                    ++result;
+            return result;
+        }
+
+        struct TerrainChunkDiskCacheTest : Test
+        {
+            const std::filesystem::path mDirectory = TestingOpenMW::outputFilePath("chunkdiskcache");
+            const ChunkDiskCacheKey mKey{
+                .mWorldspace = ESM::RefId::stringRefId("worldspace"),
+                .mSize = 0.5f,
+                .mCenter = osg::Vec2f(1.25f, -0.75f),
+                .mDataHash = { 1, 2 },
+            };
+            osg::ref_ptr<osg::Vec3Array> mPositions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> mNormals = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec4ubArray> mColours = new osg::Vec4ubArray;
+            Storage::ImageVector mBlendmaps;
+            std::vector<LayerInfo> mLayers;
+
+            TerrainChunkDiskCacheTest()
+            {
+                std::filesystem::remove_all(mDirectory);
+
+                mPositions->push_back(osg::Vec3f(1, 2, 3));
+                mPositions->push_back(osg::Vec3f(4, 5, 6));
+                mNormals->push_back(osg::Vec3f(0, 0, 1));
+                mNormals->push_back(osg::Vec3f(0, 1, 0));
+                mColours->push_back(osg::Vec4ub(1, 2, 3, 255));
+                mColours->push_back(osg::Vec4ub(4, 5, 6, 255));
+
+                for (int i = 0; i < 2; ++i)
+                {
+                    osg::ref_ptr<osg::Image> image = new osg::Image;
+                    image->allocateImage(4, 4, 1, GL_ALPHA, GL_UNSIGNED_BYTE);
+                    for (unsigned j = 0; j < image->getTotalDataSize(); ++j)
+                        image->data()[j] = static_cast<unsigned char>(i * 128 + j);
+                    mBlendmaps.push_back(std::move(image));
+                }
+
+                mLayers.push_back(LayerInfo{
+                    .mDiffuseMap = "textures/a.dds",
+                    .mNormalMap = "textures/a_nh.dds",
+                    .mParallax = true,
+                    .mSpecular = false,
+                });
+                mLayers.push_back(LayerInfo{
+                    .mDiffuseMap = "textures/b_spec.dds",
+                    .mNormalMap = "",
+                    .mParallax = false,
+                    .mSpecular = true,
+                });
+            }
+        };
+
+        TEST_F(TerrainChunkDiskCacheTest, readVertexBuffersShouldReturnWrittenData)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            cache.writeVertexBuffers(mKey, 3, *mPositions, *mNormals, *mColours);
+            osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+            ASSERT_TRUE(cache.readVertexBuffers(mKey, 3, *positions, *normals, *colours));
+            EXPECT_EQ(positions->asVector(), mPositions->asVector());
+            EXPECT_EQ(normals->asVector(), mNormals->asVector());
+            EXPECT_EQ(colours->asVector(), mColours->asVector());
+        }
+
+        TEST_F(TerrainChunkDiskCacheTest, readVertexBuffersShouldReturnFalseForDifferentKey)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            cache.writeVertexBuffers(mKey, 3, *mPositions, *mNormals, *mColours);
+            osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+            EXPECT_FALSE(cache.readVertexBuffers(mKey, 2, *positions, *normals, *colours));
+            ChunkDiskCacheKey key = mKey;
+            key.mWorldspace = ESM::RefId::stringRefId("other");
+            EXPECT_FALSE(cache.readVertexBuffers(key, 3, *positions, *normals, *colours));
+            key = mKey;
+            key.mSize = 1;
+            EXPECT_FALSE(cache.readVertexBuffers(key, 3, *positions, *normals, *colours));
+            key = mKey;
+            key.mCenter = osg::Vec2f(1.25f, 0.75f);
+            EXPECT_FALSE(cache.readVertexBuffers(key, 3, *positions, *normals, *colours));
+            key = mKey;
+            key.mDataHash = { 1, 3 };
+            EXPECT_FALSE(cache.readVertexBuffers(key, 3, *positions, *normals, *colours));
+            EXPECT_THAT(positions->asVector(), IsEmpty());
+        }
+
+        TEST_F(TerrainChunkDiskCacheTest, writeVertexBuffersShouldReplaceEntryWithDifferentDataHash)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            cache.writeVertexBuffers(mKey, 3, *mPositions, *mNormals, *mColours);
+            ChunkDiskCacheKey key = mKey;
+            key.mDataHash = { 3, 4 };
+            cache.writeVertexBuffers(key, 3, *mPositions, *mNormals, *mColours);
+            EXPECT_EQ(countFiles(mDirectory), 1);
+            osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+            EXPECT_TRUE(cache.readVertexBuffers(key, 3, *positions, *normals, *colours));
+            EXPECT_FALSE(cache.readVertexBuffers(mKey, 3, *positions, *normals, *colours));
+        }
+
+        TEST_F(TerrainChunkDiskCacheTest, readVertexBuffersShouldReturnFalseForCorruptedEntry)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            cache.writeVertexBuffers(mKey, 3, *mPositions, *mNormals, *mColours);
+            ASSERT_EQ(countFiles(mDirectory), 1);
+            const std::filesystem::path file = std::filesystem::directory_iterator(mDirectory)->path();
+            std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+            osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+            EXPECT_FALSE(cache.readVertexBuffers(mKey, 3, *positions, *normals, *colours));
+            EXPECT_THAT(positions->asVector(), IsEmpty());
+            EXPECT_THAT(normals->asVector(), IsEmpty());
+            EXPECT_THAT(colours->asVector(), IsEmpty());
+        }
+
+        TEST_F(TerrainChunkDiskCacheTest, readBlendmapsShouldReturnWrittenData)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            cache.writeBlendmaps(mKey, mBlendmaps, mLayers);
+            Storage::ImageVector blendmaps;
+            std::vector<LayerInfo> layers;
+            ASSERT_TRUE(cache.readBlendmaps(mKey, blendmaps, layers));
+            ASSERT_EQ(blendmaps.size(), 2);
+            for (std::size_t i = 0; i < blendmaps.size(); ++i)
+            {
+                EXPECT_EQ(blendmaps[i]->s(), 4);
+                EXPECT_EQ(blendmaps[i]->t(), 4);
+                EXPECT_EQ(blendmaps[i]->getPixelFormat(), static_cast<GLenum>(GL_ALPHA));
+                EXPECT_EQ(blendmaps[i]->getDataType(), static_cast<GLenum>(GL_UNSIGNED_BYTE));
+                EXPECT_EQ(getImageData(*blendmaps[i]), getImageData(*mBlendmaps[i]));
+            }
+            ASSERT_EQ(layers.size(), 2);
+            for (std::size_t i = 0; i < layers.size(); ++i)
+            {
+                EXPECT_EQ(layers[i].mDiffuseMap, mLayers[i].mDiffuseMap);
+                EXPECT_EQ(layers[i].mNormalMap, mLayers[i].mNormalMap);
+                EXPECT_EQ(layers[i].mParallax, mLayers[i].mParallax);
+                EXPECT_EQ(layers[i].mSpecular, mLayers[i].mSpecular);
+            }
+        }
+
+        TEST_F(TerrainChunkDiskCacheTest, readBlendmapsShouldReturnSingleLayerWithoutBlendmaps)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            mLayers.resize(1);
+            cache.writeBlendmaps(mKey, {}, mLayers);
+            Storage::ImageVector blendmaps;
+            std::vector<LayerInfo> layers;
+            ASSERT_TRUE(cache.readBlendmaps(mKey, blendmaps, layers));
+            EXPECT_THAT(blendmaps, IsEmpty());
+            ASSERT_EQ(layers.size(), 1);
+            EXPECT_EQ(layers[0].mDiffuseMap, "textures/a.dds");
+        }
+
+        TEST_F(TerrainChunkDiskCacheTest, vertexBuffersAndBlendmapsShouldBeStoredSeparately)
+        {
+            const ChunkDiskCache cache(mDirectory);
+            cache.writeVertexBuffers(mKey, 0, *mPositions, *mNormals, *mColours);
+            Storage::ImageVector blendmaps;
+            std::vector<LayerInfo> layers;
+            EXPECT_FALSE(cache.readBlendmaps(mKey, blendmaps, layers));
+            cache.writeBlendmaps(mKey, mBlendmaps, mLayers);
+            EXPECT_TRUE(cache.readBlendmaps(mKey, blendmaps, layers));
+            osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+            EXPECT_TRUE(cache.readVertexBuffers(mKey, 0, *positions, *normals, *colours));
+        }
+    }
+}
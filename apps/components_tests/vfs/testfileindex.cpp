@@ -0,0 +1,75 @@
+#include <components/vfs/fileindex.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace VFS
+{
+    namespace
+    {
+        using namespace testing;
+
+        File* makeFile(std::size_t value)
+        {
+            return reinterpret_cast<File*>(value);
+        }
+
+        TEST(VFSFileIndexTest, findShouldReturnNullptrForEmptyIndex)
+        {
+            const FileIndex index;
+            EXPECT_EQ(index.find("foo/bar"), nullptr);
+        }
+
+        TEST(VFSFileIndexTest, findShouldReturnEntryForPresentPath)
+        {
+            const FileMap files{ { Path::Normalized("foo/bar"), makeFile(1) },
+                { Path::Normalized("foo/baz"), makeFile(2) } };
+            FileIndex index;
+            index.build(files);
+            const FileIndex::Entry* const entry = index.find("foo/baz");
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(entry->first, "foo/baz");
+            EXPECT_EQ(entry->second, makeFile(2));
+        }
+
+        TEST(VFSFileIndexTest, findShouldReturnNullptrForAbsentPath)
+        {
+            const FileMap files{ { Path::Normalized("foo/bar"), makeFile(1) } };
+            FileIndex index;
+            index.build(files);
+            EXPECT_EQ(index.find("foo/baz"), nullptr);
+            EXPECT_EQ(index.find("foo"), nullptr);
+            EXPECT_EQ(index.find(""), nullptr);
+        }
+
+        TEST(VFSFileIndexTest, findShouldReturnEveryEntryFromLargeMap)
+        {
+            FileMap files;
+            for (std::size_t i = 0; i < 10000; ++i)
+                files.emplace(Path::Normalized("meshes/" + std::to_string(i) + ".nif"), makeFile(i + 1));
+            FileIndex index;
+            index.build(files);
+            EXPECT_EQ(index.size(), files.size());
+            EXPECT_GE(index.capacity(), 2 * files.size());
+            for (const auto& [path, file] : files)
+            {
+                const FileIndex::Entry* const entry = index.find(path.view());
+                ASSERT_NE(entry, nullptr) << path;
+                EXPECT_EQ(entry->second, file);
+            }
+            EXPECT_EQ(index.find("meshes/10000.nif"), nullptr);
+        }
+
+        TEST(VFSFileIndexTest, clearShouldRemoveAllEntries)
+        {
+            const FileMap files{ { Path::Normalized("foo/bar"), makeFile(1) } };
+            FileIndex index;
+            index.build(files);
+            index.clear();
+            EXPECT_EQ(index.size(), 0);
+            EXPECT_EQ(index.find("foo/bar"), nullptr);
+        }
+    }
+}
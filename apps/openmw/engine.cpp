@@ -23,6 +23,7 @@
 #include <components/sdlutil/sdlgraphicswindow.hpp>
 
 #include <components/resource/resourcesystem.hpp>
+#include <components/resource/scenediskcache.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/resource/stats.hpp>
 
@@ -54,6 +55,8 @@
 #include <components/settings/shadermanager.hpp>
 #include <components/settings/values.hpp>
 
+#include <components/terrain/chunkdiskcache.hpp>
+
 #include "mwinput/inputmanagerimp.hpp"
 
 #include "mwgui/windowmanagerimp.hpp"
@@ -274,7 +277,7 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
 
             if (mStateManager->getState() != MWBase::StateManager::State_NoGame)
             {
-                mMechanicsManager->update(frametime, paused);
+                mMechanicsManager->update(frametime, paused, frameStart, frameNumber, *stats);
             }
 
             if (mStateManager->getState() == MWBase::StateManager::State_Running)
@@ -329,8 +332,7 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
 
         mResourceSystem->reportStats(frameNumber, stats);
 
-        stats->setAttribute(frameNumber, "WorkQueue", mWorkQueue->getNumItems());
-        stats->setAttribute(frameNumber, "WorkThread", mWorkQueue->getNumActiveThreads());
+        mWorkQueue->reportStats(frameNumber, *stats);
 
         mMechanicsManager->reportStats(frameNumber, *stats);
         mWorld->reportStats(frameNumber, *stats);
@@ -730,11 +732,25 @@ void OMW::Engine::prepareEngine()
 
     mResourceSystem = std::make_unique<Resource::ResourceSystem>(
         mVFS.get(), Settings::cells().mCacheExpiryDelay, &mEncoder.get()->getStatelessEncoder());
+    if (const int memoryBudget = Settings::cells().mCacheMemoryBudget; memoryBudget > 0)
+        mResourceSystem->setMemoryBudget(static_cast<std::size_t>(memoryBudget) * 1024 * 1024);
     mResourceSystem->getSceneManager()->getShaderManager().setMaxTextureUnits(mGlMaxTextureImageUnits);
     mResourceSystem->getSceneManager()->setUnRefImageDataAfterApply(
         false); // keep to Off for now to allow better state sharing
     mResourceSystem->getSceneManager()->setFilterSettings(Settings::general().mTextureMagFilter,
         Settings::general().mTextureMinFilter, Settings::general().mTextureMipmap, Settings::general().mAnisotropy);
+    if (Settings::models().mSceneDiskCache)
+    {
+        try
+        {
+            mResourceSystem->getSceneManager()->setDiskCache(std::make_unique<Resource::SceneDiskCache>(
+                mCfgMgr.getCachePath() / "scenes", Resource::makeSceneDiskCacheKey(*mVFS)));
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to create scene disk cache: " << e.what();
+        }
+    }
     mEnvironment.setResourceSystem(*mResourceSystem);
 
     mWorkQueue = new SceneUtil::WorkQueue(Settings::cells().mPreloadNumThreads);
@@ -817,12 +833,12 @@ void OMW::Engine::prepareEngine()
     mEnvironment.setInputManager(*mInputManager);
 
     // Create sound system
-    mSoundManager = std::make_unique<MWSound::SoundManager>(mVFS.get(), mUseSound);
+    mSoundManager = std::make_unique<MWSound::SoundManager>(mVFS.get(), mUseSound, mWorkQueue.get());
     mEnvironment.setSoundManager(*mSoundManager);
 
     // Create the world
-    mWorld = std::make_unique<MWWorld::World>(
-        mResourceSystem.get(), mActivationDistanceOverride, mCellName, mCfgMgr.getUserDataPath());
+    mWorld = std::make_unique<MWWorld::World>(mResourceSystem.get(), mActivationDistanceOverride, mCellName,
+        mCfgMgr.getUserDataPath(), mCfgMgr.getCachePath());
     mEnvironment.setWorld(*mWorld);
     mEnvironment.setWorldModel(mWorld->getWorldModel());
     mEnvironment.setESMStore(mWorld->getStore());
@@ -848,7 +864,20 @@ void OMW::Engine::prepareEngine()
     }
     listener->loadingOff();
 
-    mWorld->init(mViewer, std::move(rootNode), mWorkQueue.get(), *mUnrefQueue);
+    std::shared_ptr<const Terrain::ChunkDiskCache> terrainDiskCache;
+    if (Settings::terrain().mChunkDiskCache)
+    {
+        try
+        {
+            terrainDiskCache = std::make_shared<Terrain::ChunkDiskCache>(mCfgMgr.getCachePath() / "terrain");
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to create terrain chunk disk cache: " << e.what();
+        }
+    }
+
+    mWorld->init(mViewer, std::move(rootNode), mWorkQueue.get(), *mUnrefQueue, std::move(terrainDiskCache));
     mEnvironment.setWorldScene(mWorld->getWorldScene());
     mWorld->setupPlayer();
     mWorld->setRandomSeed(mRandomSeed);
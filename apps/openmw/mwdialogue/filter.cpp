@@ -77,6 +77,20 @@ namespace
         }
         return true;
     }
+
+    // Visits only the infos the speaker could match according to the index built after loading
+    template <class Function>
+    void forEachInfo(
+        const ESM::Dialogue& dialogue, const MWDialogue::InfoIndex::Speaker& speaker, Function&& function)
+    {
+        const MWDialogue::InfoIndex* index
+            = MWBase::Environment::get().getESMStore()->get<ESM::Dialogue>().getInfoIndex(dialogue);
+        if (index != nullptr)
+            return index->forEachCandidate(speaker, function);
+        for (const ESM::DialInfo& info : dialogue.mInfo)
+            if (!function(info))
+                return;
+    }
 }
 
 bool MWDialogue::Filter::testActor(const ESM::DialInfo& info) const
@@ -731,6 +745,22 @@ bool MWDialogue::Filter::couldPotentiallyMatch(const ESM::DialInfo& info) const
     return testActor(info) && matchesStaticFilters(info, mActor);
 }
 
+MWDialogue::InfoIndex::Speaker MWDialogue::Filter::getSpeaker() const
+{
+    InfoIndex::Speaker speaker;
+    speaker.mId = mActor.getCellRef().getRefId();
+    speaker.mIsNpc = mActor.getType() == ESM::NPC::sRecordId;
+    if (speaker.mIsNpc)
+    {
+        const MWWorld::LiveCellRef<ESM::NPC>* cellRef = mActor.get<ESM::NPC>();
+        speaker.mRace = cellRef->mBase->mRace;
+        speaker.mClass = cellRef->mBase->mClass;
+        speaker.mFaction = mActor.getClass().getPrimaryFaction(mActor);
+        speaker.mCell = MWBase::Environment::get().getWorld()->getCellName(MWMechanics::getPlayer().getCell());
+    }
+    return speaker;
+}
+
 std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
     const ESM::Dialogue& dialogue, bool fallbackToInfoRefusal, bool searchAll, bool invertDisposition) const
 {
@@ -738,21 +768,23 @@ std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
 
     bool infoRefusal = false;
 
+    const InfoIndex::Speaker speaker = getSpeaker();
+
     // Iterate over topic responses to find a matching one
-    for (const auto& info : dialogue.mInfo)
-    {
+    forEachInfo(dialogue, speaker, [&](const ESM::DialInfo& info) {
         if (testActor(info) && testPlayer(info) && testSelectStructs(info))
         {
             if (testDisposition(info, invertDisposition))
             {
                 infos.emplace_back(&dialogue, &info);
                 if (!searchAll)
-                    break;
+                    return false;
             }
             else
                 infoRefusal = true;
         }
-    }
+        return true;
+    });
 
     if (infos.empty() && infoRefusal && fallbackToInfoRefusal)
     {
@@ -763,14 +795,16 @@ std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
 
         const ESM::Dialogue& infoRefusalDialogue = *dialogues.find(ESM::RefId::stringRefId("Info Refusal"));
 
-        for (const auto& info : infoRefusalDialogue.mInfo)
+        forEachInfo(infoRefusalDialogue, speaker, [&](const ESM::DialInfo& info) {
             if (testActor(info) && testPlayer(info) && testSelectStructs(info)
                 && testDisposition(info, invertDisposition))
             {
                 infos.emplace_back(&infoRefusalDialogue, &info);
                 if (!searchAll)
-                    break;
+                    return false;
             }
+            return true;
+        });
     }
 
     return infos;
@@ -6,6 +6,8 @@
 
 #include "../mwworld/ptr.hpp"
 
+#include "infoindex.hpp"
+
 namespace ESM
 {
     struct DialInfo;
@@ -52,6 +54,8 @@ namespace MWDialogue
         bool hasFactionRankReputationRequirements(
             const MWWorld::Ptr& actor, const ESM::RefId& factionId, int rank) const;
 
+        InfoIndex::Speaker getSpeaker() const;
+
     public:
         using Response = std::pair<const ESM::Dialogue*, const ESM::DialInfo*>;
 
@@ -0,0 +1,73 @@
+#include "infoindex.hpp"
+
+#include <components/esm3/loaddial.hpp>
+#include <components/misc/strings/algorithm.hpp>
+
+#include <algorithm>
+
+namespace MWDialogue
+{
+    namespace
+    {
+        void addBucket(const std::unordered_map<ESM::RefId, std::vector<std::uint32_t>>& buckets,
+            const ESM::RefId& key, std::vector<std::span<const std::uint32_t>>& result)
+        {
+            if (key.empty())
+                return;
+            const auto it = buckets.find(key);
+            if (it != buckets.end())
+                result.emplace_back(it->second);
+        }
+    }
+
+    InfoIndex::InfoIndex(const ESM::Dialogue& dialogue)
+        : mDialogue(&dialogue)
+    {
+        mInfos.reserve(dialogue.mInfo.size());
+        for (const ESM::DialInfo& info : dialogue.mInfo)
+        {
+            const std::uint32_t position = static_cast<std::uint32_t>(mInfos.size());
+            mInfos.push_back(&info);
+
+            if (!info.mActor.empty())
+                mActors[info.mActor].push_back(position);
+            else if (!info.mRace.empty())
+                mRaces[info.mRace].push_back(position);
+            else if (!info.mClass.empty())
+                mClasses[info.mClass].push_back(position);
+            else if (!info.mFactionLess && !info.mFaction.empty())
+                mFactions[info.mFaction].push_back(position);
+            else if (!info.mCell.empty())
+            {
+                const auto it = std::find_if(
+                    mCells.begin(), mCells.end(), [&](const auto& v) { return v.first == info.mCell; });
+                if (it == mCells.end())
+                    mCells.emplace_back(info.mCell, std::vector<std::uint32_t>{ position });
+                else
+                    it->second.push_back(position);
+            }
+            else
+                mOther.push_back(position);
+        }
+    }
+
+    void InfoIndex::getBuckets(const Speaker& speaker, std::vector<std::span<const std::uint32_t>>& buckets) const
+    {
+        addBucket(mActors, speaker.mId, buckets);
+
+        // Creatures must not have topics aside of those specific to their id
+        if (!speaker.mIsNpc)
+            return;
+
+        addBucket(mRaces, speaker.mRace, buckets);
+        addBucket(mClasses, speaker.mClass, buckets);
+        addBucket(mFactions, speaker.mFaction, buckets);
+
+        for (const auto& [cell, positions] : mCells)
+            if (Misc::StringUtils::ciStartsWith(speaker.mCell, cell.getRefIdString()))
+                buckets.emplace_back(positions);
+
+        if (!mOther.empty())
+            buckets.emplace_back(mOther);
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef GAME_MWDIALOGUE_INFOINDEX_H
+#define GAME_MWDIALOGUE_INFOINDEX_H
+
+#include <components/esm/refid.hpp>
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ESM
+{
+    struct DialInfo;
+    struct Dialogue;
+}
+
+namespace MWDialogue
+{
+    /// \brief Groups infos of a dialogue by speaker attributes
+    ///
+    /// Each info is stored in a single bucket selected by the first of actor id, race, class, faction and cell it
+    /// requires. An info can pass Filter::testActor and Filter::testPlayer only when the speaker matches that
+    /// requirement, so the other buckets are skipped without checking their infos. Built once after the content
+    /// files are loaded, infos must stay at the same address.
+    class InfoIndex
+    {
+    public:
+        /// Speaker attributes used to select buckets
+        struct Speaker
+        {
+            ESM::RefId mId;
+            bool mIsNpc = false;
+            ESM::RefId mRace;
+            ESM::RefId mClass;
+            ESM::RefId mFaction;
+            /// Name of the cell the player is in
+            std::string_view mCell;
+        };
+
+        explicit InfoIndex(const ESM::Dialogue& dialogue);
+
+        const ESM::Dialogue& getDialogue() const { return *mDialogue; }
+
+        /// Calls function for each info which could be said by the speaker in the dialogue order until it returns
+        /// false. Infos still have to be checked with all filters.
+        template <class Function>
+        void forEachCandidate(const Speaker& speaker, Function&& function) const
+        {
+            std::vector<std::span<const std::uint32_t>> buckets;
+            getBuckets(speaker, buckets);
+
+            // Buckets are sorted by info position, merging them restores the dialogue order
+            while (true)
+            {
+                std::span<const std::uint32_t>* next = nullptr;
+                for (std::span<const std::uint32_t>& bucket : buckets)
+                    if (!bucket.empty() && (next == nullptr || bucket.front() < next->front()))
+                        next = &bucket;
+                if (next == nullptr)
+                    return;
+                const std::uint32_t position = next->front();
+                *next = next->subspan(1);
+                if (!function(*mInfos[position]))
+                    return;
+            }
+        }
+
+    private:
+        using Buckets = std::unordered_map<ESM::RefId, std::vector<std::uint32_t>>;
+
+        const ESM::Dialogue* mDialogue;
+        std::vector<const ESM::DialInfo*> mInfos;
+        Buckets mActors;
+        Buckets mRaces;
+        Buckets mClasses;
+        Buckets mFactions;
+        // Cell requirement is a prefix of the player cell name, so each one is checked
+        std::vector<std::pair<ESM::RefId, std::vector<std::uint32_t>>> mCells;
+        // Infos without any of the requirements above
+        std::vector<std::uint32_t> mOther;
+
+        void getBuckets(const Speaker& speaker, std::vector<std::span<const std::uint32_t>>& buckets) const;
+    };
+}
+
+#endif
@@ -254,6 +254,14 @@ namespace MWGui
         draw();
     }
 
+    void LoadingScreen::reportTime(
+        std::string_view item, std::string_view stage, std::chrono::steady_clock::duration time)
+    {
+        Log(Debug::Verbose) << item << " " << stage << " time: "
+                            << std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(time).count()
+                            << " ms";
+    }
+
     bool LoadingScreen::needToDrawLoadingScreen()
     {
         if (mTimer.time_m() <= mLastRenderTime + (1.0 / getTargetFrameRate()) * 1000.0)
@@ -43,6 +43,8 @@ namespace MWGui
         void setProgressRange(size_t range) override;
         void setProgress(size_t value) override;
         void increaseProgress(size_t increase = 1) override;
+        void reportTime(
+            std::string_view item, std::string_view stage, std::chrono::steady_clock::duration time) override;
 
         void setVisible(bool visible) override;
 
@@ -1,7 +1,10 @@
 #include "actors.hpp"
 
 #include <array>
+#include <limits>
 #include <optional>
+#include <ranges>
+#include <span>
 
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/esmwriter.hpp>
@@ -10,6 +13,7 @@
 #include <components/misc/mathutil.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/rng.hpp>
+#include <components/misc/workerpool.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/settings/values.hpp>
 
@@ -41,6 +45,8 @@
 
 #include "../mwsound/constants.hpp"
 
+#include "../profile.hpp"
+
 #include "actor.hpp"
 #include "actorutil.hpp"
 #include "aicombataction.hpp"
@@ -118,7 +124,7 @@ namespace
 
     template <class T>
     void forEachFollowingPackage(
-        const std::list<MWMechanics::Actor>& actors, const MWWorld::Ptr& actorPtr, const MWWorld::Ptr& player, T&& func)
+        const MWMechanics::ActorTable& actors, const MWWorld::Ptr& actorPtr, const MWWorld::Ptr& player, T&& func)
     {
         for (const MWMechanics::Actor& actor : actors)
         {
@@ -265,19 +271,8 @@ namespace MWMechanics
             return (distanceToNextPathPoint - package.getNextPathPointTolerance(speed, duration, halfExtents)) / speed;
         }
 
-        void updateHeadTracking(const MWWorld::Ptr& actor, const MWWorld::Ptr& targetActor,
-            MWWorld::Ptr& headTrackTarget, float& sqrHeadTrackDistance, bool inCombatOrPursue)
+        float getMaxHeadTrackDistance(const MWWorld::Ptr& actor)
         {
-            const auto& actorRefData = actor.getRefData();
-            if (!actorRefData.getBaseNode())
-                return;
-
-            if (targetActor.getClass().getCreatureStats(targetActor).isDead())
-                return;
-
-            if (isTargetMagicallyHidden(targetActor))
-                return;
-
             static const float fMaxHeadTrackDistance = MWBase::Environment::get()
                                                            .getESMStore()
                                                            ->get<ESM::GameSetting>()
@@ -292,6 +287,23 @@ namespace MWMechanics
             auto currentCell = actor.getCell()->getCell();
             if (!currentCell->isExterior() && !(currentCell->isQuasiExterior()))
                 maxDistance *= fInteriorHeadTrackMult;
+            return maxDistance;
+        }
+
+        void updateHeadTracking(const MWWorld::Ptr& actor, const MWWorld::Ptr& targetActor,
+            MWWorld::Ptr& headTrackTarget, float& sqrHeadTrackDistance, bool inCombatOrPursue)
+        {
+            const auto& actorRefData = actor.getRefData();
+            if (!actorRefData.getBaseNode())
+                return;
+
+            if (targetActor.getClass().getCreatureStats(targetActor).isDead())
+                return;
+
+            if (isTargetMagicallyHidden(targetActor))
+                return;
+
+            const float maxDistance = getMaxHeadTrackDistance(actor);
 
             const osg::Vec3f actor1Pos(actorRefData.getPosition().asVec3());
             const osg::Vec3f actor2Pos(targetActor.getRefData().getPosition().asVec3());
@@ -315,46 +327,27 @@ namespace MWMechanics
             }
         }
 
-        void updateHeadTracking(
-            const MWWorld::Ptr& ptr, const std::list<Actor>& actors, bool isPlayer, CharacterController& ctrl)
+        enum class HeadTracking
         {
-            float sqrHeadTrackDistance = std::numeric_limits<float>::max();
-            MWWorld::Ptr headTrackTarget;
+            None,
+            PackageTarget,
+            Nearby,
+        };
 
+        HeadTracking getHeadTracking(const MWWorld::Ptr& ptr, bool isPlayer)
+        {
             const MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
-            const bool firstPersonPlayer = isPlayer && MWBase::Environment::get().getWorld()->isFirstPerson();
 
             // 1. Unconsious actor can not track target
             // 2. Actors in combat and pursue mode do not bother to headtrack anyone except their target
             // 3. Player character does not use headtracking in the 1st-person view
-            if (!stats.getKnockedDown() && !firstPersonPlayer)
-            {
-                bool inCombatOrPursue = stats.getAiSequence().isInCombat() || stats.getAiSequence().isInPursuit();
-                if (inCombatOrPursue)
-                {
-                    auto activePackageTarget = stats.getAiSequence().getActivePackage().getTarget();
-                    if (!activePackageTarget.isEmpty())
-                    {
-                        // Track the specified target of package.
-                        updateHeadTracking(
-                            ptr, activePackageTarget, headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
-                    }
-                }
-                else
-                {
-                    // Find something nearby.
-                    for (const Actor& otherActor : actors)
-                    {
-                        if (otherActor.getPtr() == ptr)
-                            continue;
+            if (stats.getKnockedDown() || (isPlayer && MWBase::Environment::get().getWorld()->isFirstPerson()))
+                return HeadTracking::None;
 
-                        updateHeadTracking(
-                            ptr, otherActor.getPtr(), headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
-                    }
-                }
-            }
+            if (stats.getAiSequence().isInCombat() || stats.getAiSequence().isInPursuit())
+                return HeadTracking::PackageTarget;
 
-            ctrl.setHeadTrackTarget(headTrackTarget);
+            return HeadTracking::Nearby;
         }
 
         void updateLuaControls(const MWWorld::Ptr& ptr, bool isPlayer, MWBase::LuaManager::ActorControls& controls)
@@ -933,26 +926,26 @@ namespace MWMechanics
 
     bool Actors::isAttackPreparing(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
-        return it->second->getCharacterController().isAttackPreparing();
+        return actor->getCharacterController().isAttackPreparing();
     }
 
     bool Actors::isRunning(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
-        return it->second->getCharacterController().isRunning();
+        return actor->getCharacterController().isRunning();
     }
 
     bool Actors::isSneaking(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
-        return it->second->getCharacterController().isSneaking();
+        return actor->getCharacterController().isSneaking();
     }
 
     static void updateDrowning(const MWWorld::Ptr& ptr, float duration, bool isKnockedOut, bool isPlayer)
@@ -1196,11 +1189,12 @@ namespace MWMechanics
         MWRender::Animation* anim = MWBase::Environment::get().getWorld()->getAnimation(ptr);
         if (!anim)
             return;
-        const auto it = mActors.emplace(mActors.end(), ptr, anim);
-        mIndex.emplace(ptr.mRef, it);
+        const ActorTable::Index index = mActors.emplace(ptr, anim);
+        mGrid.insert(mActors.getPosition(index), index);
+        Actor& actor = mActors[index];
 
         if (updateImmediately)
-            it->getCharacterController().update(0);
+            actor.getCharacterController().update(0);
 
         // We should initially hide actors outside of processing range.
         // Note: since we update player after other actors, distance will be incorrect during teleportation.
@@ -1208,7 +1202,7 @@ namespace MWMechanics
         if (MWBase::Environment::get().getWorld()->getPlayer().wasTeleported())
             return;
 
-        updateVisibility(ptr, it->getCharacterController());
+        updateVisibility(ptr, actor.getCharacterController());
     }
 
     void Actors::updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const
@@ -1243,21 +1237,21 @@ namespace MWMechanics
 
     void Actors::removeActor(const MWWorld::Ptr& ptr, bool keepActive)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
+        const std::optional<ActorTable::Index> index = mActors.findIndex(ptr);
+        if (index.has_value())
         {
             if (!keepActive)
-                removeTemporaryEffects(iter->second->getPtr());
-            mActors.erase(iter->second);
-            mIndex.erase(iter);
+                removeTemporaryEffects(mActors[*index].getPtr());
+            mGrid.erase(*index);
+            mActors.erase(*index);
         }
     }
 
     void Actors::castSpell(const MWWorld::Ptr& ptr, const ESM::RefId& spellId, bool scriptedSpell) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().castSpell(spellId, scriptedSpell);
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            actor->getCharacterController().castSpell(spellId, scriptedSpell);
     }
 
     bool Actors::isActorDetected(const MWWorld::Ptr& actor, const MWWorld::Ptr& observer) const
@@ -1293,58 +1287,58 @@ namespace MWMechanics
 
     void Actors::updateActor(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(old.mRef);
-        if (iter != mIndex.end())
-            iter->second->updatePtr(ptr);
+        if (Actor* const actor = mActors.search(old))
+            actor->updatePtr(ptr);
     }
 
     void Actors::dropActors(const MWWorld::CellStore* cellStore, const MWWorld::Ptr& ignore)
     {
-        for (auto iter = mActors.begin(); iter != mActors.end();)
+        for (auto iter = mActors.begin(); iter != mActors.end(); ++iter)
         {
             if ((iter->getPtr().isInCell() && iter->getPtr().getCell() == cellStore) && iter->getPtr() != ignore)
             {
                 removeTemporaryEffects(iter->getPtr());
-                mIndex.erase(iter->getPtr().mRef);
-                iter = mActors.erase(iter);
+                mGrid.erase(iter.getIndex());
+                mActors.erase(iter.getIndex());
             }
-            else
-                ++iter;
         }
     }
 
-    void Actors::predictAndAvoidCollisions(float duration) const
+    void Actors::gatherSensingInputs(float duration, bool avoidCollisions)
     {
-        if (!MWBase::Environment::get().getMechanicsManager()->isAIActive())
-            return;
-
-        const float minGap = 10.f;
-        const float maxDistForPartialAvoiding = 200.f;
-        const float maxDistForStrictAvoiding = 100.f;
-        const float maxTimeToCheck = 2.0f;
         const bool giveWayWhenIdle = Settings::game().mNPCsGiveWay;
-
         const MWWorld::Ptr player = getPlayer();
         const MWBase::World* const world = MWBase::Environment::get().getWorld();
-        for (const Actor& actor : mActors)
+
+        mSensingInputs.assign(mActors.getSlotsCount(), SensingInput{});
+
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
         {
-            const MWWorld::Ptr& ptr = actor.getPtr();
-            if (ptr == player)
+            const MWWorld::Ptr& ptr = it->getPtr();
+            const ESM::Position& position = ptr.getRefData().getPosition();
+            const Movement& movement = ptr.getClass().getMovementSettings(ptr);
+            SensingInput& input = mSensingInputs[it.getIndex()];
+            input.mPosition = position.asVec3();
+            input.mRotZ = position.rot[2];
+            input.mHalfExtents = world->getHalfExtents(ptr);
+            input.mMovement = osg::Vec2f(movement.mPosition[0], movement.mPosition[1]);
+            input.mMaxSpeed = ptr.getClass().getMaxSpeed(ptr);
+            input.mIsDead = ptr.getClass().getCreatureStats(ptr).isDead();
+            input.mIsMagicallyHidden = !mHeadTrackingActors.empty() && isTargetMagicallyHidden(ptr);
+
+            if (!avoidCollisions || ptr == player)
                 continue; // Don't interfere with player controls.
 
-            const float maxSpeed = ptr.getClass().getMaxSpeed(ptr);
-            if (maxSpeed == 0.0)
+            if (input.mMaxSpeed == 0.0)
                 continue; // Can't move, so there is no sense to predict collisions.
 
-            Movement& movement = ptr.getClass().getMovementSettings(ptr);
-            const osg::Vec2f origMovement(movement.mPosition[0], movement.mPosition[1]);
-            const bool isMoving = origMovement.length2() > 0.01;
             if (movement.mPosition[1] < 0)
                 continue; // Actors can not see others when move backward.
 
             // Moving NPCs always should avoid collisions.
             // Standing NPCs give way to moving ones if they are not in combat (or pursue) mode and either
             // follow player or have a AIWander package with non-empty wander area.
+            const bool isMoving = input.mMovement.length2() > 0.01;
             bool shouldAvoidCollision = isMoving;
             bool shouldGiveWay = false;
             bool shouldTurnToApproachingActor = !isMoving;
@@ -1374,103 +1368,153 @@ namespace MWMechanics
             if (!shouldAvoidCollision && !shouldGiveWay)
                 continue;
 
-            const osg::Vec2f baseSpeed = origMovement * maxSpeed;
-            const osg::Vec3f basePos = ptr.getRefData().getPosition().asVec3();
-            const float baseRotZ = ptr.getRefData().getPosition().rot[2];
-            const osg::Vec3f halfExtents = world->getHalfExtents(ptr);
-            const float maxDistToCheck = isMoving ? maxDistForPartialAvoiding : maxDistForStrictAvoiding;
-
-            float timeToCheck = maxTimeToCheck;
+            input.mAvoidCollisions = true;
+            input.mIsMoving = isMoving;
+            input.mTurnToApproachingActor = shouldTurnToApproachingActor;
+            if (!currentTarget.isEmpty())
+                input.mTarget = mActors.findIndex(currentTarget);
+            input.mTimeToCheck = maxTimeToCheckCollisions;
             if (!shouldGiveWay && !aiSequence.isEmpty())
-                timeToCheck = std::min(
-                    timeToCheck, getTimeToDestination(**aiSequence.begin(), basePos, maxSpeed, duration, halfExtents));
+                input.mTimeToCheck = std::min(input.mTimeToCheck,
+                    getTimeToDestination(
+                        **aiSequence.begin(), input.mPosition, input.mMaxSpeed, duration, input.mHalfExtents));
+        }
 
-            float timeToCollision = timeToCheck;
-            osg::Vec2f movementCorrection(0, 0);
-            float angleToApproachingActor = 0;
+        for (const ActorTable::Index index : mHeadTrackingActors)
+        {
+            if (!mActors.isUsed(index))
+                continue;
+            const MWWorld::Ptr& ptr = mActors[index].getPtr();
+            const SceneUtil::PositionAttitudeTransform* const baseNode = ptr.getRefData().getBaseNode();
+            if (baseNode == nullptr || getHeadTracking(ptr, ptr == player) != HeadTracking::Nearby)
+                continue;
+            SensingInput& input = mSensingInputs[index];
+            input.mTrackNearby = true;
+            input.mMaxHeadTrackDistance = getMaxHeadTrackDistance(ptr);
+            const osg::Vec3f direction = baseNode->getAttitude() * osg::Vec3f(0, 1, 0);
+            input.mDirection = osg::Vec2f(direction.x(), direction.y());
+        }
+    }
 
-            // Iterate through all other actors and predict collisions.
-            for (const Actor& otherActor : mActors)
-            {
-                const MWWorld::Ptr& otherPtr = otherActor.getPtr();
-                if (otherPtr == ptr || otherPtr == currentTarget)
-                    continue;
+    void Actors::updateSensing(float duration)
+    {
+        const bool avoidCollisions
+            = Settings::game().mNPCsAvoidCollisions && MWBase::Environment::get().getMechanicsManager()->isAIActive();
+        if (!avoidCollisions && mHeadTrackingActors.empty())
+            return;
 
-                const osg::Vec3f otherHalfExtents = world->getHalfExtents(otherPtr);
-                const osg::Vec3f deltaPos = otherPtr.getRefData().getPosition().asVec3() - basePos;
-                const osg::Vec2f relPos = Misc::rotateVec2f(osg::Vec2f(deltaPos.x(), deltaPos.y()), baseRotZ);
-                const float dist = deltaPos.length();
+        gatherSensingInputs(duration, avoidCollisions);
+
+        // Search for nearby actors reads only the gathered state, so each actor can be processed by any thread
+        const std::size_t slotsCount = mSensingInputs.size();
+        if (mHeadTrackCandidates.size() < slotsCount)
+            mHeadTrackCandidates.resize(slotsCount);
+        if (mCollisionCandidates.size() < slotsCount)
+            mCollisionCandidates.resize(slotsCount);
+        // Waking up pool threads is not worth it for a few actors
+        constexpr std::size_t chunkSize = 32;
+        const std::span<const SensingInput> inputs(mSensingInputs);
+        Misc::WorkerPool::get().parallelFor((slotsCount + chunkSize - 1) / chunkSize, [&](std::size_t chunk) {
+            const std::size_t end = std::min(slotsCount, (chunk + 1) * chunkSize);
+            for (std::size_t index = chunk * chunkSize; index < end; ++index)
+            {
+                if (inputs[index].mTrackNearby)
+                    findHeadTrackCandidates(index, inputs, mGrid, mHeadTrackCandidates[index]);
+                if (inputs[index].mAvoidCollisions)
+                    predictCollisions(index, inputs, mGrid, mCollisionCandidates[index]);
+            }
+        });
 
-                // Ignore actors which are not close enough or come from behind.
-                if (dist > maxDistToCheck || relPos.y() < 0)
-                    continue;
+        // Line of sight and awareness checks use the world and random numbers, so they are done serially in a fixed
+        // order. Candidates are sorted, the first one which passes the checks is the nearest.
+        MWBase::World* const world = MWBase::Environment::get().getWorld();
+        MWBase::MechanicsManager* const mechanicsManager = MWBase::Environment::get().getMechanicsManager();
+        const MWWorld::Ptr player = getPlayer();
 
-                // Don't check for a collision if vertical distance is greater then the actor's height.
-                if (deltaPos.z() > halfExtents.z() * 2 || deltaPos.z() < -otherHalfExtents.z() * 2)
-                    continue;
+        for (const ActorTable::Index index : mHeadTrackingActors)
+        {
+            if (!mActors.isUsed(index))
+                continue;
+            Actor& actor = mActors[index];
+            const MWWorld::Ptr& ptr = actor.getPtr();
+            float sqrHeadTrackDistance = std::numeric_limits<float>::max();
+            MWWorld::Ptr headTrackTarget;
 
-                const osg::Vec3f speed = otherPtr.getClass().getMovementSettings(otherPtr).asVec3()
-                    * otherPtr.getClass().getMaxSpeed(otherPtr);
-                const float rotZ = otherPtr.getRefData().getPosition().rot[2];
-                const osg::Vec2f relSpeed
-                    = Misc::rotateVec2f(osg::Vec2f(speed.x(), speed.y()), baseRotZ - rotZ) - baseSpeed;
+            switch (getHeadTracking(ptr, ptr == player))
+            {
+                case HeadTracking::None:
+                    break;
+                case HeadTracking::PackageTarget:
+                {
+                    // Track the specified target of package.
+                    const MWWorld::Ptr activePackageTarget
+                        = ptr.getClass().getCreatureStats(ptr).getAiSequence().getActivePackage().getTarget();
+                    if (!activePackageTarget.isEmpty())
+                        updateHeadTracking(ptr, activePackageTarget, headTrackTarget, sqrHeadTrackDistance, true);
+                    break;
+                }
+                case HeadTracking::Nearby:
+                    if (!mSensingInputs[index].mTrackNearby)
+                        break;
+                    for (const HeadTrackCandidate& candidate : mHeadTrackCandidates[index])
+                    {
+                        const MWWorld::Ptr& target = mActors[candidate.mIndex].getPtr();
+                        if (world->getLOS(ptr, target) && mechanicsManager->awarenessCheck(target, ptr))
+                        {
+                            headTrackTarget = target;
+                            break;
+                        }
+                    }
+                    break;
+            }
 
-                float collisionDist = minGap + halfExtents.x() + otherHalfExtents.x();
-                collisionDist = std::min(collisionDist, relPos.length());
+            actor.getCharacterController().setHeadTrackTarget(headTrackTarget);
+        }
 
-                // Find the earliest `t` when |relPos + relSpeed * t| == collisionDist.
-                const float vr = relPos.x() * relSpeed.x() + relPos.y() * relSpeed.y();
-                const float v2 = relSpeed.length2();
-                const float Dh = vr * vr - v2 * (relPos.length2() - collisionDist * collisionDist);
-                if (Dh <= 0 || v2 == 0)
-                    continue; // No solution; distance is always >= collisionDist.
-                const float t = (-vr - std::sqrt(Dh)) / v2;
+        if (!avoidCollisions)
+            return;
 
-                if (t < 0 || t > timeToCollision)
-                    continue;
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
+        {
+            const SensingInput& input = mSensingInputs[it.getIndex()];
+            if (!input.mAvoidCollisions)
+                continue;
 
-                // Check visibility and awareness last as it's expensive.
-                if (!MWBase::Environment::get().getWorld()->getLOS(otherPtr, ptr))
-                    continue;
-                if (!MWBase::Environment::get().getMechanicsManager()->awarenessCheck(otherPtr, ptr))
+            const MWWorld::Ptr& ptr = it->getPtr();
+            for (const CollisionCandidate& candidate : mCollisionCandidates[it.getIndex()])
+            {
+                const MWWorld::Ptr& otherPtr = mActors[candidate.mIndex].getPtr();
+                if (!world->getLOS(otherPtr, ptr) || !mechanicsManager->awarenessCheck(otherPtr, ptr))
                     continue;
 
-                timeToCollision = t;
-                angleToApproachingActor = std::atan2(deltaPos.x(), deltaPos.y());
-                const osg::Vec2f posAtT = relPos + relSpeed * t;
-                const float coef = (posAtT.x() * relSpeed.x() + posAtT.y() * relSpeed.y())
-                    / (collisionDist * collisionDist * maxSpeed)
-                    * std::clamp(
-                        (maxDistForPartialAvoiding - dist) / (maxDistForPartialAvoiding - maxDistForStrictAvoiding),
-                        0.f, 1.f);
-                movementCorrection = posAtT * coef;
-                if (otherPtr.getClass().getCreatureStats(otherPtr).isDead())
-                    // In case of dead body still try to go around (it looks natural), but reduce the correction twice.
-                    movementCorrection.y() *= 0.5f;
-            }
-
-            if (timeToCollision < timeToCheck)
-            {
                 // Try to evade the nearest collision.
-                osg::Vec2f newMovement = origMovement + movementCorrection;
+                osg::Vec2f newMovement = input.mMovement + candidate.mMovementCorrection;
                 // Step to the side rather than backward. Otherwise player will be able to push the NPC far away from
                 // it's original location.
                 newMovement.y() = std::max(newMovement.y(), 0.f);
                 newMovement.normalize();
-                if (isMoving)
-                    newMovement *= origMovement.length(); // Keep the original speed.
+                if (input.mIsMoving)
+                    newMovement *= input.mMovement.length(); // Keep the original speed.
+                Movement& movement = ptr.getClass().getMovementSettings(ptr);
                 movement.mPosition[0] = newMovement.x();
                 movement.mPosition[1] = newMovement.y();
-                if (shouldTurnToApproachingActor)
-                    zTurn(ptr, angleToApproachingActor);
+                if (input.mTurnToApproachingActor)
+                    zTurn(ptr, candidate.mAngle);
+                break;
             }
         }
     }
 
-    void Actors::update(float duration, bool paused)
+    void Actors::update(
+        float duration, bool paused, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
     {
         if (!paused)
         {
+            const osg::Timer& timer = *osg::Timer::instance();
+
+            updateGrid();
+            mHeadTrackingActors.clear();
+
             const float updateEquippedLightInterval = 1.0f;
 
             if (mTimerUpdateHeadTrack >= 0.3f)
@@ -1508,116 +1552,131 @@ namespace MWMechanics
             const int actorsProcessingRange = Settings::game().mActorsProcessingRange;
 
             // AI and magic effects update
-            for (Actor& actor : mActors)
             {
-                const bool isPlayer = actor.getPtr() == player;
-                CharacterController& ctrl = actor.getCharacterController();
-                MWBase::LuaManager::ActorControls* luaControls
-                    = MWBase::Environment::get().getLuaManager()->getActorControls(actor.getPtr());
-
-                const float distSqr = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length2();
-                // AI processing is only done within given distance to the player.
-                const bool inProcessingRange = distSqr <= actorsProcessingRange * actorsProcessingRange;
-
-                // If dead or no longer in combat, no longer store any actors who attempted to hit us. Also remove for
-                // the player.
-                if (!isPlayer
-                    && (actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDead()
-                        || !actor.getPtr().getClass().getCreatureStats(actor.getPtr()).getAiSequence().isInCombat()
-                        || !inProcessingRange))
+                OMW::ScopedProfile<OMW::UserStatsType::MechanicsAi> profile(frameStart, frameNumber, timer, stats);
+
+                for (auto it = mActors.begin(); it != mActors.end(); ++it)
                 {
-                    actor.getPtr().getClass().getCreatureStats(actor.getPtr()).setHitAttemptActorId(-1);
-                    if (player.getClass().getCreatureStats(player).getHitAttemptActorId()
-                        == actor.getPtr().getClass().getCreatureStats(actor.getPtr()).getActorId())
-                        player.getClass().getCreatureStats(player).setHitAttemptActorId(-1);
-                }
+                    Actor& actor = *it;
+                    const bool isPlayer = actor.getPtr() == player;
+                    CharacterController& ctrl = actor.getCharacterController();
+                    MWBase::LuaManager::ActorControls* luaControls
+                        = MWBase::Environment::get().getLuaManager()->getActorControls(actor.getPtr());
+
+                    const float distSqr = (playerPos - mActors.getPosition(it.getIndex())).length2();
+                    // AI processing is only done within given distance to the player.
+                    const bool inProcessingRange = distSqr <= actorsProcessingRange * actorsProcessingRange;
+
+                    // If dead or no longer in combat, no longer store any actors who attempted to hit us. Also remove
+                    // for the player.
+                    if (!isPlayer
+                        && (actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDead()
+                            || !actor.getPtr().getClass().getCreatureStats(actor.getPtr()).getAiSequence().isInCombat()
+                            || !inProcessingRange))
+                    {
+                        actor.getPtr().getClass().getCreatureStats(actor.getPtr()).setHitAttemptActorId(-1);
+                        if (player.getClass().getCreatureStats(player).getHitAttemptActorId()
+                            == actor.getPtr().getClass().getCreatureStats(actor.getPtr()).getActorId())
+                            player.getClass().getCreatureStats(player).setHitAttemptActorId(-1);
+                    }
 
-                const Misc::TimerStatus engageCombatTimerStatus = actor.updateEngageCombatTimer(duration);
+                    const Misc::TimerStatus engageCombatTimerStatus = actor.updateEngageCombatTimer(duration);
 
-                // For dead actors we need to update looping spell particles
-                if (actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDead())
-                {
-                    // They can be added during the death animation
-                    if (!actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDeathAnimationFinished())
-                        adjustMagicEffects(actor.getPtr(), duration);
-                    ctrl.updateContinuousVfx();
-                }
-                else
-                {
-                    MWWorld::Scene* worldScene = MWBase::Environment::get().getWorldScene();
-                    const bool cellChanged = worldScene->hasCellChanged();
-                    const MWWorld::Ptr actorPtr = actor.getPtr(); // make a copy of the map key to avoid it being
-                                                                  // invalidated when the player teleports
-                    updateActor(actorPtr, duration);
-
-                    // Looping magic VFX update
-                    // Note: we need to do this before any of the animations are updated.
-                    // Reaching the text keys may trigger Hit / Spellcast (and as such, particles),
-                    // so updating VFX immediately after that would just remove the particle effects instantly.
-                    // There needs to be a magic effect update in between.
-                    ctrl.updateContinuousVfx();
-
-                    if (!cellChanged && worldScene->hasCellChanged())
+                    // For dead actors we need to update looping spell particles
+                    if (actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDead())
                     {
-                        return; // for now abort update of the old cell when cell changes by teleportation magic effect
-                                // a better solution might be to apply cell changes at the end of the frame
+                        // They can be added during the death animation
+                        if (!actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDeathAnimationFinished())
+                            adjustMagicEffects(actor.getPtr(), duration);
+                        ctrl.updateContinuousVfx();
                     }
-                    if (aiActive && inProcessingRange)
+                    else
                     {
-                        if (engageCombatTimerStatus == Misc::TimerStatus::Elapsed)
+                        MWWorld::Scene* worldScene = MWBase::Environment::get().getWorldScene();
+                        const bool cellChanged = worldScene->hasCellChanged();
+                        const MWWorld::Ptr actorPtr = actor.getPtr(); // make a copy of the map key to avoid it being
+                                                                      // invalidated when the player teleports
+                        updateActor(actorPtr, duration);
+
+                        // Looping magic VFX update
+                        // Note: we need to do this before any of the animations are updated.
+                        // Reaching the text keys may trigger Hit / Spellcast (and as such, particles),
+                        // so updating VFX immediately after that would just remove the particle effects instantly.
+                        // There needs to be a magic effect update in between.
+                        ctrl.updateContinuousVfx();
+
+                        if (!cellChanged && worldScene->hasCellChanged())
                         {
-                            if (!isPlayer)
-                                adjustCommandedActor(actor.getPtr());
-
-                            for (const Actor& otherActor : mActors)
+                            return; // for now abort update of the old cell when cell changes by teleportation magic
+                                    // effect a better solution might be to apply cell changes at the end of the frame
+                        }
+                        if (aiActive && inProcessingRange)
+                        {
+                            if (engageCombatTimerStatus == Misc::TimerStatus::Elapsed)
                             {
-                                if (otherActor.getPtr() == actor.getPtr() || isPlayer) // player is not AI-controlled
-                                    continue;
-                                engageCombat(
-                                    actor.getPtr(), otherActor.getPtr(), cachedAllies, otherActor.getPtr() == player);
+                                if (!isPlayer)
+                                    adjustCommandedActor(actor.getPtr());
+
+                                // player is not AI-controlled
+                                if (!isPlayer)
+                                {
+                                    // engageCombat ignores actors outside of processing range
+                                    forEachActorNear(actor.getPtr().getRefData().getPosition().asVec3(),
+                                        actorsProcessingRange, [&](const Actor& otherActor) {
+                                            if (otherActor.getPtr() == actor.getPtr())
+                                                return;
+                                            engageCombat(actor.getPtr(), otherActor.getPtr(), cachedAllies,
+                                                otherActor.getPtr() == player);
+                                        });
+                                }
                             }
-                        }
-                        if (mTimerUpdateHeadTrack == 0)
-                            updateHeadTracking(actor.getPtr(), mActors, isPlayer, ctrl);
+                            // Target is chosen after AI update when all actors are processed
+                            if (mTimerUpdateHeadTrack == 0)
+                                mHeadTrackingActors.push_back(it.getIndex());
 
-                        if (actor.getPtr().getClass().isNpc() && !isPlayer)
-                            updateCrimePursuit(actor.getPtr(), duration, cachedAllies);
+                            if (actor.getPtr().getClass().isNpc() && !isPlayer)
+                                updateCrimePursuit(actor.getPtr(), duration, cachedAllies);
 
-                        if (!isPlayer)
-                        {
-                            CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
-                            if (isConscious(actor.getPtr()) && !(luaControls && luaControls->mDisableAI))
+                            if (!isPlayer)
                             {
-                                stats.getAiSequence().execute(actor.getPtr(), ctrl, duration);
-                                updateGreetingState(actor.getPtr(), actor, mTimerUpdateHello > 0);
-                                playIdleDialogue(actor.getPtr());
-                                updateMovementSpeed(actor.getPtr());
+                                CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
+                                if (isConscious(actor.getPtr()) && !(luaControls && luaControls->mDisableAI))
+                                {
+                                    stats.getAiSequence().execute(actor.getPtr(), ctrl, duration);
+                                    updateGreetingState(actor.getPtr(), actor, mTimerUpdateHello > 0);
+                                    playIdleDialogue(actor.getPtr());
+                                    updateMovementSpeed(actor.getPtr());
+                                }
                             }
                         }
-                    }
-                    else if (aiActive && !isPlayer && isConscious(actor.getPtr())
-                        && !(luaControls && luaControls->mDisableAI))
-                    {
-                        CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
-                        stats.getAiSequence().execute(actor.getPtr(), ctrl, duration, /*outOfRange*/ true);
-                    }
+                        else if (aiActive && !isPlayer && isConscious(actor.getPtr())
+                            && !(luaControls && luaControls->mDisableAI))
+                        {
+                            CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
+                            stats.getAiSequence().execute(actor.getPtr(), ctrl, duration, /*outOfRange*/ true);
+                        }
 
-                    if (inProcessingRange && actor.getPtr().getClass().isNpc())
-                    {
-                        // We can not update drowning state for actors outside of AI distance - they can not resurface
-                        // to breathe
-                        updateDrowning(actor.getPtr(), duration, ctrl.isKnockedOut(), isPlayer);
-                    }
-                    if (mTimerUpdateEquippedLight == 0 && actor.getPtr().getClass().hasInventoryStore(actor.getPtr()))
-                        updateEquippedLight(actor.getPtr(), updateEquippedLightInterval, showTorches);
+                        if (inProcessingRange && actor.getPtr().getClass().isNpc())
+                        {
+                            // We can not update drowning state for actors outside of AI distance - they can not
+                            // resurface to breathe
+                            updateDrowning(actor.getPtr(), duration, ctrl.isKnockedOut(), isPlayer);
+                        }
+                        if (mTimerUpdateEquippedLight == 0
+                            && actor.getPtr().getClass().hasInventoryStore(actor.getPtr()))
+                            updateEquippedLight(actor.getPtr(), updateEquippedLightInterval, showTorches);
 
-                    if (luaControls != nullptr && isConscious(actor.getPtr()))
-                        updateLuaControls(actor.getPtr(), isPlayer, *luaControls);
+                        if (luaControls != nullptr && isConscious(actor.getPtr()))
+                            updateLuaControls(actor.getPtr(), isPlayer, *luaControls);
+                    }
                 }
             }
 
-            if (Settings::game().mNPCsAvoidCollisions)
-                predictAndAvoidCollisions(duration);
+            {
+                OMW::ScopedProfile<OMW::UserStatsType::MechanicsSensing> profile(
+                    frameStart, frameNumber, timer, stats);
+                updateSensing(duration);
+            }
 
             mTimerUpdateHeadTrack += duration;
             mTimerUpdateEquippedLight += duration;
@@ -1625,72 +1684,77 @@ namespace MWMechanics
             mTimerDisposeSummonsCorpses += duration;
 
             // Animation/movement update
-            CharacterController* playerCharacter = nullptr;
-            for (Actor& actor : mActors)
             {
-                const float dist = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length();
-                const bool isPlayer = actor.getPtr() == player;
-                CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
-                // Actors with active AI should be able to move.
-                bool alwaysActive = false;
-                if (!isPlayer && isConscious(actor.getPtr()) && !stats.isParalyzed())
+                OMW::ScopedProfile<OMW::UserStatsType::MechanicsAnimation> profile(
+                    frameStart, frameNumber, timer, stats);
+
+                CharacterController* playerCharacter = nullptr;
+                for (Actor& actor : mActors)
                 {
-                    MWMechanics::AiSequence& seq = stats.getAiSequence();
-                    alwaysActive = !seq.isEmpty() && seq.getActivePackage().alwaysActive();
-                }
-                const bool inRange = isPlayer || dist <= actorsProcessingRange || alwaysActive;
-                const int activeFlag = isPlayer ? 2 : 1; // Can be changed back to '2' to keep updating bounding boxes
-                                                         // off screen (more accurate, but slower)
-                const int active = inRange ? activeFlag : 0;
+                    const float dist = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length();
+                    const bool isPlayer = actor.getPtr() == player;
+                    CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
+                    // Actors with active AI should be able to move.
+                    bool alwaysActive = false;
+                    if (!isPlayer && isConscious(actor.getPtr()) && !stats.isParalyzed())
+                    {
+                        MWMechanics::AiSequence& seq = stats.getAiSequence();
+                        alwaysActive = !seq.isEmpty() && seq.getActivePackage().alwaysActive();
+                    }
+                    const bool inRange = isPlayer || dist <= actorsProcessingRange || alwaysActive;
+                    // Can be changed back to '2' to keep updating bounding boxes off screen (more accurate, but slower)
+                    const int activeFlag = isPlayer ? 2 : 1;
+                    const int active = inRange ? activeFlag : 0;
 
-                CharacterController& ctrl = actor.getCharacterController();
-                ctrl.setActive(active);
+                    CharacterController& ctrl = actor.getCharacterController();
+                    ctrl.setActive(active);
 
-                if (!inRange)
-                {
-                    actor.getPtr().getRefData().getBaseNode()->setNodeMask(0);
-                    world->setActorActive(actor.getPtr(), false);
-                    continue;
-                }
+                    if (!inRange)
+                    {
+                        actor.getPtr().getRefData().getBaseNode()->setNodeMask(0);
+                        world->setActorActive(actor.getPtr(), false);
+                        continue;
+                    }
 
-                world->setActorActive(actor.getPtr(), true);
+                    world->setActorActive(actor.getPtr(), true);
 
-                const bool isDead = actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDead();
-                if (!isDead && actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isParalyzed())
-                    ctrl.skipAnim();
+                    const bool isDead = actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDead();
+                    if (!isDead && actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isParalyzed())
+                        ctrl.skipAnim();
 
-                // Handle player last, in case a cell transition occurs by casting a teleportation spell
-                // (would invalidate the iterator)
-                if (isPlayer)
-                {
-                    playerCharacter = &ctrl;
-                    continue;
-                }
+                    // Handle player last, in case a cell transition occurs by casting a teleportation spell
+                    // (would invalidate the iterator)
+                    if (isPlayer)
+                    {
+                        playerCharacter = &ctrl;
+                        continue;
+                    }
 
-                actor.getPtr().getRefData().getBaseNode()->setNodeMask(MWRender::Mask_Actor);
-                world->setActorCollisionMode(actor.getPtr(), true,
-                    !actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDeathAnimationFinished());
+                    actor.getPtr().getRefData().getBaseNode()->setNodeMask(MWRender::Mask_Actor);
+                    world->setActorCollisionMode(actor.getPtr(), true,
+                        !actor.getPtr().getClass().getCreatureStats(actor.getPtr()).isDeathAnimationFinished());
 
-                if (!actor.getPositionAdjusted())
-                {
-                    actor.getPtr().getClass().adjustPosition(actor.getPtr(), false);
-                    actor.setPositionAdjusted(true);
-                }
+                    if (!actor.getPositionAdjusted())
+                    {
+                        actor.getPtr().getClass().adjustPosition(actor.getPtr(), false);
+                        actor.setPositionAdjusted(true);
+                    }
 
-                ctrl.update(duration);
+                    ctrl.update(duration);
 
-                updateVisibility(actor.getPtr(), ctrl);
-            }
+                    updateVisibility(actor.getPtr(), ctrl);
+                }
 
-            if (playerCharacter)
-            {
-                MWBase::Environment::get().getWorld()->applyDeferredPreviewRotationToPlayer(duration);
-                playerCharacter->update(duration);
-                playerCharacter->setVisibility(1.f);
-                MWBase::LuaManager::ActorControls* luaControls
-                    = MWBase::Environment::get().getLuaManager()->getActorControls(player);
-                if (luaControls && player.getClass().getMovementSettings(player).mPosition[2] < 1)
-                    luaControls->mJump = false;
+                if (playerCharacter)
+                {
+                    MWBase::Environment::get().getWorld()->applyDeferredPreviewRotationToPlayer(duration);
+                    playerCharacter->update(duration);
+                    playerCharacter->setVisibility(1.f);
+                    MWBase::LuaManager::ActorControls* luaControls
+                        = MWBase::Environment::get().getLuaManager()->getActorControls(player);
+                    if (luaControls && player.getClass().getMovementSettings(player).mPosition[2] < 1)
+                        luaControls->mJump = false;
+                }
             }
 
             for (const Actor& actor : mActors)
@@ -1728,14 +1792,14 @@ namespace MWMechanics
 
     void Actors::resurrect(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
         {
-            if (iter->second->getCharacterController().isDead())
+            if (actor->getCharacterController().isDead())
             {
                 // Actor has been resurrected. Notify the CharacterController and re-enable collision.
-                MWBase::Environment::get().getWorld()->enableActorCollision(iter->second->getPtr(), true);
-                iter->second->getCharacterController().resurrect();
+                MWBase::Environment::get().getWorld()->enableActorCollision(actor->getPtr(), true);
+                actor->getCharacterController().resurrect();
             }
         }
     }
@@ -1982,18 +2046,18 @@ namespace MWMechanics
 
     void Actors::forceStateUpdate(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().forceStateUpdate();
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            actor->getCharacterController().forceStateUpdate();
     }
 
     bool Actors::playAnimationGroup(
         const MWWorld::Ptr& ptr, std::string_view groupName, int mode, uint32_t number, bool scripted) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
         {
-            return iter->second->getCharacterController().playGroup(groupName, mode, number, scripted);
+            return actor->getCharacterController().playGroup(groupName, mode, number, scripted);
         }
         else
         {
@@ -2006,40 +2070,40 @@ namespace MWMechanics
     bool Actors::playAnimationGroupLua(const MWWorld::Ptr& ptr, std::string_view groupName, uint32_t loops, float speed,
         std::string_view startKey, std::string_view stopKey, bool forceLoop)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            return iter->second->getCharacterController().playGroupLua(
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            return actor->getCharacterController().playGroupLua(
                 groupName, speed, startKey, stopKey, loops, forceLoop);
         return false;
     }
 
     void Actors::enableLuaAnimations(const MWWorld::Ptr& ptr, bool enable)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().enableLuaAnimations(enable);
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            actor->getCharacterController().enableLuaAnimations(enable);
     }
 
     void Actors::skipAnimation(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().skipAnim();
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            actor->getCharacterController().skipAnim();
     }
 
     bool Actors::checkAnimationPlaying(const MWWorld::Ptr& ptr, const std::string& groupName) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            return iter->second->getCharacterController().isAnimPlaying(groupName);
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            return actor->getCharacterController().isAnimPlaying(groupName);
         return false;
     }
 
     bool Actors::checkScriptedAnimationPlaying(const MWWorld::Ptr& ptr) const
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            return iter->second->getCharacterController().isScriptedAnimPlaying();
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            return actor->getCharacterController().isScriptedAnimPlaying();
         return false;
     }
 
@@ -2051,29 +2115,37 @@ namespace MWMechanics
 
     void Actors::clearAnimationQueue(const MWWorld::Ptr& ptr, bool clearScripted)
     {
-        const auto iter = mIndex.find(ptr.mRef);
-        if (iter != mIndex.end())
-            iter->second->getCharacterController().clearAnimQueue(clearScripted);
+        Actor* const actor = mActors.search(ptr);
+        if (actor != nullptr)
+            actor->getCharacterController().clearAnimQueue(clearScripted);
     }
 
     void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
     {
-        for (const Actor& actor : mActors)
-        {
+        forEachActorNear(position, radius, [&](const Actor& actor) {
             if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius)
                 out.push_back(actor.getPtr());
-        }
+        });
     }
 
     bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius) const
     {
-        for (const Actor& actor : mActors)
-        {
+        bool result = false;
+        forEachActorNear(position, radius, [&](const Actor& actor) {
             if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius)
-                return true;
-        }
+                result = true;
+        });
+        return result;
+    }
 
-        return false;
+    void Actors::updateGrid()
+    {
+        mActors.updatePositions();
+        mGrid.rebuild(
+            std::views::iota(ActorTable::Index{ 0 }, mActors.getSlotsCount())
+                | std::views::filter([&](ActorTable::Index index) { return mActors.isUsed(index); }),
+            [](ActorTable::Index index) { return index; },
+            [&](ActorTable::Index index) { return mActors.getPosition(index); });
     }
 
     std::vector<MWWorld::Ptr> Actors::getActorsSidingWith(const MWWorld::Ptr& actorPtr, bool excludeInfighting) const
@@ -2274,7 +2346,7 @@ namespace MWMechanics
 
     void Actors::clear()
     {
-        mIndex.clear();
+        mGrid.clear();
         mActors.clear();
         mDeathCount.clear();
     }
@@ -2286,65 +2358,65 @@ namespace MWMechanics
 
     bool Actors::isReadyToBlock(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
 
-        return it->second->getCharacterController().isReadyToBlock();
+        return actor->getCharacterController().isReadyToBlock();
     }
 
     bool Actors::isCastingSpell(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
 
-        return it->second->getCharacterController().isCastingSpell();
+        return actor->getCharacterController().isCastingSpell();
     }
 
     bool Actors::isAttackingOrSpell(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
 
-        return it->second->getCharacterController().isAttackingOrSpell();
+        return actor->getCharacterController().isAttackingOrSpell();
     }
 
     int Actors::getGreetingTimer(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return 0;
 
-        return it->second->getGreetingTimer();
+        return actor->getGreetingTimer();
     }
 
     float Actors::getAngleToPlayer(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return 0.f;
 
-        return it->second->getAngleToPlayer();
+        return actor->getAngleToPlayer();
     }
 
     GreetingState Actors::getGreetingState(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return Greet_None;
 
-        return it->second->getGreetingState();
+        return actor->getGreetingState();
     }
 
     bool Actors::isTurningToPlayer(const MWWorld::Ptr& ptr) const
     {
-        const auto it = mIndex.find(ptr.mRef);
-        if (it == mIndex.end())
+        const Actor* const actor = mActors.search(ptr);
+        if (actor == nullptr)
             return false;
 
-        return it->second->isTurningToPlayer();
+        return actor->isTurningToPlayer();
     }
 
     void Actors::fastForwardAi() const
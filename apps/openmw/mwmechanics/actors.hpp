@@ -1,13 +1,18 @@
 #ifndef GAME_MWMECHANICS_ACTORS_H
 #define GAME_MWMECHANICS_ACTORS_H
 
-#include <list>
 #include <map>
 #include <set>
 #include <string>
 #include <vector>
 
+#include <osg/Timer>
+
+#include <components/misc/spatialgrid.hpp>
+
 #include "actor.hpp"
+#include "actorsensing.hpp"
+#include "actortable.hpp"
 
 namespace ESM
 {
@@ -17,6 +22,7 @@ namespace ESM
 
 namespace osg
 {
+    class Stats;
     class Vec3f;
 }
 
@@ -41,8 +47,8 @@ namespace MWMechanics
     class Actors
     {
     public:
-        std::list<Actor>::const_iterator begin() const { return mActors.begin(); }
-        std::list<Actor>::const_iterator end() const { return mActors.end(); }
+        ActorTable::const_iterator begin() const { return mActors.begin(); }
+        std::default_sentinel_t end() const { return mActors.end(); }
         std::size_t size() const { return mActors.size(); }
 
         void notifyDied(const MWWorld::Ptr& actor);
@@ -75,7 +81,8 @@ namespace MWMechanics
         void dropActors(const MWWorld::CellStore* cellStore, const MWWorld::Ptr& ignore);
         ///< Deregister all actors (except for \a ignore) in the given cell.
 
-        void update(float duration, bool paused);
+        void update(
+            float duration, bool paused, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats);
         ///< Update actor stats and store desired velocity vectors in \a movement
 
         void updateActor(const MWWorld::Ptr& ptr, float duration) const;
@@ -128,6 +135,14 @@ namespace MWMechanics
 
         bool isAnyObjectInRange(const osg::Vec3f& position, float radius) const;
 
+        /// Calls function for each actor which may be within radius from position, exact distance is not checked
+        template <class Function>
+        void forEachActorNear(const osg::Vec3f& position, float radius, Function&& function) const
+        {
+            // Actors keep moving after the grid is rebuilt
+            mGrid.forEachNearMoving(position, radius, [&](ActorTable::Index index) { function(mActors[index]); });
+        }
+
         void cleanupSummonedCreature(CreatureStats& casterStats, int creatureActorId) const;
 
         /// Returns the list of actors which are siding with the given actor in fights
@@ -169,8 +184,9 @@ namespace MWMechanics
 
     private:
         std::map<ESM::RefId, int> mDeathCount;
-        std::list<Actor> mActors;
-        std::map<const MWWorld::LiveCellRefBase*, std::list<Actor>::iterator> mIndex;
+        ActorTable mActors;
+        // Rebuilt once per frame from actors positions to avoid iteration over all actors for proximity checks
+        Misc::SpatialGrid<ActorTable::Index> mGrid{ 512 };
         // We should add a delay between summoned creature death and its corpse despawning
         float mTimerDisposeSummonsCorpses = 0.2f;
         float mTimerUpdateHeadTrack = 0;
@@ -178,6 +194,12 @@ namespace MWMechanics
         float mTimerUpdateHello = 0;
         float mSneakTimer = 0; // Times update of sneak icon
         float mSneakSkillTimer = 0; // Times sneak skill progress from "avoid notice"
+        // Actors to update head tracking for in the current frame in the order of AI update
+        std::vector<ActorTable::Index> mHeadTrackingActors;
+        // Indexed by actor slot, reused between frames to avoid allocations
+        std::vector<SensingInput> mSensingInputs;
+        std::vector<std::vector<HeadTrackCandidate>> mHeadTrackCandidates;
+        std::vector<std::vector<CollisionCandidate>> mCollisionCandidates;
 
         void updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const;
 
@@ -191,7 +213,13 @@ namespace MWMechanics
 
         void purgeSpellEffects(int casterActorId) const;
 
-        void predictAndAvoidCollisions(float duration) const;
+        /// Updates head tracking targets and avoids predicted collisions between actors. Nearby actors are searched
+        /// in parallel, then line of sight and awareness are checked and changes are applied in the order of slots.
+        void updateSensing(float duration);
+
+        void gatherSensingInputs(float duration, bool avoidCollisions);
+
+        void updateGrid();
 
         /** Start combat between two actors
             @Notes: If againstPlayer = true then actor2 should be the Player.
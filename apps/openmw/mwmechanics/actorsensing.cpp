@@ -0,0 +1,120 @@
+#include "actorsensing.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <components/misc/mathutil.hpp>
+
+namespace MWMechanics
+{
+    namespace
+    {
+        constexpr float minGap = 10.f;
+        constexpr float maxDistForPartialAvoiding = 200.f;
+        constexpr float maxDistForStrictAvoiding = 100.f;
+    }
+
+    void findHeadTrackCandidates(std::size_t index, std::span<const SensingInput> inputs,
+        const Misc::SpatialGrid<std::size_t>& grid, std::vector<HeadTrackCandidate>& out)
+    {
+        out.clear();
+
+        const SensingInput& actor = inputs[index];
+        const float maxDistance = actor.mMaxHeadTrackDistance;
+
+        grid.forEachNearMoving(actor.mPosition, maxDistance, [&](std::size_t otherIndex) {
+            if (otherIndex == index)
+                return;
+
+            const SensingInput& other = inputs[otherIndex];
+            if (other.mIsDead || other.mIsMagicallyHidden)
+                return;
+
+            const osg::Vec3f delta = other.mPosition - actor.mPosition;
+            const float sqrDist = delta.length2();
+            if (sqrDist > maxDistance * maxDistance)
+                return;
+
+            // stop tracking when target is behind the actor
+            if (actor.mDirection * osg::Vec2f(delta.x(), delta.y()) <= 0)
+                return;
+
+            out.push_back(HeadTrackCandidate{ .mSqrDistance = sqrDist, .mIndex = otherIndex });
+        });
+
+        std::stable_sort(out.begin(), out.end(), [](const HeadTrackCandidate& l, const HeadTrackCandidate& r) {
+            return l.mSqrDistance < r.mSqrDistance;
+        });
+    }
+
+    void predictCollisions(std::size_t index, std::span<const SensingInput> inputs,
+        const Misc::SpatialGrid<std::size_t>& grid, std::vector<CollisionCandidate>& out)
+    {
+        out.clear();
+
+        const SensingInput& actor = inputs[index];
+        const osg::Vec2f baseSpeed = actor.mMovement * actor.mMaxSpeed;
+        const osg::Vec3f& basePos = actor.mPosition;
+        const float baseRotZ = actor.mRotZ;
+        const osg::Vec3f& halfExtents = actor.mHalfExtents;
+        const float maxDistToCheck = actor.mIsMoving ? maxDistForPartialAvoiding : maxDistForStrictAvoiding;
+
+        grid.forEachNearMoving(basePos, maxDistToCheck, [&](std::size_t otherIndex) {
+            if (otherIndex == index || otherIndex == actor.mTarget)
+                return;
+
+            const SensingInput& other = inputs[otherIndex];
+            const osg::Vec3f& otherHalfExtents = other.mHalfExtents;
+            const osg::Vec3f deltaPos = other.mPosition - basePos;
+            const osg::Vec2f relPos = Misc::rotateVec2f(osg::Vec2f(deltaPos.x(), deltaPos.y()), baseRotZ);
+            const float dist = deltaPos.length();
+
+            // Ignore actors which are not close enough or come from behind.
+            if (dist > maxDistToCheck || relPos.y() < 0)
+                return;
+
+            // Don't check for a collision if vertical distance is greater then the actor's height.
+            if (deltaPos.z() > halfExtents.z() * 2 || deltaPos.z() < -otherHalfExtents.z() * 2)
+                return;
+
+            const osg::Vec2f speed = other.mMovement * other.mMaxSpeed;
+            const osg::Vec2f relSpeed = Misc::rotateVec2f(speed, baseRotZ - other.mRotZ) - baseSpeed;
+
+            float collisionDist = minGap + halfExtents.x() + otherHalfExtents.x();
+            collisionDist = std::min(collisionDist, relPos.length());
+
+            // Find the earliest `t` when |relPos + relSpeed * t| == collisionDist.
+            const float vr = relPos.x() * relSpeed.x() + relPos.y() * relSpeed.y();
+            const float v2 = relSpeed.length2();
+            const float Dh = vr * vr - v2 * (relPos.length2() - collisionDist * collisionDist);
+            if (Dh <= 0 || v2 == 0)
+                return; // No solution; distance is always >= collisionDist.
+            const float t = (-vr - std::sqrt(Dh)) / v2;
+
+            // Collision at the end of the checked time is not avoided
+            if (t < 0 || t >= actor.mTimeToCheck)
+                return;
+
+            const osg::Vec2f posAtT = relPos + relSpeed * t;
+            const float coef = (posAtT.x() * relSpeed.x() + posAtT.y() * relSpeed.y())
+                / (collisionDist * collisionDist * actor.mMaxSpeed)
+                * std::clamp(
+                    (maxDistForPartialAvoiding - dist) / (maxDistForPartialAvoiding - maxDistForStrictAvoiding), 0.f,
+                    1.f);
+            osg::Vec2f movementCorrection = posAtT * coef;
+            if (other.mIsDead)
+                // In case of dead body still try to go around (it looks natural), but reduce the correction twice.
+                movementCorrection.y() *= 0.5f;
+
+            out.push_back(CollisionCandidate{
+                .mTime = t,
+                .mIndex = otherIndex,
+                .mAngle = std::atan2(deltaPos.x(), deltaPos.y()),
+                .mMovementCorrection = movementCorrection,
+            });
+        });
+
+        std::stable_sort(out.begin(), out.end(),
+            [](const CollisionCandidate& l, const CollisionCandidate& r) { return l.mTime < r.mTime; });
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef GAME_MWMECHANICS_ACTORSENSING_H
+#define GAME_MWMECHANICS_ACTORSENSING_H
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <osg/Vec2f>
+#include <osg/Vec3f>
+
+#include <components/misc/spatialgrid.hpp>
+
+namespace MWMechanics
+{
+    /// @brief State of a single actor copied on the main thread before sensing. Indexed by ActorTable slot.
+    /// @par Sensing functions read only these values, so they can run for different actors in parallel.
+    struct SensingInput
+    {
+        osg::Vec3f mPosition;
+        float mRotZ = 0;
+        osg::Vec3f mHalfExtents;
+        // Movement settings in the actor local space, not multiplied by speed
+        osg::Vec2f mMovement;
+        float mMaxSpeed = 0;
+        bool mIsDead = false;
+        bool mIsMagicallyHidden = false;
+
+        // Head tracking target has to be chosen among nearby actors
+        bool mTrackNearby = false;
+        float mMaxHeadTrackDistance = 0;
+        // Facing direction in world space
+        osg::Vec2f mDirection;
+
+        bool mAvoidCollisions = false;
+        bool mIsMoving = false;
+        bool mTurnToApproachingActor = false;
+        float mTimeToCheck = 0;
+        // Combat or pursue target to not avoid collision with
+        std::optional<std::size_t> mTarget;
+    };
+
+    struct HeadTrackCandidate
+    {
+        float mSqrDistance;
+        std::size_t mIndex;
+    };
+
+    struct CollisionCandidate
+    {
+        float mTime;
+        std::size_t mIndex;
+        float mAngle;
+        osg::Vec2f mMovementCorrection;
+    };
+
+    // How far ahead in time collisions are predicted, actor moving to a destination stops checking when reaches it
+    constexpr float maxTimeToCheckCollisions = 2.0f;
+
+    /// Finds actors in front of the actor within head tracking distance ordered by distance. Line of sight and
+    /// awareness are not checked as they can't be called from multiple threads.
+    void findHeadTrackCandidates(std::size_t index, std::span<const SensingInput> inputs,
+        const Misc::SpatialGrid<std::size_t>& grid, std::vector<HeadTrackCandidate>& out);
+
+    /// Predicts collisions with nearby actors ordered by time to collision. Line of sight and awareness are not
+    /// checked as they can't be called from multiple threads.
+    void predictCollisions(std::size_t index, std::span<const SensingInput> inputs,
+        const Misc::SpatialGrid<std::size_t>& grid, std::vector<CollisionCandidate>& out);
+}
+
+#endif
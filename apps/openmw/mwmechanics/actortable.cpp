@@ -0,0 +1,69 @@
+#include "actortable.hpp"
+
+#include <cassert>
+#include <memory>
+
+#include "../mwworld/ptr.hpp"
+
+namespace MWMechanics
+{
+    ActorTable::Index ActorTable::emplace(const MWWorld::Ptr& ptr, MWRender::Animation* animation)
+    {
+        assert(!mIndex.contains(ptr.mRef));
+
+        const Index index = mActors.emplace(std::make_unique<Actor>(ptr, animation));
+
+        if (index == mPositions.size())
+        {
+            mPositions.push_back(ptr.getRefData().getPosition().asVec3());
+            mRefs.push_back(ptr.mRef);
+        }
+        else
+        {
+            mPositions[index] = ptr.getRefData().getPosition().asVec3();
+            mRefs[index] = ptr.mRef;
+        }
+
+        mIndex.emplace(ptr.mRef, index);
+
+        return index;
+    }
+
+    void ActorTable::erase(Index index)
+    {
+        assert(isUsed(index));
+        mIndex.erase(mRefs[index]);
+        mActors.erase(index);
+        mRefs[index] = nullptr;
+    }
+
+    void ActorTable::clear()
+    {
+        mIndex.clear();
+        mRefs.clear();
+        mPositions.clear();
+        mActors.clear();
+    }
+
+    std::optional<ActorTable::Index> ActorTable::findIndex(const MWWorld::Ptr& ptr) const
+    {
+        const auto it = mIndex.find(ptr.mRef);
+        if (it == mIndex.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    Actor* ActorTable::search(const MWWorld::Ptr& ptr) const
+    {
+        const auto it = mIndex.find(ptr.mRef);
+        if (it == mIndex.end())
+            return nullptr;
+        return mActors.get(it->second);
+    }
+
+    void ActorTable::updatePositions()
+    {
+        for (auto it = mActors.begin(); it != mActors.end(); ++it)
+            mPositions[it.getIndex()] = it->getPtr().getRefData().getPosition().asVec3();
+    }
+}
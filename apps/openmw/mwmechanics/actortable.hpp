@@ -0,0 +1,81 @@
+#ifndef GAME_MWMECHANICS_ACTORTABLE_H
+#define GAME_MWMECHANICS_ACTORTABLE_H
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <osg/Vec3f>
+
+#include "actor.hpp"
+#include "slottable.hpp"
+
+namespace MWRender
+{
+    class Animation;
+}
+
+namespace MWWorld
+{
+    class LiveCellRefBase;
+    class Ptr;
+}
+
+namespace MWMechanics
+{
+    /// @brief Stores registered actors in a SlotTable, so actor update order follows slot indices and not the order
+    /// actors were added in. Data read for every actor each frame is stored in separate arrays indexed by slot, so
+    /// passes over all actors don't have to dereference Ptr of each of them.
+    class ActorTable
+    {
+    public:
+        using Index = SlotTable<Actor>::Index;
+        using iterator = SlotTable<Actor>::iterator;
+        using const_iterator = SlotTable<Actor>::const_iterator;
+
+        iterator begin() { return mActors.begin(); }
+        std::default_sentinel_t end() { return mActors.end(); }
+
+        const_iterator begin() const { return mActors.begin(); }
+        std::default_sentinel_t end() const { return mActors.end(); }
+
+        std::size_t size() const { return mActors.size(); }
+
+        /// Upper bound for slot indices
+        std::size_t getSlotsCount() const { return mActors.getSlotsCount(); }
+
+        bool isUsed(Index index) const { return mActors.isUsed(index); }
+
+        Actor& operator[](Index index) { return mActors[index]; }
+        const Actor& operator[](Index index) const { return mActors[index]; }
+
+        Index emplace(const MWWorld::Ptr& ptr, MWRender::Animation* animation);
+
+        void erase(Index index);
+
+        void clear();
+
+        std::optional<Index> findIndex(const MWWorld::Ptr& ptr) const;
+
+        /// Returns nullptr if there is no actor for the given Ptr. Actor state is not a part of the table state, so
+        /// it's mutable like it would be for a container of pointers.
+        Actor* search(const MWWorld::Ptr& ptr) const;
+
+        /// Copies positions of all actors from their references, should be called once per frame before actors
+        /// are processed
+        void updatePositions();
+
+        /// Position at the time of the last updatePositions call or emplace
+        const osg::Vec3f& getPosition(Index index) const { return mPositions[index]; }
+
+    private:
+        SlotTable<Actor> mActors;
+        std::vector<osg::Vec3f> mPositions;
+        std::vector<const MWWorld::LiveCellRefBase*> mRefs;
+        std::unordered_map<const MWWorld::LiveCellRefBase*, Index> mIndex;
+    };
+}
+
+#endif
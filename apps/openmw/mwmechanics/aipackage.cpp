@@ -160,6 +160,13 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
     const bool isDestReached = (distToTarget <= destTolerance);
     const bool actorCanMoveByZ = canActorMoveByZAxis(actor);
 
+    if (mPathFinder.isPathRequested())
+    {
+        const ESM::Pathgrid* pathgrid = world->getStore().get<ESM::Pathgrid>().search(*actor.getCell()->getCell());
+        if (mPathFinder.updateRequestedPath(actor, getPathGridGraph(pathgrid)))
+            onPathBuilt(position, dest, mRequestedPathDestInLOS);
+    }
+
     if (!isDestReached && timerStatus == Misc::TimerStatus::Elapsed)
     {
         if (canOpenDoors(actor))
@@ -180,23 +187,20 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
                     = world->getStore().get<ESM::Pathgrid>().search(*actor.getCell()->getCell());
                 const DetourNavigator::Flags navigatorFlags = getNavigatorFlags(actor);
                 const DetourNavigator::AreaCosts areaCosts = getAreaCosts(actor, navigatorFlags);
-                mPathFinder.buildLimitedPath(actor, position, dest, actor.getCell(), getPathGridGraph(pathgrid),
-                    agentBounds, navigatorFlags, areaCosts, endTolerance, pathType);
-                mRotateOnTheRunChecks = 3;
-
-                // give priority to go directly on target if there is minimal opportunity
-                if (destInLOS && mPathFinder.getPath().size() > 1)
+                if (world->getNavigator()->getSettings().mAsyncPathFinderThreads == 0)
                 {
-                    // get point just before dest
-                    auto pPointBeforeDest = mPathFinder.getPath().rbegin() + 1;
-
-                    // if start point is closer to the target then last point of path (excluding target itself) then go
-                    // straight on the target
-                    if (distance(position, dest) <= distance(dest, *pPointBeforeDest))
-                    {
-                        mPathFinder.clearPath();
-                        mPathFinder.addPointToPath(dest);
-                    }
+                    mPathFinder.buildLimitedPath(actor, position, dest, actor.getCell(), getPathGridGraph(pathgrid),
+                        agentBounds, navigatorFlags, areaCosts, endTolerance, pathType);
+                    onPathBuilt(position, dest, destInLOS);
+                }
+                else if (!mPathFinder.isPathRequested())
+                {
+                    // Current path is followed until the requested one is found
+                    if (mPathFinder.requestLimitedPath(actor, position, dest, actor.getCell(),
+                            getPathGridGraph(pathgrid), agentBounds, navigatorFlags, areaCosts, endTolerance, pathType))
+                        onPathBuilt(position, dest, destInLOS);
+                    else
+                        mRequestedPathDestInLOS = destInLOS;
                 }
             }
 
@@ -227,7 +231,7 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
 
     mPathFinder.update(position, pointTolerance, DEFAULT_TOLERANCE, updateFlags, agentBounds, getNavigatorFlags(actor));
 
-    if (isDestReached || mPathFinder.checkPathCompleted()) // if path is finished
+    if (isDestReached || (mPathFinder.checkPathCompleted() && !mPathFinder.isPathRequested())) // if path is finished
     {
         // turn to destination point
         zTurn(actor, getZAngleToPoint(position, dest));
@@ -364,6 +368,26 @@ const MWMechanics::PathgridGraph& MWMechanics::AiPackage::getPathGridGraph(const
     return *found->second.get();
 }
 
+void MWMechanics::AiPackage::onPathBuilt(const osg::Vec3f& position, const osg::Vec3f& dest, bool destInLOS)
+{
+    mRotateOnTheRunChecks = 3;
+
+    // give priority to go directly on target if there is minimal opportunity
+    if (destInLOS && mPathFinder.getPath().size() > 1)
+    {
+        // get point just before dest
+        auto pPointBeforeDest = mPathFinder.getPath().rbegin() + 1;
+
+        // if start point is closer to the target then last point of path (excluding target itself) then go
+        // straight on the target
+        if (distance(position, dest) <= distance(dest, *pPointBeforeDest))
+        {
+            mPathFinder.clearPath();
+            mPathFinder.addPointToPath(dest);
+        }
+    }
+}
+
 bool MWMechanics::AiPackage::shortcutPath(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
     const MWWorld::Ptr& actor, bool* destInLOS, bool isPathClear)
 {
@@ -177,9 +177,12 @@ namespace MWMechanics
         bool mShortcutProhibited; // shortcutting may be prohibited after unsuccessful attempt
         osg::Vec3f mShortcutFailPos; // position of last shortcut fail
         float mLastDestinationTolerance = 0;
+        bool mRequestedPathDestInLOS = false;
 
     private:
         bool isNearInactiveCell(osg::Vec3f position);
+
+        void onPathBuilt(const osg::Vec3f& position, const osg::Vec3f& dest, bool destInLOS);
     };
 }
 
@@ -293,7 +293,8 @@ namespace MWMechanics
         mObjects.dropObjects(cellStore);
     }
 
-    void MechanicsManager::update(float duration, bool paused)
+    void MechanicsManager::update(
+        float duration, bool paused, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
     {
         // Note: we should do it here since game mechanics and world updates use these values
         MWWorld::Ptr ptr = getPlayer();
@@ -331,7 +332,7 @@ namespace MWMechanics
             mActors.addActor(ptr, true);
         }
 
-        mActors.update(duration, paused);
+        mActors.update(duration, paused, frameStart, frameNumber, stats);
         mObjects.update(duration, paused);
     }
 
@@ -345,8 +346,10 @@ namespace MWMechanics
                 if (state != MWBase::StateManager::State_Running)
                     continue;
 
-                // Update mechanics for new processing range immediately
-                update(0.f, false);
+                // Update mechanics for new processing range immediately. It's not a part of a frame, so timings are
+                // written into stats which are not collected.
+                const osg::ref_ptr<osg::Stats> stats = new osg::Stats("mechanics");
+                update(0.f, false, osg::Timer::instance()->tick(), 0, *stats);
             }
         }
     }
@@ -57,7 +57,8 @@ namespace MWMechanics
         void drop(const MWWorld::CellStore* cellStore) override;
         ///< Deregister all objects in the given cell.
 
-        void update(float duration, bool paused);
+        void update(
+            float duration, bool paused, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats);
         ///< Update objects
         ///
         /// \param paused In game type does not currently advance (this usually means some GUI
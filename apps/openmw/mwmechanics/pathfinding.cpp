@@ -101,6 +101,37 @@ namespace
         return checkAngle && checkDist;
     }
 
+    // Returns status to handle the path by the caller
+    DetourNavigator::Status checkNavigatorStatus(const MWWorld::ConstPtr& actor, DetourNavigator::Status status,
+        const osg::Vec3f& startPoint, const osg::Vec3f& endPoint, DetourNavigator::Flags flags,
+        MWMechanics::PathType pathType)
+    {
+        if (pathType == MWMechanics::PathType::Partial && status == DetourNavigator::Status::PartialPath)
+            return DetourNavigator::Status::Success;
+
+        if (status != DetourNavigator::Status::Success)
+        {
+            Log(Debug::Debug) << "Build path by navigator error: \"" << DetourNavigator::getMessage(status)
+                              << "\" for \"" << actor.getClass().getName(actor) << "\" (" << actor.getBase()
+                              << ") from " << startPoint << " to " << endPoint << " with flags ("
+                              << DetourNavigator::WriteFlags{ flags } << ")";
+        }
+
+        return status;
+    }
+
+    osg::Vec3f getLimitedPathEnd(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint)
+    {
+        const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
+        const auto maxDistance
+            = std::min(navigator->getMaxNavmeshAreaRealRadius(), static_cast<float>(Constants::CellSizeInUnits));
+        const auto startToEnd = endPoint - startPoint;
+        const auto distance = startToEnd.length();
+        if (distance <= maxDistance)
+            return endPoint;
+        return startPoint + startToEnd * maxDistance / distance;
+    }
+
     struct IsValidShortcut
     {
         const DetourNavigator::Navigator* mNavigator;
@@ -151,7 +182,7 @@ namespace MWMechanics
      *
      * NOTE: startPoint & endPoint are in world coordinates
      *
-     * Updates mPath using aStarSearch() or ray test (if shortcut allowed).
+     * Updates mPath using findPath() or ray test (if shortcut allowed).
      * mPath consists of pathgrid points, except the last element which is
      * endPoint.  This may be useful where the endPoint is not on a pathgrid
      * point (e.g. combat).  However, if the caller has already chosen a
@@ -217,8 +248,6 @@ namespace MWMechanics
         // AiWander has logic that depends on whether a path was created,
         // deleting allowed nodes if not.  Hence a path needs to be created
         // even if the start and the end points are the same.
-        // NOTE: aStarSearch will return an empty path if the start and end
-        //       nodes are the same
         if (startNode == endNode.first)
         {
             ESM::Pathgrid::Point temp(pathgrid->mPoints[startNode]);
@@ -227,7 +256,7 @@ namespace MWMechanics
         }
         else
         {
-            auto path = pathgridGraph.aStarSearch(startNode, endNode.first);
+            auto path = pathgridGraph.findPath(startNode, endNode.first);
 
             // If nearest path node is in opposite direction from second, remove it from path.
             // Especially useful for wandering actors, if the nearest node is blocked for some reason.
@@ -354,6 +383,7 @@ namespace MWMechanics
 
     void PathFinder::buildStraightPath(const osg::Vec3f& endPoint)
     {
+        mRequestedPath.reset();
         mPath.clear();
         mPath.push_back(endPoint);
         mConstructed = true;
@@ -362,6 +392,7 @@ namespace MWMechanics
     void PathFinder::buildPathByPathgrid(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
         const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph)
     {
+        mRequestedPath.reset();
         mPath.clear();
         mCell = cell;
 
@@ -374,6 +405,7 @@ namespace MWMechanics
         const osg::Vec3f& endPoint, const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
+        mRequestedPath.reset();
         mPath.clear();
 
         // If it's not possible to build path over navmesh due to disabled navmesh generation fallback to straight path
@@ -394,6 +426,7 @@ namespace MWMechanics
         const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
+        mRequestedPath.reset();
         mPath.clear();
         mCell = cell;
 
@@ -407,6 +440,15 @@ namespace MWMechanics
                 mPath.clear();
         }
 
+        buildPathFallback(
+            actor, startPoint, endPoint, pathgridGraph, agentBounds, flags, areaCosts, endTolerance, pathType, status);
+    }
+
+    void PathFinder::buildPathFallback(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const PathgridGraph& pathgridGraph, const DetourNavigator::AgentBounds& agentBounds,
+        const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
+        PathType pathType, DetourNavigator::Status status)
+    {
         if (status != DetourNavigator::Status::NavMeshNotFound && mPath.empty()
             && (flags & DetourNavigator::Flag_usePathgrid) == 0)
         {
@@ -436,34 +478,79 @@ namespace MWMechanics
         const auto status = DetourNavigator::findPath(
             *navigator, agentBounds, startPoint, endPoint, flags, areaCosts, endTolerance, out);
 
-        if (pathType == PathType::Partial && status == DetourNavigator::Status::PartialPath)
-            return DetourNavigator::Status::Success;
+        return checkNavigatorStatus(actor, status, startPoint, endPoint, flags, pathType);
+    }
 
-        if (status != DetourNavigator::Status::Success)
+    void PathFinder::buildLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+        const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+        const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
+    {
+        buildPath(actor, startPoint, getLimitedPathEnd(startPoint, endPoint), cell, pathgridGraph, agentBounds, flags,
+            areaCosts, endTolerance, pathType);
+    }
+
+    bool PathFinder::requestPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+        const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+        const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
+    {
+        // Navmesh is not used for such actors so there is nothing to do in background
+        if (actor.getClass().isPureWaterCreature(actor) || actor.getClass().isPureFlyingCreature(actor))
         {
-            Log(Debug::Debug) << "Build path by navigator error: \"" << DetourNavigator::getMessage(status)
-                              << "\" for \"" << actor.getClass().getName(actor) << "\" (" << actor.getBase()
-                              << ") from " << startPoint << " to " << endPoint << " with flags ("
-                              << DetourNavigator::WriteFlags{ flags } << ")";
+            buildPath(actor, startPoint, endPoint, cell, pathgridGraph, agentBounds, flags, areaCosts, endTolerance,
+                pathType);
+            return true;
         }
 
-        return status;
+        const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
+        mRequestedPath = RequestedPath{
+            .mQuery = navigator->requestPath(DetourNavigator::PathRequest{
+                .mAgentBounds = agentBounds,
+                .mStart = startPoint,
+                .mEnd = endPoint,
+                .mIncludeFlags = flags,
+                .mAreaCosts = areaCosts,
+                .mEndTolerance = endTolerance,
+            }),
+            .mCell = cell,
+            .mPathType = pathType,
+        };
+        return false;
     }
 
-    void PathFinder::buildLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+    bool PathFinder::requestLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
         const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
         const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
-        const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
-        const auto maxDistance
-            = std::min(navigator->getMaxNavmeshAreaRealRadius(), static_cast<float>(Constants::CellSizeInUnits));
-        const auto startToEnd = endPoint - startPoint;
-        const auto distance = startToEnd.length();
-        if (distance <= maxDistance)
-            return buildPath(actor, startPoint, endPoint, cell, pathgridGraph, agentBounds, flags, areaCosts,
-                endTolerance, pathType);
-        const auto end = startPoint + startToEnd * maxDistance / distance;
-        buildPath(actor, startPoint, end, cell, pathgridGraph, agentBounds, flags, areaCosts, endTolerance, pathType);
+        return requestPath(actor, startPoint, getLimitedPathEnd(startPoint, endPoint), cell, pathgridGraph,
+            agentBounds, flags, areaCosts, endTolerance, pathType);
+    }
+
+    bool PathFinder::updateRequestedPath(const MWWorld::ConstPtr& actor, const PathgridGraph& pathgridGraph)
+    {
+        if (!mRequestedPath.has_value() || !mRequestedPath->mQuery->isDone())
+            return false;
+
+        const RequestedPath requestedPath = std::move(*mRequestedPath);
+        mRequestedPath.reset();
+
+        const DetourNavigator::PathRequest& request = requestedPath.mQuery->getRequest();
+        const DetourNavigator::PathResult& result = requestedPath.mQuery->getResult();
+
+        mPath.clear();
+        mCell = requestedPath.mCell;
+
+        const DetourNavigator::Status status = checkNavigatorStatus(
+            actor, result.mStatus, request.mStart, request.mEnd, request.mIncludeFlags, requestedPath.mPathType);
+
+        if (status == DetourNavigator::Status::Success)
+            mPath.assign(result.mPath.begin(), result.mPath.end());
+
+        buildPathFallback(actor, request.mStart, request.mEnd, pathgridGraph, request.mAgentBounds,
+            request.mIncludeFlags, request.mAreaCosts, request.mEndTolerance, requestedPath.mPathType, status);
+
+        return true;
     }
 }
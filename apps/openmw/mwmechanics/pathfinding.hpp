@@ -4,9 +4,11 @@
 #include <cassert>
 #include <deque>
 #include <iterator>
+#include <optional>
 
 #include <components/detournavigator/areatype.hpp>
 #include <components/detournavigator/flags.hpp>
+#include <components/detournavigator/pathquery.hpp>
 #include <components/detournavigator/status.hpp>
 #include <components/esm/position.hpp>
 #include <components/esm3/loadpgrd.hpp>
@@ -18,11 +20,6 @@ namespace MWWorld
     class Ptr;
 }
 
-namespace DetourNavigator
-{
-    struct AgentBounds;
-}
-
 namespace MWMechanics
 {
     class PathgridGraph;
@@ -98,6 +95,7 @@ namespace MWMechanics
             mConstructed = false;
             mPath.clear();
             mCell = nullptr;
+            mRequestedPath.reset();
         }
 
         void buildStraightPath(const osg::Vec3f& endPoint);
@@ -120,6 +118,25 @@ namespace MWMechanics
             const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
             const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
 
+        /// Same as buildPath but the navmesh search is done by a background thread. Current path is kept until
+        /// the result is applied by updateRequestedPath.
+        /// Returns true if path is built immediately because navmesh is not used for the actor.
+        bool requestPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
+            const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+            const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+            const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
+
+        bool requestLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+            const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+            const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+            const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
+
+        /// Replaces path by the result of requestPath if it's ready falling back to pathgrid like buildPath does.
+        /// Returns true if path is replaced.
+        bool updateRequestedPath(const MWWorld::ConstPtr& actor, const PathgridGraph& pathgridGraph);
+
+        bool isPathRequested() const { return mRequestedPath.has_value(); }
+
         /// Remove front point if exist and within tolerance
         void update(const osg::Vec3f& position, float pointTolerance, float destinationTolerance,
             UpdateFlags updateFlags, const DetourNavigator::AgentBounds& agentBounds, DetourNavigator::Flags pathFlags);
@@ -201,9 +218,17 @@ namespace MWMechanics
         }
 
     private:
+        struct RequestedPath
+        {
+            DetourNavigator::SharedPathQuery mQuery;
+            const MWWorld::CellStore* mCell;
+            PathType mPathType;
+        };
+
         bool mConstructed = false;
         std::deque<osg::Vec3f> mPath;
         const MWWorld::CellStore* mCell = nullptr;
+        std::optional<RequestedPath> mRequestedPath;
 
         void buildPathByPathgridImpl(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
             const PathgridGraph& pathgridGraph, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
@@ -212,6 +237,12 @@ namespace MWMechanics
             const osg::Vec3f& startPoint, const osg::Vec3f& endPoint, const DetourNavigator::AgentBounds& agentBounds,
             const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
             PathType pathType, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
+
+        void buildPathFallback(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+            const osg::Vec3f& endPoint, const PathgridGraph& pathgridGraph,
+            const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+            const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType,
+            DetourNavigator::Status status);
     };
 }
 
@@ -1,8 +1,12 @@
 #include "pathgrid.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <list>
+#include <queue>
 #include <set>
+#include <utility>
 
 namespace
 {
@@ -175,6 +179,7 @@ namespace MWMechanics
         : mPathgrid(&pathgrid)
     {
         mGraph.resize(mPathgrid->mPoints.size());
+        mNextPoints.resize(mPathgrid->mPoints.size());
         for (const auto& edge : mPathgrid->mEdges)
         {
             ConnectedPoint neighbour;
@@ -182,6 +187,7 @@ namespace MWMechanics
             // forward path of the edge
             neighbour.index = edge.mV1;
             mGraph[edge.mV0].edges.push_back(neighbour);
+            mGraph[edge.mV1].incomingEdges.push_back(ConnectedPoint{ edge.mV0, neighbour.cost });
             // reverse path of the edge
             // NOTE: These are redundant, ESM already contains the required reverse paths
             // neighbour.index = edge.mV0;
@@ -311,4 +317,78 @@ namespace MWMechanics
         path.push_front(mPathgrid->mPoints[start]);
         return path;
     }
+
+    /*
+     * Paths to the same end point share the tail, so instead of searching for
+     * each start point separately a shortest path tree rooted at the end point
+     * is built once by Dijkstra's algorithm over the reversed edges. It costs
+     * up to twice as much as a single aStarSearch, after that any path to this
+     * end point is reconstructed by following the next points without a search.
+     *
+     * AI packages keep asking for paths to a few points: AiWander goes back
+     * and forth between the allowed nodes, AiTravel and AiEscort follow to the
+     * same destination until it's reached.
+     */
+    const std::vector<std::uint16_t>& PathgridGraph::getNextPoints(const size_t end) const
+    {
+        std::vector<std::uint16_t>& nextPoints = mNextPoints[end];
+        if (!nextPoints.empty())
+            return nextPoints;
+
+        const size_t graphSize = mGraph.size();
+        nextPoints.resize(graphSize, sNoPoint);
+        std::vector<float> cost(graphSize, std::numeric_limits<float>::max());
+        using Entry = std::pair<float, size_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+
+        cost[end] = 0;
+        queue.emplace(0.0f, end);
+
+        while (!queue.empty())
+        {
+            const auto [currentCost, current] = queue.top();
+            queue.pop();
+
+            if (currentCost > cost[current])
+                continue; // already reached with a lower cost
+
+            // edges are directed, the tree is built from the end point so they're followed backwards
+            for (const auto& edge : mGraph[current].incomingEdges)
+            {
+                const float tentative = currentCost + edge.cost;
+                if (tentative < cost[edge.index])
+                {
+                    cost[edge.index] = tentative;
+                    nextPoints[edge.index] = static_cast<std::uint16_t>(current);
+                    queue.emplace(tentative, edge.index);
+                }
+            }
+        }
+
+        return nextPoints;
+    }
+
+    std::deque<ESM::Pathgrid::Point> PathgridGraph::findPath(const size_t start, const size_t end) const
+    {
+        if (mGraph.size() >= sNoPoint)
+            return aStarSearch(start, end);
+
+        std::deque<ESM::Pathgrid::Point> path;
+        if (!isPointConnected(start, end))
+            return path; // there is no path, return an empty path
+
+        const std::vector<std::uint16_t>& nextPoints = getNextPoints(end);
+
+        size_t current = start;
+        path.push_back(mPathgrid->mPoints[current]);
+        while (current != end)
+        {
+            current = nextPoints[current];
+            if (current == sNoPoint)
+                return {}; // for some reason couldn't build a path
+            path.push_back(mPathgrid->mPoints[current]);
+        }
+
+        return path;
+    }
 }
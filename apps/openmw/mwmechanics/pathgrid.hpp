@@ -1,7 +1,9 @@
 #ifndef GAME_MWMECHANICS_PATHGRID_H
 #define GAME_MWMECHANICS_PATHGRID_H
 
+#include <cstdint>
 #include <deque>
+#include <vector>
 
 #include <components/esm3/loadpgrd.hpp>
 
@@ -33,6 +35,13 @@ namespace MWMechanics
         // NOTE: if start equals end an empty path is returned
         std::deque<ESM::Pathgrid::Point> aStarSearch(const size_t start, const size_t end) const;
 
+        // same as aStarSearch but follows the shortest path tree towards the end point which is built on the first
+        // search for this end point and kept until the graph is destroyed, so repeated searches don't traverse the
+        // graph. Paths have the same cost but may go through other points when there are several shortest ones.
+        //
+        // NOTE: not thread safe
+        std::deque<ESM::Pathgrid::Point> findPath(const size_t start, const size_t end) const;
+
         static const PathgridGraph sEmpty;
 
     private:
@@ -50,6 +59,7 @@ namespace MWMechanics
         {
             int componentId;
             std::vector<ConnectedPoint> edges; // neighbours
+            std::vector<ConnectedPoint> incomingEdges; // points having this one as a neighbour
         };
 
         // componentId is an integer indicating the groups of connected
@@ -62,6 +72,15 @@ namespace MWMechanics
         //   all other pathgrid points are the third set
         //
         std::vector<Node> mGraph;
+
+        // pathgrid has 16 bit point indices, so the maximum value is never a point
+        static constexpr std::uint16_t sNoPoint = 0xFFFF;
+
+        // mNextPoints[end][v] is the point following v on the shortest path from v to end, empty until the first
+        // findPath call with this end point
+        mutable std::vector<std::vector<std::uint16_t>> mNextPoints;
+
+        const std::vector<std::uint16_t>& getNextPoints(size_t end) const;
     };
 }
 
@@ -0,0 +1,140 @@
+#ifndef GAME_MWMECHANICS_SLOTTABLE_H
+#define GAME_MWMECHANICS_SLOTTABLE_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace MWMechanics
+{
+    /// @brief Stores values in slots. Value keeps its slot index until it's erased and freed slots are reused, so
+    /// iteration order follows slot indices and not the order of insertion. Like with a list, adding or erasing values
+    /// doesn't invalidate iterators to the other values.
+    template <class T>
+    class SlotTable
+    {
+    public:
+        using Index = std::size_t;
+
+        template <class V>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = V*;
+            using reference = V&;
+
+            Iterator() = default;
+
+            Iterator(const SlotTable& table, Index index)
+                : mTable(&table)
+                , mIndex(index)
+            {
+                skipFree();
+            }
+
+            Index getIndex() const { return mIndex; }
+
+            V& operator*() const { return *mTable->mValues[mIndex]; }
+
+            V* operator->() const { return mTable->mValues[mIndex].get(); }
+
+            Iterator& operator++()
+            {
+                ++mIndex;
+                skipFree();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend bool operator==(const Iterator& l, const Iterator& r) = default;
+
+            // Values may be added while iterating, end is checked against the current number of slots
+            friend bool operator==(const Iterator& it, std::default_sentinel_t)
+            {
+                return it.mIndex >= it.mTable->getSlotsCount();
+            }
+
+        private:
+            const SlotTable* mTable = nullptr;
+            Index mIndex = 0;
+
+            void skipFree()
+            {
+                while (mIndex < mTable->mValues.size() && mTable->mValues[mIndex] == nullptr)
+                    ++mIndex;
+            }
+        };
+
+        using iterator = Iterator<T>;
+        using const_iterator = Iterator<const T>;
+
+        iterator begin() { return iterator(*this, 0); }
+        std::default_sentinel_t end() { return std::default_sentinel; }
+
+        const_iterator begin() const { return const_iterator(*this, 0); }
+        std::default_sentinel_t end() const { return std::default_sentinel; }
+
+        std::size_t size() const { return mSize; }
+
+        /// Upper bound for slot indices
+        std::size_t getSlotsCount() const { return mValues.size(); }
+
+        bool isUsed(Index index) const { return mValues[index] != nullptr; }
+
+        T& operator[](Index index) { return *mValues[index]; }
+        const T& operator[](Index index) const { return *mValues[index]; }
+
+        /// Returns nullptr for a free slot. Values are stored by pointer, so like with a container of pointers
+        /// constness of the table doesn't apply to them.
+        T* get(Index index) const { return mValues[index].get(); }
+
+        /// Returns index of the slot taken by the value, the most recently freed slot is reused first
+        Index emplace(std::unique_ptr<T> value)
+        {
+            assert(value != nullptr);
+            ++mSize;
+            if (mFreeSlots.empty())
+            {
+                mValues.push_back(std::move(value));
+                return mValues.size() - 1;
+            }
+            const Index index = mFreeSlots.back();
+            mFreeSlots.pop_back();
+            mValues[index] = std::move(value);
+            return index;
+        }
+
+        void erase(Index index)
+        {
+            assert(isUsed(index));
+            mValues[index] = nullptr;
+            mFreeSlots.push_back(index);
+            --mSize;
+        }
+
+        void clear()
+        {
+            mFreeSlots.clear();
+            mValues.clear();
+            mSize = 0;
+        }
+
+    private:
+        std::vector<std::unique_ptr<T>> mValues;
+        std::vector<Index> mFreeSlots;
+        std::size_t mSize = 0;
+    };
+}
+
+#endif
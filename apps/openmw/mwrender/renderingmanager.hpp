@@ -50,6 +50,7 @@ namespace ESM
 namespace Terrain
 {
     class World;
+    class ChunkDiskCache;
 }
 
 namespace Fallback
@@ -113,7 +114,7 @@ namespace MWRender
         RenderingManager(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode,
             Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
             DetourNavigator::Navigator& navigator, const MWWorld::GroundcoverStore& groundcoverStore,
-            SceneUtil::UnrefQueue& unrefQueue);
+            SceneUtil::UnrefQueue& unrefQueue, std::shared_ptr<const Terrain::ChunkDiskCache> terrainDiskCache);
         ~RenderingManager();
 
         osgUtil::IncrementalCompileOperation* getIncrementalCompileOperation();
@@ -325,6 +326,7 @@ namespace MWRender
         std::unordered_map<ESM::RefId, WorldspaceChunkMgr> mWorldspaceChunks;
         Terrain::World* mTerrain;
         std::unique_ptr<TerrainStorage> mTerrainStorage;
+        std::shared_ptr<const Terrain::ChunkDiskCache> mTerrainDiskCache;
         ObjectPaging* mObjectPaging;
         Groundcover* mGroundcover;
         std::unique_ptr<SkyManager> mSky;
@@ -43,7 +43,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId objectID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId objectID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 // The value of the reset argument doesn't actually matter
@@ -100,7 +100,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId actorID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId actorID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Float duration = runtime[0].mFloat;
@@ -138,7 +138,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId actorID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId actorID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 std::string_view cellID = runtime.getStringLiteral(runtime[0].mInteger);
@@ -329,7 +329,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId actorID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId actorID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Float duration = runtime[0].mFloat;
@@ -367,7 +367,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId actorID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId actorID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 std::string_view cellID = runtime.getStringLiteral(runtime[0].mInteger);
@@ -429,7 +429,7 @@ namespace MWScript
             {
                 MWWorld::Ptr observer = R()(runtime, false); // required=false
 
-                ESM::RefId actorID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId actorID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWWorld::Ptr actor = MWBase::Environment::get().getWorld()->searchPtr(actorID, true, false);
@@ -451,7 +451,7 @@ namespace MWScript
 
                 MWWorld::Ptr source = R()(runtime);
 
-                ESM::RefId actorID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId actorID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWWorld::Ptr dest = MWBase::Environment::get().getWorld()->searchPtr(actorID, true, false);
@@ -471,7 +471,7 @@ namespace MWScript
             void execute(Interpreter::Runtime& runtime) override
             {
                 MWWorld::Ptr actor = R()(runtime);
-                ESM::RefId testedTargetId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId testedTargetId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 bool targetsAreEqual = false;
@@ -503,7 +503,7 @@ namespace MWScript
             void execute(Interpreter::Runtime& runtime) override
             {
                 MWWorld::Ptr actor = R()(runtime);
-                ESM::RefId targetID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId targetID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWWorld::Ptr target = MWBase::Environment::get().getWorld()->searchPtr(targetID, true, false);
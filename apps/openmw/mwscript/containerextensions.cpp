@@ -89,7 +89,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId item = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer count = runtime[0].mInteger;
@@ -191,7 +191,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime, false);
 
-                ESM::RefId item = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (ptr.isEmpty() || (ptr.getType() != ESM::Container::sRecordId && !ptr.getClass().isActor()))
@@ -217,7 +217,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId item = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer count = runtime[0].mInteger;
@@ -312,7 +312,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId item = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWWorld::InventoryStore& invStore = ptr.getClass().getInventoryStore(ptr);
@@ -431,7 +431,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId item = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 const MWWorld::InventoryStore& invStore = ptr.getClass().getInventoryStore(ptr);
@@ -456,7 +456,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId name = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId name = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 int count = 0;
@@ -34,7 +34,7 @@ namespace MWScript
                 if (ptr.isEmpty())
                     ptr = MWBase::Environment::get().getWorld()->getPlayerPtr();
 
-                ESM::RefId quest = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId quest = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer index = runtime[0].mInteger;
@@ -58,7 +58,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId quest = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId quest = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer index = runtime[0].mInteger;
@@ -73,7 +73,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId quest = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId quest = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 int index = MWBase::Environment::get().getJournal()->getJournalIndex(quest);
@@ -87,7 +87,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId topic = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId topic = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!MWBase::Environment::get().getESMStore()->get<ESM::Dialogue>().search(topic))
@@ -224,10 +224,10 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId faction1 = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId faction1 = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
-                ESM::RefId faction2 = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId faction2 = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 int modReaction = runtime[0].mInteger;
@@ -242,10 +242,10 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId faction1 = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId faction1 = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
-                ESM::RefId faction2 = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId faction2 = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 runtime.push(MWBase::Environment::get().getDialogueManager()->getFactionReaction(faction1, faction2));
@@ -257,10 +257,10 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId faction1 = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId faction1 = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
-                ESM::RefId faction2 = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId faction2 = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 int newValue = runtime[0].mInteger;
@@ -184,7 +184,7 @@ namespace MWScript
             void execute(Interpreter::Runtime& runtime) override
             {
                 MWWorld::Ptr target = R()(runtime, false);
-                ESM::RefId name = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId name = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!MWBase::Environment::get().getESMStore()->get<ESM::Script>().search(name))
@@ -203,7 +203,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId& name = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& name = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
                 runtime.push(MWBase::Environment::get().getScriptManager()->getGlobalScripts().isRunning(name));
             }
@@ -214,7 +214,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId& name = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& name = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!MWBase::Environment::get().getESMStore()->get<ESM::Script>().search(name))
@@ -626,10 +626,10 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId creature = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId creature = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
-                ESM::RefId gem = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId gem = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!ptr.getClass().isActor())
@@ -658,7 +658,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId soul = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId soul = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 // throw away additional arguments
@@ -689,7 +689,7 @@ namespace MWScript
 
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId item = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer amount = runtime[0].mInteger;
@@ -780,7 +780,7 @@ namespace MWScript
 
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId soul = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId soul = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!ptr.getClass().isActor())
@@ -856,7 +856,7 @@ namespace MWScript
             void execute(Interpreter::Runtime& runtime) override
             {
                 MWWorld::Ptr ptr = R()(runtime);
-                ESM::RefId id = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId id = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!ptr.getClass().isActor())
@@ -1009,7 +1009,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId objectID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId objectID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
@@ -1028,7 +1028,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId objectID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId objectID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
@@ -1075,7 +1075,7 @@ namespace MWScript
 
                 if (!ptr.isEmpty())
                 {
-                    ESM::RefId script = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    ESM::RefId script = runtime.getRefIdLiteral(runtime[0].mInteger);
                     if (!script.empty())
                     {
                         const Compiler::Locals& locals
@@ -1248,10 +1248,10 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId spellId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId spellId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
-                ESM::RefId targetId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId targetId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 const ESM::Spell* spell = MWBase::Environment::get().getESMStore()->get<ESM::Spell>().search(spellId);
@@ -1298,7 +1298,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId spellId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId spellId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 const ESM::Spell* spell = MWBase::Environment::get().getESMStore()->get<ESM::Spell>().search(spellId);
@@ -1516,9 +1516,9 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId& levId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& levId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
-                const ESM::RefId& creatureId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& creatureId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
                 int level = runtime[0].mInteger;
                 runtime.pop();
@@ -1535,9 +1535,9 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId& levId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& levId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
-                const ESM::RefId& creatureId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& creatureId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
                 int level = runtime[0].mInteger;
                 runtime.pop();
@@ -1554,9 +1554,9 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId& levId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& levId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
-                const ESM::RefId& itemId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& itemId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
                 int level = runtime[0].mInteger;
                 runtime.pop();
@@ -1573,9 +1573,9 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId& levId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& levId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
-                const ESM::RefId& itemId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId& itemId = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
                 int level = runtime[0].mInteger;
                 runtime.pop();
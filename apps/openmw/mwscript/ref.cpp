@@ -9,7 +9,7 @@
 
 MWWorld::Ptr MWScript::ExplicitRef::operator()(Interpreter::Runtime& runtime, bool required, bool activeOnly) const
 {
-    ESM::RefId id = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+    ESM::RefId id = runtime.getRefIdLiteral(runtime[0].mInteger);
     runtime.pop();
 
     if (required)
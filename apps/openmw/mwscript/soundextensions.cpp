@@ -76,7 +76,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId sound = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId sound = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWBase::Environment::get().getSoundManager()->playSound(
@@ -89,7 +89,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId sound = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId sound = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Float volume = runtime[0].mFloat;
@@ -111,7 +111,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId sound = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId sound = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWBase::Environment::get().getSoundManager()->playSound3D(ptr, sound, 1.0, 1.0, MWSound::Type::Sfx,
@@ -127,7 +127,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId sound = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId sound = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Float volume = runtime[0].mFloat;
@@ -149,7 +149,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId sound = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId sound = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 MWBase::Environment::get().getSoundManager()->stopSound3D(ptr, sound);
@@ -168,7 +168,7 @@ namespace MWScript
                 runtime.pop();
 
                 bool ret = MWBase::Environment::get().getSoundManager()->getSoundPlaying(
-                    ptr, ESM::RefId::stringRefId(runtime.getStringLiteral(index)));
+                    ptr, runtime.getRefIdLiteral(index));
 
                 // GetSoundPlaying called on an equipped item should also look for sounds played by the equipping actor.
                 if (!ret && ptr.getContainerStore())
@@ -179,7 +179,7 @@ namespace MWScript
                         && cont.getClass().getInventoryStore(cont).isEquipped(ptr))
                     {
                         ret = MWBase::Environment::get().getSoundManager()->getSoundPlaying(
-                            cont, ESM::RefId::stringRefId(runtime.getStringLiteral(index)));
+                            cont, runtime.getRefIdLiteral(index));
                     }
                 }
 
@@ -501,7 +501,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId id = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId id = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!ptr.getClass().isActor())
@@ -530,7 +530,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId id = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId id = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (!ptr.getClass().isActor())
@@ -556,7 +556,7 @@ namespace MWScript
             {
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId spellid = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId spellid = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (ptr.getClass().isActor())
@@ -589,7 +589,7 @@ namespace MWScript
 
                 MWWorld::Ptr ptr = R()(runtime);
 
-                ESM::RefId id = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId id = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer value = 0;
@@ -617,7 +617,7 @@ namespace MWScript
                 }
                 else
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 // Make sure this faction exists
@@ -647,7 +647,7 @@ namespace MWScript
                 }
                 else
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 // Make sure this faction exists
@@ -685,7 +685,7 @@ namespace MWScript
                 }
                 else
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 // Make sure this faction exists
@@ -711,7 +711,7 @@ namespace MWScript
                 ESM::RefId factionID;
                 if (arg0 > 0)
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
@@ -788,7 +788,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId id = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId id = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime[0].mInteger = MWBase::Environment::get().getMechanicsManager()->countDeaths(id);
             }
         };
@@ -805,7 +805,7 @@ namespace MWScript
 
                 if (arg0 == 1)
                 {
-                    factionId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionId = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
@@ -836,7 +836,7 @@ namespace MWScript
 
                 if (arg0 == 1)
                 {
-                    factionId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionId = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
@@ -867,7 +867,7 @@ namespace MWScript
 
                 if (arg0 == 1)
                 {
-                    factionId = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionId = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
@@ -922,7 +922,7 @@ namespace MWScript
             {
                 MWWorld::ConstPtr ptr = R()(runtime);
 
-                ESM::RefId race = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId race = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (ptr.getClass().isNpc())
@@ -960,7 +960,7 @@ namespace MWScript
                 ESM::RefId factionID;
                 if (arg0 > 0)
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
@@ -990,7 +990,7 @@ namespace MWScript
                 ESM::RefId factionID;
                 if (arg0 > 0)
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
@@ -1016,7 +1016,7 @@ namespace MWScript
                 ESM::RefId factionID;
                 if (arg0 > 0)
                 {
-                    factionID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                    factionID = runtime.getRefIdLiteral(runtime[0].mInteger);
                     runtime.pop();
                 }
                 else
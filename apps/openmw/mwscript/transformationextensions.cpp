@@ -48,7 +48,7 @@ namespace MWScript
             void execute(Interpreter::Runtime& runtime) override
             {
                 MWWorld::Ptr from = R()(runtime, !R::implicit);
-                ESM::RefId name = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId name = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 if (from.isEmpty())
@@ -505,7 +505,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                const ESM::RefId itemID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                const ESM::RefId itemID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
                 std::string_view cellName = runtime.getStringLiteral(runtime[0].mInteger);
                 runtime.pop();
@@ -547,7 +547,7 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                ESM::RefId itemID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId itemID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Float x = runtime[0].mFloat;
@@ -596,7 +596,7 @@ namespace MWScript
             {
                 MWWorld::Ptr actor = pc ? MWMechanics::getPlayer() : R()(runtime);
 
-                ESM::RefId itemID = ESM::RefId::stringRefId(runtime.getStringLiteral(runtime[0].mInteger));
+                ESM::RefId itemID = runtime.getRefIdLiteral(runtime[0].mInteger);
                 runtime.pop();
 
                 Interpreter::Type_Integer count = runtime[0].mInteger;
@@ -0,0 +1,34 @@
+#include "null_output.hpp"
+
+#include <memory>
+
+namespace MWSound
+{
+    namespace
+    {
+        struct NullBuffer
+        {
+            std::vector<char> mData;
+        };
+    }
+
+    bool Null_Output::init(const std::string& devname, const std::string& hrtfname, HrtfMode hrtfmode)
+    {
+        mInitialized = true;
+        return true;
+    }
+
+    std::pair<Sound_Handle, size_t> Null_Output::loadSound(DecodedSound&& sound)
+    {
+        auto buffer = std::make_unique<NullBuffer>();
+        buffer->mData = std::move(sound.mData);
+        const size_t size = buffer->mData.size();
+        return { buffer.release(), size };
+    }
+
+    size_t Null_Output::unloadSound(Sound_Handle data)
+    {
+        const std::unique_ptr<NullBuffer> buffer(static_cast<NullBuffer*>(data));
+        return buffer == nullptr ? 0 : buffer->mData.size();
+    }
+}
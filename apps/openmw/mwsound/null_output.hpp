@@ -0,0 +1,56 @@
+#ifndef GAME_SOUND_NULL_OUTPUT_H
+#define GAME_SOUND_NULL_OUTPUT_H
+
+#include <string>
+#include <vector>
+
+#include "sound_output.hpp"
+
+namespace MWSound
+{
+    /// Output without an audio device. Keeps buffers in memory and finishes sounds immediately, so the loading
+    /// pipeline can run headless.
+    class Null_Output : public Sound_Output
+    {
+    public:
+        std::vector<std::string> enumerate() override { return {}; }
+        bool init(const std::string& devname, const std::string& hrtfname, HrtfMode hrtfmode) override;
+        void deinit() override { mInitialized = false; }
+
+        std::vector<std::string> enumerateHrtf() override { return {}; }
+
+        std::pair<Sound_Handle, size_t> loadSound(DecodedSound&& sound) override;
+        size_t unloadSound(Sound_Handle data) override;
+
+        bool playSound(Sound* sound, Sound_Handle data, float offset) override { return data != nullptr; }
+        bool playSound3D(Sound* sound, Sound_Handle data, float offset) override { return data != nullptr; }
+        void finishSound(Sound* sound) override {}
+        bool isSoundPlaying(Sound* sound) override { return false; }
+        void updateSound(Sound* sound) override {}
+
+        bool streamSound(DecoderPtr decoder, Stream* sound, bool getLoudnessData = false) override { return true; }
+        bool streamSound3D(DecoderPtr decoder, Stream* sound, bool getLoudnessData) override { return true; }
+        void finishStream(Stream* sound) override {}
+        double getStreamDelay(Stream* sound) override { return 0; }
+        double getStreamOffset(Stream* sound) override { return 0; }
+        float getStreamLoudness(Stream* sound) override { return 0; }
+        bool isStreamPlaying(Stream* sound) override { return false; }
+        void updateStream(Stream* sound) override {}
+
+        void startUpdate() override {}
+        void finishUpdate() override {}
+
+        void updateListener(
+            const osg::Vec3f& pos, const osg::Vec3f& atdir, const osg::Vec3f& updir, Environment env) override
+        {
+        }
+
+        void pauseSounds(int types) override {}
+        void resumeSounds(int types) override {}
+
+        void pauseActiveDevice() override {}
+        void resumeActiveDevice() override {}
+    };
+}
+
+#endif
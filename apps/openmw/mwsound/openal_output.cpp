@@ -13,7 +13,6 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/misc/constants.hpp>
-#include <components/misc/resourcehelpers.hpp>
 #include <components/misc/thread.hpp>
 #include <components/vfs/manager.hpp>
 
@@ -1034,32 +1033,15 @@ namespace MWSound
         return ret;
     }
 
-    std::pair<Sound_Handle, size_t> OpenAL_Output::loadSound(VFS::Path::NormalizedView fname)
+    std::pair<Sound_Handle, size_t> OpenAL_Output::loadSound(DecodedSound&& sound)
     {
         getALError();
 
-        std::vector<char> data;
-        ALenum format = AL_NONE;
-        int srate = 0;
+        std::vector<char> data = std::move(sound.mData);
+        ALenum format = data.empty() ? AL_NONE : getALFormat(sound.mChannels, sound.mType);
+        int srate = sound.mSampleRate;
 
-        try
-        {
-            DecoderPtr decoder = mManager.getDecoder();
-            decoder->open(Misc::ResourceHelpers::correctSoundPath(fname, *decoder->mResourceMgr));
-
-            ChannelConfig chans;
-            SampleType type;
-            decoder->getInfo(&srate, &chans, &type);
-            format = getALFormat(chans, type);
-            if (format)
-                decoder->readAll(data);
-        }
-        catch (std::exception& e)
-        {
-            Log(Debug::Error) << "Failed to load audio from " << fname << ": " << e.what();
-        }
-
-        if (data.empty())
+        if (!format)
         {
             // If we failed to get any usable audio, substitute with silence.
             format = AL_FORMAT_MONO8;
@@ -1586,7 +1568,7 @@ namespace MWSound
     }
 
     OpenAL_Output::OpenAL_Output(SoundManager& mgr)
-        : Sound_Output(mgr)
+        : mManager(mgr)
         , mDevice(nullptr)
         , mContext(nullptr)
         , mListenerPos(0.0f, 0.0f, 0.0f)
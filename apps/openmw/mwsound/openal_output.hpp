@@ -24,6 +24,7 @@ namespace MWSound
 
     class OpenAL_Output : public Sound_Output
     {
+        SoundManager& mManager;
         ALCdevice* mDevice;
         ALCcontext* mContext;
 
@@ -87,7 +88,7 @@ namespace MWSound
 
         std::vector<std::string> enumerateHrtf() override;
 
-        std::pair<Sound_Handle, size_t> loadSound(VFS::Path::NormalizedView fname) override;
+        std::pair<Sound_Handle, size_t> loadSound(DecodedSound&& sound) override;
         size_t unloadSound(Sound_Handle data) override;
 
         bool playSound(Sound* sound, Sound_Handle data, float offset) override;
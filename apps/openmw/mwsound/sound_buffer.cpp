@@ -35,8 +35,9 @@ namespace MWSound
         }
     }
 
-    SoundBufferPool::SoundBufferPool(Sound_Output& output)
+    SoundBufferPool::SoundBufferPool(Sound_Output& output, SoundLoader::MakeDecoder makeDecoder)
         : mOutput(&output)
+        , mLoader(output, std::move(makeDecoder))
         , mBufferCacheMax(Settings::sound().mBufferCacheMax * 1024 * 1024)
         , mBufferCacheMin(
               std::min(static_cast<std::size_t>(Settings::sound().mBufferCacheMin) * 1024 * 1024, mBufferCacheMax))
@@ -77,11 +78,36 @@ namespace MWSound
         if (sfx->getHandle() != nullptr)
             return sfx;
 
-        auto [handle, size] = mOutput->loadSound(sfx->getResourceName());
+        auto [handle, size] = mLoader.load(sfx->getResourceName());
         if (handle == nullptr)
             return {};
 
-        sfx->mHandle = handle;
+        addBuffer(*sfx, handle, size);
+
+        return sfx;
+    }
+
+    Sound_Buffer* SoundBufferPool::requestSfx(Sound_Buffer* sfx, SceneUtil::WorkPriority priority)
+    {
+        if (sfx->getHandle() != nullptr)
+            return sfx;
+
+        if (!mLoader.request(sfx->getResourceName(), priority))
+            return loadSfx(sfx);
+
+        const auto it = std::find_if(mRequestedBuffers.begin(), mRequestedBuffers.end(),
+            [&](const RequestedBuffer& requested) { return requested.mSfx == sfx; });
+        if (it == mRequestedBuffers.end())
+            mRequestedBuffers.push_back(RequestedBuffer{ sfx, priority });
+        else
+            it->mPriority = std::max(it->mPriority, priority);
+
+        return sfx;
+    }
+
+    void SoundBufferPool::addBuffer(Sound_Buffer& sfx, Sound_Handle handle, std::size_t size)
+    {
+        sfx.mHandle = handle;
 
         mBufferCacheSize += size;
         if (mBufferCacheSize > mBufferCacheMax)
@@ -90,12 +116,10 @@ namespace MWSound
             if (!mUnusedBuffers.empty() && mBufferCacheSize > mBufferCacheMax)
                 Log(Debug::Warning) << "No unused sound buffers to free, using " << mBufferCacheSize << " bytes!";
         }
-        mUnusedBuffers.push_front(sfx);
-
-        return sfx;
+        mUnusedBuffers.push_front(&sfx);
     }
 
-    Sound_Buffer* SoundBufferPool::load(const ESM::RefId& soundId)
+    Sound_Buffer* SoundBufferPool::getSfx(const ESM::RefId& soundId)
     {
         if (mBufferNameMap.empty())
         {
@@ -103,37 +127,100 @@ namespace MWSound
                 insertSound(sound.mId, sound);
         }
 
-        Sound_Buffer* sfx;
         const auto it = mBufferNameMap.find(soundId);
         if (it != mBufferNameMap.end())
-            sfx = it->second;
-        else
-        {
-            const ESM::Sound* sound = MWBase::Environment::get().getESMStore()->get<ESM::Sound>().search(soundId);
-            if (sound == nullptr)
-                return {};
-            sfx = insertSound(soundId, *sound);
-        }
+            return it->second;
 
-        return loadSfx(sfx);
+        const ESM::Sound* sound = MWBase::Environment::get().getESMStore()->get<ESM::Sound>().search(soundId);
+        if (sound == nullptr)
+            return nullptr;
+        return insertSound(soundId, *sound);
     }
 
-    Sound_Buffer* SoundBufferPool::load(std::string_view fileName)
+    Sound_Buffer* SoundBufferPool::getSfx(std::string_view fileName)
     {
-        Sound_Buffer* sfx;
         const auto it = mBufferFileNameMap.find(std::string(fileName));
         if (it != mBufferFileNameMap.end())
-            sfx = it->second;
-        else
+            return it->second;
+        return insertSound(fileName);
+    }
+
+    Sound_Buffer* SoundBufferPool::load(const ESM::RefId& soundId)
+    {
+        Sound_Buffer* sfx = getSfx(soundId);
+        if (sfx == nullptr)
+            return nullptr;
+        return loadSfx(sfx);
+    }
+
+    Sound_Buffer* SoundBufferPool::load(std::string_view fileName)
+    {
+        return loadSfx(getSfx(fileName));
+    }
+
+    Sound_Buffer* SoundBufferPool::request(const ESM::RefId& soundId, SceneUtil::WorkPriority priority)
+    {
+        Sound_Buffer* sfx = getSfx(soundId);
+        if (sfx == nullptr)
+            return nullptr;
+        return requestSfx(sfx, priority);
+    }
+
+    Sound_Buffer* SoundBufferPool::request(std::string_view fileName, SceneUtil::WorkPriority priority)
+    {
+        return requestSfx(getSfx(fileName), priority);
+    }
+
+    void SoundBufferPool::update()
+    {
+        if (mRequestedBuffers.empty())
+            return;
+
+        mLoaded.clear();
+        mLoader.update(mLoaded);
+
+        for (const SoundLoader::Loaded& loaded : mLoaded)
         {
-            sfx = insertSound(fileName);
+            if (loaded.mHandle == nullptr)
+            {
+                std::erase_if(mRequestedBuffers, [&](const RequestedBuffer& requested) {
+                    return requested.mSfx->getHandle() == nullptr && requested.mSfx->getResourceName() == loaded.mPath;
+                });
+                continue;
+            }
+            const auto it = std::find_if(
+                mRequestedBuffers.begin(), mRequestedBuffers.end(), [&](const RequestedBuffer& requested) {
+                    return requested.mSfx->getHandle() == nullptr && requested.mSfx->getResourceName() == loaded.mPath;
+                });
+            if (it == mRequestedBuffers.end())
+            {
+                mOutput->unloadSound(loaded.mHandle);
+                continue;
+            }
+            addBuffer(*it->mSfx, loaded.mHandle, loaded.mSize);
         }
 
-        return loadSfx(sfx);
+        // Buffers loaded synchronously meanwhile don't wait for the decoding anymore. Buffers sharing a file with a
+        // buffer that took the decoded sound need to request it again.
+        for (auto it = mRequestedBuffers.begin(); it != mRequestedBuffers.end();)
+        {
+            Sound_Buffer* const sfx = it->mSfx;
+            if (sfx->getHandle() != nullptr)
+                it = mRequestedBuffers.erase(it);
+            else
+            {
+                if (!mLoader.isPending(sfx->getResourceName()))
+                    mLoader.request(sfx->getResourceName(), it->mPriority);
+                ++it;
+            }
+        }
     }
 
     void SoundBufferPool::clear()
     {
+        mLoader.clear();
+        mRequestedBuffers.clear();
+
         for (auto& sfx : mSoundBuffers)
         {
             if (sfx.mHandle)
@@ -5,8 +5,10 @@
 #include <deque>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "sound_output.hpp"
+#include "soundloader.hpp"
 #include <components/esm/refid.hpp>
 
 namespace ESM
@@ -59,7 +61,7 @@ namespace MWSound
     class SoundBufferPool
     {
     public:
-        SoundBufferPool(Sound_Output& output);
+        SoundBufferPool(Sound_Output& output, SoundLoader::MakeDecoder makeDecoder);
 
         SoundBufferPool(const SoundBufferPool&) = delete;
 
@@ -80,6 +82,18 @@ namespace MWSound
         // Lookup for a sound by file name, and ensure it's ready for use.
         Sound_Buffer* load(std::string_view fileName);
 
+        /// Lookup a soundId for its sound data, and request decoding it on the work queue if it's not ready for use.
+        /// Without a work queue it's the same as load.
+        Sound_Buffer* request(const ESM::RefId& soundId, SceneUtil::WorkPriority priority);
+
+        // Lookup for a sound by file name, and request decoding it if it's not ready for use.
+        Sound_Buffer* request(std::string_view fileName, SceneUtil::WorkPriority priority);
+
+        void setWorkQueue(SceneUtil::WorkQueue* workQueue) { mLoader.setWorkQueue(workQueue); }
+
+        /// Makes requested sounds ready for use once they are decoded, to be called every frame.
+        void update();
+
         void use(Sound_Buffer& sfx)
         {
             if (sfx.mUses++ == 0)
@@ -101,7 +115,25 @@ namespace MWSound
     private:
         Sound_Buffer* loadSfx(Sound_Buffer* sfx);
 
+        Sound_Buffer* requestSfx(Sound_Buffer* sfx, SceneUtil::WorkPriority priority);
+
+        void addBuffer(Sound_Buffer& sfx, Sound_Handle handle, std::size_t size);
+
+        Sound_Buffer* getSfx(const ESM::RefId& soundId);
+
+        Sound_Buffer* getSfx(std::string_view fileName);
+
+        struct RequestedBuffer
+        {
+            Sound_Buffer* mSfx;
+            SceneUtil::WorkPriority mPriority;
+        };
+
         Sound_Output* mOutput;
+        SoundLoader mLoader;
+        // Requested buffers waiting for decoding with the highest requested priority
+        std::vector<RequestedBuffer> mRequestedBuffers;
+        std::vector<SoundLoader::Loaded> mLoaded;
         std::deque<Sound_Buffer> mSoundBuffers;
         std::unordered_map<ESM::RefId, Sound_Buffer*> mBufferNameMap;
         std::unordered_map<std::string, Sound_Buffer*> mBufferFileNameMap;
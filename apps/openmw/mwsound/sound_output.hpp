@@ -10,6 +10,8 @@
 
 #include "../mwbase/soundmanager.hpp"
 
+#include "sound_decoder.hpp"
+
 namespace MWSound
 {
     class SoundManager;
@@ -30,17 +32,25 @@ namespace MWSound
 
     using HrtfMode = Settings::HrtfMode;
 
-    class Sound_Output
+    // Sound data decoded from a file, empty when decoding failed.
+    struct DecodedSound
     {
-        SoundManager& mManager;
+        std::vector<char> mData;
+        int mSampleRate = 0;
+        ChannelConfig mChannels = ChannelConfig_Mono;
+        SampleType mType = SampleType_UInt8;
+    };
 
+    class Sound_Output
+    {
         virtual std::vector<std::string> enumerate() = 0;
         virtual bool init(const std::string& devname, const std::string& hrtfname, HrtfMode hrtfmode) = 0;
         virtual void deinit() = 0;
 
         virtual std::vector<std::string> enumerateHrtf() = 0;
 
-        virtual std::pair<Sound_Handle, size_t> loadSound(VFS::Path::NormalizedView fname) = 0;
+        // Creates a buffer from the decoded data, called from the main thread.
+        virtual std::pair<Sound_Handle, size_t> loadSound(DecodedSound&& sound) = 0;
         virtual size_t unloadSound(Sound_Handle data) = 0;
 
         virtual bool playSound(Sound* sound, Sound_Handle data, float offset) = 0;
@@ -77,9 +87,8 @@ namespace MWSound
     protected:
         bool mInitialized;
 
-        Sound_Output(SoundManager& mgr)
-            : mManager(mgr)
-            , mInitialized(false)
+        Sound_Output()
+            : mInitialized(false)
         {
         }
 
@@ -89,8 +98,10 @@ namespace MWSound
         bool isInitialized() const { return mInitialized; }
 
         friend class OpenAL_Output;
+        friend class Null_Output;
         friend class SoundManager;
         friend class SoundBufferPool;
+        friend class SoundLoader;
     };
 }
 
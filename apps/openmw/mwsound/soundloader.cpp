@@ -0,0 +1,160 @@
+#include "soundloader.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/resourcehelpers.hpp>
+
+#include <atomic>
+#include <exception>
+
+namespace MWSound
+{
+    DecodedSound decodeSound(Sound_Decoder& decoder, VFS::Path::NormalizedView path)
+    {
+        DecodedSound result;
+        try
+        {
+            decoder.open(Misc::ResourceHelpers::correctSoundPath(path, *decoder.mResourceMgr));
+            decoder.getInfo(&result.mSampleRate, &result.mChannels, &result.mType);
+            decoder.readAll(result.mData);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to load audio from " << path << ": " << e.what();
+            result.mData.clear();
+        }
+        return result;
+    }
+
+    class SoundLoader::DecodeItem : public SceneUtil::WorkItem
+    {
+    public:
+        DecodeItem(DecoderPtr decoder, VFS::Path::NormalizedView path, SceneUtil::WorkPriority priority)
+            : mDecoder(std::move(decoder))
+            , mPath(path)
+            , mPriority(priority)
+        {
+        }
+
+        void doWork() override
+        {
+            if (!start())
+                return;
+            mSound = decodeSound(*mDecoder, mPath);
+            mDecoder = nullptr;
+        }
+
+        /// Returns the decoder if decoding is not started yet, the item does nothing after that.
+        DecoderPtr take()
+        {
+            if (!start())
+                return nullptr;
+            cancel();
+            return std::move(mDecoder);
+        }
+
+        SceneUtil::WorkPriority getPriority() const { return mPriority; }
+
+        DecodedSound& getSound() { return mSound; }
+
+    private:
+        DecoderPtr mDecoder;
+        VFS::Path::Normalized mPath;
+        SceneUtil::WorkPriority mPriority;
+        DecodedSound mSound;
+        std::atomic_bool mStarted{ false };
+
+        bool start()
+        {
+            bool expected = false;
+            return mStarted.compare_exchange_strong(expected, true);
+        }
+    };
+
+    SoundLoader::SoundLoader(Sound_Output& output, MakeDecoder makeDecoder)
+        : mOutput(&output)
+        , mMakeDecoder(std::move(makeDecoder))
+    {
+    }
+
+    SoundLoader::~SoundLoader()
+    {
+        clear();
+    }
+
+    void SoundLoader::setWorkQueue(SceneUtil::WorkQueue* workQueue)
+    {
+        clear();
+        mWorkQueue = workQueue;
+    }
+
+    std::pair<Sound_Handle, std::size_t> SoundLoader::load(VFS::Path::NormalizedView path)
+    {
+        const auto it = mPending.find(path);
+        if (it == mPending.end())
+            return mOutput->loadSound(decodeSound(*mMakeDecoder(), path));
+
+        const osg::ref_ptr<DecodeItem> item = std::move(it->second);
+        mPending.erase(it);
+        // Item may be queued behind many others with higher priority, so don't wait for it to start
+        if (const DecoderPtr decoder = item->take())
+            return mOutput->loadSound(decodeSound(*decoder, path));
+        item->waitTillDone();
+        return mOutput->loadSound(std::move(item->getSound()));
+    }
+
+    bool SoundLoader::request(VFS::Path::NormalizedView path, SceneUtil::WorkPriority priority)
+    {
+        if (mWorkQueue == nullptr)
+            return false;
+
+        const auto it = mPending.lower_bound(path);
+        if (it != mPending.end() && it->first == path)
+        {
+            if (priority <= it->second->getPriority())
+                return true;
+            // Replace the item not started yet to not wait for the lower priority items
+            DecoderPtr decoder = it->second->take();
+            if (decoder == nullptr)
+                return true;
+            it->second = new DecodeItem(std::move(decoder), path, priority);
+            mWorkQueue->addWorkItem(it->second, priority);
+            return true;
+        }
+
+        osg::ref_ptr<DecodeItem> item = new DecodeItem(mMakeDecoder(), path, priority);
+        mPending.emplace_hint(it, path, item);
+        mWorkQueue->addWorkItem(std::move(item), priority);
+        return true;
+    }
+
+    std::optional<SceneUtil::WorkPriority> SoundLoader::getPriority(VFS::Path::NormalizedView path) const
+    {
+        const auto it = mPending.find(path);
+        if (it == mPending.end())
+            return std::nullopt;
+        return it->second->getPriority();
+    }
+
+    void SoundLoader::update(std::vector<Loaded>& loaded)
+    {
+        for (auto it = mPending.begin(); it != mPending.end();)
+        {
+            if (!it->second->isDone())
+            {
+                ++it;
+                continue;
+            }
+            const auto [handle, size] = mOutput->loadSound(std::move(it->second->getSound()));
+            loaded.push_back(Loaded{ it->first, handle, size });
+            it = mPending.erase(it);
+        }
+    }
+
+    void SoundLoader::clear()
+    {
+        // Work items own their decoders and results, so they can finish after the loader is gone
+        for (const auto& [path, item] : mPending)
+            item->cancel();
+        mPending.clear();
+    }
+}
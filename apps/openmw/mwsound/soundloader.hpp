@@ -0,0 +1,81 @@
+#ifndef GAME_SOUND_SOUNDLOADER_H
+#define GAME_SOUND_SOUNDLOADER_H
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <osg/ref_ptr>
+
+#include <components/sceneutil/workqueue.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include "sound_output.hpp"
+
+namespace MWSound
+{
+    /// Reads the whole sound file, returns empty data on failure.
+    DecodedSound decodeSound(Sound_Decoder& decoder, VFS::Path::NormalizedView path);
+
+    /// \brief Loads sound files into the output buffers
+    ///
+    /// Decoding is the expensive part of loading a sound and may happen on a work queue, only creating the output
+    /// buffer has to be done on the main thread.
+    class SoundLoader
+    {
+    public:
+        using MakeDecoder = std::function<DecoderPtr()>;
+
+        struct Loaded
+        {
+            VFS::Path::Normalized mPath;
+            Sound_Handle mHandle;
+            std::size_t mSize;
+        };
+
+        SoundLoader(Sound_Output& output, MakeDecoder makeDecoder);
+
+        SoundLoader(const SoundLoader&) = delete;
+
+        ~SoundLoader();
+
+        /// Without a work queue sounds are decoded only by load.
+        void setWorkQueue(SceneUtil::WorkQueue* workQueue);
+
+        bool hasWorkQueue() const { return mWorkQueue != nullptr; }
+
+        /// Decodes the sound on the calling thread or waits for the already started decoding.
+        std::pair<Sound_Handle, std::size_t> load(VFS::Path::NormalizedView path);
+
+        /// Requests decoding on the work queue unless it's already requested with the same or higher priority.
+        /// @return false if there is no work queue.
+        bool request(VFS::Path::NormalizedView path, SceneUtil::WorkPriority priority);
+
+        bool isPending(VFS::Path::NormalizedView path) const { return mPending.contains(path); }
+
+        /// Priority of the pending request, nullopt if there is none.
+        std::optional<SceneUtil::WorkPriority> getPriority(VFS::Path::NormalizedView path) const;
+
+        std::size_t getPendingCount() const { return mPending.size(); }
+
+        /// Creates output buffers for the decoded sounds and appends them to loaded, to be called from the main
+        /// thread. Handle is nullptr when the output failed to create a buffer.
+        void update(std::vector<Loaded>& loaded);
+
+        /// Cancels all requests.
+        void clear();
+
+    private:
+        class DecodeItem;
+
+        Sound_Output* mOutput;
+        MakeDecoder mMakeDecoder;
+        osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
+        std::map<VFS::Path::Normalized, osg::ref_ptr<DecodeItem>, std::less<>> mPending;
+    };
+}
+
+#endif
@@ -3,11 +3,15 @@
 #include <algorithm>
 #include <map>
 #include <numeric>
+#include <set>
 #include <sstream>
 
 #include <osg/Matrixf>
 
 #include <components/debug/debuglog.hpp>
+#include <components/esm3/loadcrea.hpp>
+#include <components/esm3/loadregn.hpp>
+#include <components/esm3/loadsndg.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/rng.hpp>
 #include <components/settings/values.hpp>
@@ -41,6 +45,8 @@ namespace MWSound
         constexpr float sSfxFadeInDuration = 1.0f;
         constexpr float sSfxFadeOutDuration = 1.0f;
         constexpr float sSoundCullDistance = 2000.f;
+        // Sounds which are not decoded in time are dropped, starting them later would be out of sync with the game
+        constexpr float sMaxPendingSoundDelay = 0.25f;
 
         WaterSoundUpdaterSettings makeWaterSoundUpdaterSettings()
         {
@@ -109,11 +115,11 @@ namespace MWSound
         return static_cast<int>(a) | static_cast<int>(b);
     }
 
-    SoundManager::SoundManager(const VFS::Manager* vfs, bool useSound)
+    SoundManager::SoundManager(const VFS::Manager* vfs, bool useSound, SceneUtil::WorkQueue* workQueue)
         : mVFS(vfs)
         , mOutput(std::make_unique<OpenAL_Output>(*this))
         , mWaterSoundUpdater(makeWaterSoundUpdaterSettings())
-        , mSoundBuffers(*mOutput)
+        , mSoundBuffers(*mOutput, [this] { return getDecoder(); })
         , mMusicType(MWSound::MusicType::Normal)
         , mListenerUnderwater(false)
         , mListenerPos(0, 0, 0)
@@ -138,6 +144,9 @@ namespace MWSound
             return;
         }
 
+        if (Settings::sound().mAsyncLoading)
+            mSoundBuffers.setWorkQueue(workQueue);
+
         std::vector<std::string> names = mOutput->enumerate();
         std::stringstream stream;
 
@@ -572,21 +581,36 @@ namespace MWSound
     Sound* SoundManager::playSound3D(const MWWorld::ConstPtr& ptr, const ESM::RefId& soundId, float volume, float pitch,
         Type type, PlayMode mode, float offset)
     {
-        if (remove3DSoundAtDistance(mode, ptr))
+        if (!mOutput->isInitialized() || remove3DSoundAtDistance(mode, ptr))
             return nullptr;
 
-        // Look up the sound in the ESM data
-        Sound_Buffer* sfx = mSoundBuffers.load(soundId);
+        // Look up the sound in the ESM data. Looping sounds are loaded immediately since their callers keep them.
+        Sound_Buffer* sfx = (mode & PlayMode::Loop) ? mSoundBuffers.load(soundId)
+                                                    : mSoundBuffers.request(soundId, SceneUtil::WorkPriority::High);
         if (!sfx)
             return nullptr;
 
+        if (sfx->getHandle() == nullptr)
+        {
+            queueSound3D(PendingSound{ .mPtr = ptr,
+                .mSoundId = soundId,
+                .mFileName = {},
+                .mSfx = sfx,
+                .mVolume = volume,
+                .mPitch = pitch,
+                .mType = type,
+                .mMode = mode,
+                .mOffset = offset });
+            return nullptr;
+        }
+
         return playSound3D(ptr, sfx, volume, pitch, type, mode, offset);
     }
 
     Sound* SoundManager::playSound3D(const MWWorld::ConstPtr& ptr, std::string_view fileName, float volume, float pitch,
         Type type, PlayMode mode, float offset)
     {
-        if (remove3DSoundAtDistance(mode, ptr))
+        if (!mOutput->isInitialized() || remove3DSoundAtDistance(mode, ptr))
             return nullptr;
 
         // Look up the sound
@@ -594,10 +618,26 @@ namespace MWSound
         if (!mVFS->exists(normalizedName))
             return nullptr;
 
-        Sound_Buffer* sfx = mSoundBuffers.load(normalizedName);
+        Sound_Buffer* sfx = (mode & PlayMode::Loop)
+            ? mSoundBuffers.load(normalizedName)
+            : mSoundBuffers.request(normalizedName, SceneUtil::WorkPriority::High);
         if (!sfx)
             return nullptr;
 
+        if (sfx->getHandle() == nullptr)
+        {
+            queueSound3D(PendingSound{ .mPtr = ptr,
+                .mSoundId = {},
+                .mFileName = std::move(normalizedName),
+                .mSfx = sfx,
+                .mVolume = volume,
+                .mPitch = pitch,
+                .mType = type,
+                .mMode = mode,
+                .mOffset = offset });
+            return nullptr;
+        }
+
         return playSound3D(ptr, sfx, volume, pitch, type, mode, offset);
     }
 
@@ -636,6 +676,82 @@ namespace MWSound
         return result;
     }
 
+    void SoundManager::queueSound3D(PendingSound&& sound)
+    {
+        // Only one copy of given sound can be played at time on ptr, so replace previous request
+        const auto it = std::find_if(mPendingSounds.begin(), mPendingSounds.end(), [&](const PendingSound& v) {
+            return v.mPtr.mRef == sound.mPtr.mRef && v.mSfx == sound.mSfx;
+        });
+        if (it != mPendingSounds.end())
+            *it = std::move(sound);
+        else
+            mPendingSounds.push_back(std::move(sound));
+    }
+
+    void SoundManager::updatePendingSounds(float duration)
+    {
+        mSoundBuffers.update();
+
+        for (auto it = mPendingSounds.begin(); it != mPendingSounds.end();)
+        {
+            it->mWaitTime += duration;
+            if (it->mSfx->getHandle() != nullptr)
+            {
+                const PendingSound sound = std::move(*it);
+                it = mPendingSounds.erase(it);
+                playSound3D(
+                    sound.mPtr, sound.mSfx, sound.mVolume, sound.mPitch, sound.mType, sound.mMode, sound.mOffset);
+            }
+            else if (it->mWaitTime > sMaxPendingSoundDelay)
+                it = mPendingSounds.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    template <class Predicate>
+    bool SoundManager::hasPendingSound(const MWWorld::ConstPtr& ptr, Predicate&& predicate) const
+    {
+        return std::any_of(mPendingSounds.begin(), mPendingSounds.end(),
+            [&](const PendingSound& sound) { return sound.mPtr.mRef == ptr.mRef && predicate(sound); });
+    }
+
+    template <class Predicate>
+    void SoundManager::removePendingSounds(Predicate&& predicate)
+    {
+        mPendingSounds.erase(
+            std::remove_if(mPendingSounds.begin(), mPendingSounds.end(), predicate), mPendingSounds.end());
+    }
+
+    void SoundManager::preloadSounds(const MWWorld::CellStore& cell)
+    {
+        if (!mOutput->isInitialized() || !Settings::sound().mAsyncLoading)
+            return;
+
+        const MWWorld::ESMStore& store = *MWBase::Environment::get().getESMStore();
+
+        if (const ESM::Region* region = store.get<ESM::Region>().search(cell.getCell()->getRegion()))
+            for (const ESM::Region::SoundRef& sound : region->mSoundList)
+                mSoundBuffers.request(sound.mSound, SceneUtil::WorkPriority::Low);
+
+        std::set<ESM::RefId> creatures;
+        cell.forEachConst([&](const MWWorld::ConstPtr& ptr) {
+            if (ptr.getType() == ESM::Creature::sRecordId)
+            {
+                const ESM::Creature& creature = *ptr.get<ESM::Creature>()->mBase;
+                creatures.insert(creature.mOriginal.empty() ? creature.mId : creature.mOriginal);
+            }
+            return true;
+        });
+
+        if (creatures.empty())
+            return;
+
+        for (const ESM::SoundGenerator& soundGenerator : store.get<ESM::SoundGenerator>())
+            if (creatures.contains(soundGenerator.mCreature))
+                mSoundBuffers.request(soundGenerator.mSound, SceneUtil::WorkPriority::Low);
+    }
+
     void SoundManager::stopSound(Sound* sound)
     {
         if (sound)
@@ -660,6 +776,9 @@ namespace MWSound
         if (!mOutput->isInitialized())
             return;
 
+        removePendingSounds(
+            [&](const PendingSound& sound) { return sound.mPtr.mRef == ptr.mRef && sound.mSoundId == soundId; });
+
         Sound_Buffer* sfx = mSoundBuffers.lookup(soundId);
         if (!sfx)
             return;
@@ -673,6 +792,10 @@ namespace MWSound
             return;
 
         std::string normalizedName = VFS::Path::normalizeFilename(fileName);
+        removePendingSounds([&](const PendingSound& sound) {
+            return sound.mPtr.mRef == ptr.mRef && !sound.mFileName.empty() && sound.mFileName == normalizedName;
+        });
+
         Sound_Buffer* sfx = mSoundBuffers.lookup(normalizedName);
         if (!sfx)
             return;
@@ -682,6 +805,8 @@ namespace MWSound
 
     void SoundManager::stopSound3D(const MWWorld::ConstPtr& ptr)
     {
+        removePendingSounds([&](const PendingSound& sound) { return sound.mPtr.mRef == ptr.mRef; });
+
         SoundMap::iterator snditer = mActiveSounds.find(ptr.mRef);
         if (snditer != mActiveSounds.end())
         {
@@ -698,6 +823,10 @@ namespace MWSound
 
     void SoundManager::stopSound(const MWWorld::CellStore* cell)
     {
+        removePendingSounds([&](const PendingSound& sound) {
+            return sound.mPtr.mCell == cell && sound.mPtr.mRef != MWMechanics::getPlayer().mRef;
+        });
+
         for (auto& [ref, sound] : mActiveSounds)
         {
             if (ref != nullptr && ref != MWMechanics::getPlayer().mRef && sound.mCell == cell)
@@ -740,6 +869,11 @@ namespace MWSound
     {
         std::string normalizedName = VFS::Path::normalizeFilename(fileName);
 
+        if (hasPendingSound(ptr, [&](const PendingSound& sound) {
+                return !sound.mFileName.empty() && sound.mFileName == normalizedName;
+            }))
+            return true;
+
         SoundMap::const_iterator snditer = mActiveSounds.find(ptr.mRef);
         if (snditer != mActiveSounds.end())
         {
@@ -758,6 +892,9 @@ namespace MWSound
 
     bool SoundManager::getSoundPlaying(const MWWorld::ConstPtr& ptr, const ESM::RefId& soundId) const
     {
+        if (hasPendingSound(ptr, [&](const PendingSound& sound) { return sound.mSoundId == soundId; }))
+            return true;
+
         SoundMap::const_iterator snditer = mActiveSounds.find(ptr.mRef);
         if (snditer != mActiveSounds.end())
         {
@@ -1094,6 +1231,7 @@ namespace MWSound
                 streamMusic(MWSound::titleMusic, MWSound::MusicType::Normal);
         }
 
+        updatePendingSounds(duration);
         updateSounds(duration);
         if (state != MWBase::StateManager::State_NoGame)
         {
@@ -1164,6 +1302,10 @@ namespace MWSound
 
         if (const auto it = mActiveSaySounds.find(old.mRef); it != mActiveSaySounds.end())
             it->second.mCell = updated.mCell;
+
+        for (PendingSound& sound : mPendingSounds)
+            if (sound.mPtr.mRef == old.mRef)
+                sound.mPtr = updated;
     }
 
     // Default readAll implementation, for decoders that can't do anything
@@ -1268,6 +1410,7 @@ namespace MWSound
             }
         }
         mActiveSounds.clear();
+        mPendingSounds.clear();
         mUnderwaterSound = nullptr;
         mNearWaterSound = nullptr;
 
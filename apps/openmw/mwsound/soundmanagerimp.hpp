@@ -6,6 +6,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <components/fallback/fallback.hpp>
 #include <components/misc/objectpool.hpp>
@@ -35,6 +36,11 @@ namespace MWWorld
     class Cell;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWSound
 {
     class Sound_Output;
@@ -72,6 +78,23 @@ namespace MWSound
         typedef std::map<const MWWorld::LiveCellRefBase*, ActiveSound> SoundMap;
         SoundMap mActiveSounds;
 
+        // Sound played by an object waiting for its buffer to be decoded
+        struct PendingSound
+        {
+            MWWorld::ConstPtr mPtr;
+            ESM::RefId mSoundId;
+            std::string mFileName;
+            Sound_Buffer* mSfx;
+            float mVolume;
+            float mPitch;
+            Type mType;
+            PlayMode mMode;
+            float mOffset;
+            float mWaitTime = 0;
+        };
+
+        std::vector<PendingSound> mPendingSounds;
+
         struct SaySound
         {
             const MWWorld::CellStore* mCell;
@@ -131,6 +154,14 @@ namespace MWSound
         Sound* playSound3D(const MWWorld::ConstPtr& ptr, Sound_Buffer* sfx, float volume, float pitch, Type type,
             PlayMode mode, float offset);
 
+        void queueSound3D(PendingSound&& sound);
+        void updatePendingSounds(float duration);
+
+        template <class Predicate>
+        bool hasPendingSound(const MWWorld::ConstPtr& ptr, Predicate&& predicate) const;
+        template <class Predicate>
+        void removePendingSounds(Predicate&& predicate);
+
         void updateSounds(float duration);
         void updateRegionSound(float duration);
         void updateWaterSound();
@@ -158,7 +189,7 @@ namespace MWSound
         ///< Stop the given object from playing given sound buffer.
 
     public:
-        SoundManager(const VFS::Manager* vfs, bool useSound);
+        SoundManager(const VFS::Manager* vfs, bool useSound, SceneUtil::WorkQueue* workQueue);
         ~SoundManager() override;
 
         void processChangedSettings(const Settings::CategorySettingVector& settings) override;
@@ -257,6 +288,8 @@ namespace MWSound
         void stopSound(const MWWorld::CellStore* cell) override;
         ///< Stop all sounds for the given cell.
 
+        void preloadSounds(const MWWorld::CellStore& cell) override;
+
         void fadeOutSound3D(const MWWorld::ConstPtr& reference, const ESM::RefId& soundId, float duration) override;
         ///< Fade out given sound (that is already playing) of given object
         ///< @param reference Reference to object, whose sound is faded out
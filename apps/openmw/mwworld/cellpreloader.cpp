@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <limits>
 #include <span>
 
@@ -22,6 +23,9 @@
 #include <components/terrain/world.hpp>
 #include <components/vfs/manager.hpp>
 
+#include "../mwbase/environment.hpp"
+#include "../mwbase/soundmanager.hpp"
+
 #include "../mwrender/landmanager.hpp"
 
 #include "cellstore.hpp"
@@ -47,6 +51,21 @@ namespace MWWorld
             const auto predicate = [&](const PositionCellGrid& v) { return contains(container, v, tolerance); };
             return std::ranges::all_of(contained, predicate);
         }
+
+        // Estimates how far the player has to move to reach the position. Positions ahead along the velocity are
+        // reached sooner than positions at the same distance aside and even more so than positions behind.
+        float getPreloadDistance(
+            const osg::Vec3f& position, const osg::Vec3f& playerPosition, const osg::Vec3f& velocity)
+        {
+            const osg::Vec3f offset = position - playerPosition;
+            const float speed = velocity.length();
+            if (speed < 1)
+                return offset.length();
+            const osg::Vec3f direction = velocity / speed;
+            const float along = offset * direction;
+            const float across = (offset - direction * along).length();
+            return across + (along >= 0 ? along : -2 * along);
+        }
     }
 
     struct ListModelsVisitor
@@ -79,6 +98,7 @@ namespace MWWorld
             , mLandManager(landManager)
             , mPreloadInstances(preloadInstances)
             , mAbort(false)
+            , mCreatedAt(std::chrono::steady_clock::now())
         {
             mTerrainView = mTerrain->createView();
 
@@ -145,8 +165,15 @@ namespace MWWorld
                                         << e.what();
                 }
             }
+
+            mFinishedAt = std::chrono::steady_clock::now();
         }
 
+        ESM::RefId getCellId() const { return mCellId; }
+
+        /// Time from the creation to the end of the work in seconds. Valid only when work is done and not cancelled.
+        double getLatency() const { return std::chrono::duration<double>(mFinishedAt - mCreatedAt).count(); }
+
     private:
         bool mIsExterior;
         ESM::ExteriorCellLocation mCellLocation;
@@ -160,6 +187,8 @@ namespace MWWorld
         bool mPreloadInstances;
 
         std::atomic<bool> mAbort;
+        std::chrono::steady_clock::time_point mCreatedAt;
+        std::chrono::steady_clock::time_point mFinishedAt;
 
         osg::ref_ptr<Terrain::View> mTerrainView;
 
@@ -219,6 +248,16 @@ namespace MWWorld
         Resource::ResourceSystem* mResourceSystem;
     };
 
+    CellPreloader::PreloadEntry::PreloadEntry(double timestamp, const osg::Vec3f& position, std::uint64_t request,
+        bool oneShot, osg::ref_ptr<PreloadItem> workItem)
+        : mTimeStamp(timestamp)
+        , mPosition(position)
+        , mRequest(request)
+        , mOneShot(oneShot)
+        , mWorkItem(std::move(workItem))
+    {
+    }
+
     CellPreloader::CellPreloader(Resource::ResourceSystem* resourceSystem,
         Resource::BulletShapeManager* bulletShapeManager, Terrain::World* terrain, MWRender::LandManager* landManager)
         : mResourceSystem(resourceSystem)
@@ -237,7 +276,7 @@ namespace MWWorld
         clearAllTasks();
     }
 
-    void CellPreloader::preload(CellStore& cell, double timestamp)
+    void CellPreloader::preload(CellStore& cell, double timestamp, const osg::Vec3f& position, bool oneShot)
     {
         if (!mWorkQueue)
         {
@@ -253,8 +292,10 @@ namespace MWWorld
         PreloadMap::iterator found = mPreloadCells.find(&cell);
         if (found != mPreloadCells.end())
         {
-            // already preloaded, nothing to do other than updating the timestamp
+            // already preloaded, nothing to do other than updating the timestamp and priority
             found->second.mTimeStamp = timestamp;
+            found->second.mPosition = position;
+            found->second.mOneShot = oneShot;
             return;
         }
 
@@ -275,7 +316,7 @@ namespace MWWorld
 
             if (oldestTimestamp + threshold < timestamp)
             {
-                oldestCell->second.mWorkItem->abort();
+                oldestCell->second.mWorkItem->cancel();
                 mPreloadCells.erase(oldestCell);
                 ++mEvicted;
             }
@@ -285,10 +326,51 @@ namespace MWWorld
 
         osg::ref_ptr<PreloadItem> item(new PreloadItem(&cell, mResourceSystem->getSceneManager(), mBulletShapeManager,
             mResourceSystem->getKeyframeManager(), mTerrain, mLandManager, mPreloadInstances));
-        mWorkQueue->addWorkItem(item);
 
-        mPreloadCells.emplace(&cell, PreloadEntry(timestamp, item));
+        mPreloadCells.emplace(&cell, PreloadEntry(timestamp, position, mNextRequest++, oneShot, std::move(item)));
         ++mAdded;
+
+        MWBase::Environment::get().getSoundManager()->preloadSounds(cell);
+
+        schedulePreloads();
+    }
+
+    void CellPreloader::setPlayerMovement(const osg::Vec3f& position, const osg::Vec3f& velocity)
+    {
+        mPlayerPosition = position;
+        mPlayerVelocity = velocity;
+    }
+
+    void CellPreloader::schedulePreloads()
+    {
+        // Keep only as many items in the work queue as there are threads to process them, so pending cells can be
+        // reordered when the player changes direction.
+        std::size_t queued = 0;
+        std::vector<PreloadEntry*> pending;
+        for (auto& [cell, entry] : mPreloadCells)
+        {
+            if (!entry.mQueued)
+                pending.push_back(&entry);
+            else if (!entry.mWorkItem->isDone())
+                ++queued;
+        }
+
+        const std::size_t maxQueued = std::max<std::size_t>(mWorkQueue->getNumThreads(), 1);
+        if (pending.empty() || queued >= maxQueued)
+            return;
+
+        const std::size_t count = std::min(maxQueued - queued, pending.size());
+        const auto getPriority = [&](const PreloadEntry* entry) {
+            return std::pair(getPreloadDistance(entry->mPosition, mPlayerPosition, mPlayerVelocity), entry->mRequest);
+        };
+        std::partial_sort(pending.begin(), pending.begin() + count, pending.end(),
+            [&](const PreloadEntry* l, const PreloadEntry* r) { return getPriority(l) < getPriority(r); });
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            mWorkQueue->addWorkItem(pending[i]->mWorkItem);
+            pending[i]->mQueued = true;
+        }
     }
 
     void CellPreloader::notifyLoaded(CellStore* cell)
@@ -298,7 +380,7 @@ namespace MWWorld
         {
             if (found->second.mWorkItem)
             {
-                found->second.mWorkItem->abort();
+                found->second.mWorkItem->cancel();
                 found->second.mWorkItem = nullptr;
             }
 
@@ -313,7 +395,7 @@ namespace MWWorld
         {
             if (it->second.mWorkItem)
             {
-                it->second.mWorkItem->abort();
+                it->second.mWorkItem->cancel();
                 it->second.mWorkItem = nullptr;
             }
 
@@ -323,13 +405,36 @@ namespace MWWorld
 
     void CellPreloader::updateCache(double timestamp)
     {
+        // Preloads that are not requested anymore are for cells the player moved away from, unless the request is
+        // not expected to be repeated
+        const double obsoleteDelay = 1.0; // seconds
+
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end();)
         {
-            if (mPreloadCells.size() >= mMinCacheSize && it->second.mTimeStamp < timestamp - mExpiryDelay)
+            PreloadEntry& entry = it->second;
+            if (entry.mQueued && !entry.mFinished && entry.mWorkItem->isDone())
+            {
+                entry.mFinished = true;
+                if (!entry.mWorkItem->isCancelled())
+                {
+                    const double latency = entry.mWorkItem->getLatency();
+                    mLatency = mLatency == 0 ? latency : mLatency + (latency - mLatency) / 8;
+                    Log(Debug::Debug) << "Cell " << entry.mWorkItem->getCellId() << " is preloaded in "
+                                      << latency * 1000 << " ms";
+                }
+            }
+
+            if (!entry.mFinished && !entry.mOneShot && entry.mTimeStamp < timestamp - obsoleteDelay)
+            {
+                entry.mWorkItem->cancel();
+                mPreloadCells.erase(it++);
+                ++mCancelled;
+            }
+            else if (mPreloadCells.size() >= mMinCacheSize && it->second.mTimeStamp < timestamp - mExpiryDelay)
             {
                 if (it->second.mWorkItem)
                 {
-                    it->second.mWorkItem->abort();
+                    it->second.mWorkItem->cancel();
                     it->second.mWorkItem = nullptr;
                 }
                 mPreloadCells.erase(it++);
@@ -339,12 +444,14 @@ namespace MWWorld
                 ++it;
         }
 
+        schedulePreloads();
+
         if (timestamp - mLastResourceCacheUpdate > 1.0 && (!mUpdateCacheItem || mUpdateCacheItem->isDone()))
         {
             // the resource cache is cleared from the worker thread so that we're not holding up the main thread with
             // delete operations
             mUpdateCacheItem = new UpdateCacheItem(mResourceSystem, timestamp);
-            mWorkQueue->addWorkItem(mUpdateCacheItem, true);
+            mWorkQueue->addWorkItem(mUpdateCacheItem, SceneUtil::WorkPriority::High);
             mLastResourceCacheUpdate = timestamp;
         }
 
@@ -449,10 +556,11 @@ namespace MWWorld
         }
 
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
-            it->second.mWorkItem->abort();
+            it->second.mWorkItem->cancel();
 
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
-            it->second.mWorkItem->waitTillDone();
+            if (it->second.mQueued)
+                it->second.mWorkItem->waitTillDone();
 
         mPreloadCells.clear();
     }
@@ -464,5 +572,7 @@ namespace MWWorld
         stats.setAttribute(frameNumber, "CellPreloader Evicted", mEvicted);
         stats.setAttribute(frameNumber, "CellPreloader Loaded", mLoaded);
         stats.setAttribute(frameNumber, "CellPreloader Expired", mExpired);
+        stats.setAttribute(frameNumber, "CellPreloader Cancelled", mCancelled);
+        stats.setAttribute(frameNumber, "CellPreloader Latency", mLatency * 1000);
     }
 }
@@ -5,8 +5,10 @@
 
 #include <components/sceneutil/workqueue.hpp>
 
+#include <osg/Vec3f>
 #include <osg/ref_ptr>
 
+#include <cstdint>
 #include <map>
 #include <span>
 
@@ -40,6 +42,7 @@ namespace Loading
 namespace MWWorld
 {
     class CellStore;
+    class PreloadItem;
     class TerrainPreloadItem;
 
     class CellPreloader
@@ -50,14 +53,22 @@ namespace MWWorld
         ~CellPreloader();
 
         /// Ask a background thread to preload rendering meshes and collision shapes for objects in this cell.
+        /// Cells which the player is going to reach sooner according to the current movement are preloaded first.
+        /// @param position Position in the current worldspace from where the cell is expected to be entered.
+        /// @param oneShot The request is not repeated every frame, so the preload is not cancelled when it's not
+        /// requested again.
         /// @note The cell itself must be in State_Loaded or State_Preloaded.
-        void preload(MWWorld::CellStore& cell, double timestamp);
+        void preload(MWWorld::CellStore& cell, double timestamp, const osg::Vec3f& position, bool oneShot = false);
+
+        /// Set the player position and velocity used to order pending preloads.
+        void setPlayerMovement(const osg::Vec3f& position, const osg::Vec3f& velocity);
 
         void notifyLoaded(MWWorld::CellStore* cell);
 
         void clear();
 
-        /// Removes preloaded cells that have not had a preload request for a while.
+        /// Removes preloaded cells that have not had a preload request for a while, cancels unfinished preloads of
+        /// cells that are no longer requested and schedules pending ones.
         void updateCache(double timestamp);
 
         /// How long to keep a preloaded cell in cache after it's no longer requested.
@@ -90,6 +101,8 @@ namespace MWWorld
     private:
         void clearAllTasks();
 
+        void schedulePreloads();
+
         Resource::ResourceSystem* mResourceSystem;
         Resource::BulletShapeManager* mBulletShapeManager;
         Terrain::World* mTerrain;
@@ -104,18 +117,20 @@ namespace MWWorld
 
         struct PreloadEntry
         {
-            PreloadEntry(double timestamp, osg::ref_ptr<SceneUtil::WorkItem> workItem)
-                : mTimeStamp(timestamp)
-                , mWorkItem(std::move(workItem))
-            {
-            }
-            PreloadEntry()
-                : mTimeStamp(0.0)
-            {
-            }
+            PreloadEntry(double timestamp, const osg::Vec3f& position, std::uint64_t request, bool oneShot,
+                osg::ref_ptr<PreloadItem> workItem);
 
             double mTimeStamp;
-            osg::ref_ptr<SceneUtil::WorkItem> mWorkItem;
+            osg::Vec3f mPosition;
+            // Order of the preload requests, breaks ties between cells with equal priority
+            std::uint64_t mRequest;
+            // Last request is not repeated every frame, unfinished preload is kept until it expires
+            bool mOneShot;
+            osg::ref_ptr<PreloadItem> mWorkItem;
+            // Work item is added to the work queue
+            bool mQueued = false;
+            // Work item is finished and accounted in the stats
+            bool mFinished = false;
         };
         typedef std::map<const MWWorld::CellStore*, PreloadEntry> PreloadMap;
 
@@ -129,10 +144,16 @@ namespace MWWorld
 
         std::vector<PositionCellGrid> mLoadedTerrainPositions;
         double mLoadedTerrainTimestamp;
+        osg::Vec3f mPlayerPosition;
+        osg::Vec3f mPlayerVelocity;
+        std::uint64_t mNextRequest = 0;
+
         std::size_t mEvicted = 0;
         std::size_t mAdded = 0;
         std::size_t mExpired = 0;
         std::size_t mLoaded = 0;
+        std::size_t mCancelled = 0;
+        double mLatency = 0;
     };
 
 }
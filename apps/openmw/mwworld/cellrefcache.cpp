@@ -0,0 +1,316 @@
+#include "cellrefcache.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+#include <components/files/conversion.hpp>
+#include <components/to_utf8/to_utf8.hpp>
+
+namespace MWWorld
+{
+    namespace
+    {
+        // Increment when the set of references produced by readCellRefs or their serialization changes
+        constexpr int version = 1;
+
+        constexpr ESM::NAME keyRecord("CRKY");
+        constexpr ESM::NAME cellRecord("CREF");
+
+        std::string makeKey(const std::vector<std::filesystem::path>& contentFiles, ToUTF8::Utf8Encoder* encoder)
+        {
+            std::string result = "version=" + std::to_string(version) + ";";
+
+            // Conversion of all non-ASCII characters identifies the encoding used for the strings
+            if (encoder != nullptr)
+            {
+                std::string legacy;
+                for (int c = 0x80; c <= 0xff; ++c)
+                    legacy.push_back(static_cast<char>(c));
+                result += "encoding=";
+                result += encoder->getUtf8(legacy);
+                result += ";";
+            }
+
+            for (const std::filesystem::path& path : contentFiles)
+            {
+                result += "file=" + Files::pathToUnicodeString(path);
+                result += ",size=" + std::to_string(std::filesystem::file_size(path));
+                result += ",time="
+                    + std::to_string(std::filesystem::last_write_time(path).time_since_epoch().count()) + ";";
+            }
+
+            return result;
+        }
+
+        void saveHeader(ESM::ESMWriter& writer, std::ostream& stream, std::size_t recordCount)
+        {
+            writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
+            writer.setVersion(0);
+            writer.setType(0);
+            writer.setAuthor("");
+            writer.setDescription("");
+            writer.setRecordCount(static_cast<int>(recordCount));
+            writer.save(stream);
+        }
+
+        void writeCell(ESM::ESMWriter& writer, ESM::RefId cell, const std::vector<CachedCellRef>& refs)
+        {
+            writer.startRecord(cellRecord);
+            writer.writeHNRefId("NAME", cell);
+            for (const CachedCellRef& ref : refs)
+            {
+                // All fields are written for deleted references too to load them the same way as from content files
+                ref.mRef.save(writer, true);
+                if (ref.mDeleted)
+                    writer.writeHNString("DELE", "", 3);
+                // Lock state is restored from content files and savegames differently, so store it as is
+                writer.startSubRecord("LOCK");
+                writer.writeT(ref.mRef.mLockLevel);
+                writer.writeT(ref.mRef.mIsLocked);
+                writer.endRecord("LOCK");
+            }
+            writer.endRecord(cellRecord);
+        }
+    }
+
+    bool readCellRefs(const ESM::Cell& cell, ESM::ReadersCache& readers, std::vector<CachedCellRef>& refs)
+    {
+        std::unordered_set<ESM::RefNum> movedRefs;
+        for (const ESM::MovedCellRef& ref : cell.mMovedRefs)
+            movedRefs.insert(ref.mRefNum);
+
+        bool result = true;
+
+        // Load references from all plugins that do something with this cell.
+        for (std::size_t i = 0; i < cell.mContextList.size(); ++i)
+        {
+            try
+            {
+                // Reopen the ESM reader and seek to the right position.
+                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                const ESM::ReadersCache::BusyItem reader = readers.get(index);
+                cell.restore(*reader, i);
+
+                CachedCellRef ref;
+                // Get each reference in turn
+                ESM::MovedCellRef cMRef;
+                bool moved = false;
+                while (ESM::Cell::getNextRef(
+                    *reader, ref.mRef, ref.mDeleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
+                {
+                    if (moved)
+                        continue;
+
+                    // Don't load reference if it was moved to a different cell.
+                    if (movedRefs.contains(ref.mRef.mRefNum))
+                        continue;
+
+                    refs.push_back(ref);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "An error occurred loading references for cell " << cell.getDescription() << ": "
+                                  << e.what();
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    CellRefCache::~CellRefCache()
+    {
+        try
+        {
+            write();
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to write cell references cache " << mPath << ": " << e.what();
+        }
+    }
+
+    void CellRefCache::open(const std::filesystem::path& path, const std::vector<std::filesystem::path>& contentFiles,
+        ToUTF8::Utf8Encoder* encoder)
+    {
+        mAdded.clear();
+        mPath = path;
+        mKey = makeKey(contentFiles, encoder);
+        load();
+    }
+
+    void CellRefCache::load()
+    {
+        mReader.close();
+        mStored.clear();
+        mKeyMatches = false;
+
+        if (!std::filesystem::exists(mPath))
+            return;
+
+        try
+        {
+            mReader.open(mPath);
+
+            if (!mReader.hasMoreRecs() || mReader.getRecName() != keyRecord)
+                throw std::runtime_error("key record is not found");
+
+            mReader.getRecHeader();
+
+            if (mReader.getHNString("DATA") != mKey)
+            {
+                Log(Debug::Info) << "Cell references cache " << mPath << " does not match content files, ignoring";
+                mReader.close();
+                return;
+            }
+
+            mReader.skipRecord();
+            mKeyMatches = true;
+
+            while (mReader.hasMoreRecs())
+            {
+                const ESM::NAME name = mReader.getRecName();
+                mReader.getRecHeader();
+
+                if (name == cellRecord)
+                {
+                    const ESM::ESM_Context context = mReader.getContext();
+                    // Cells are appended, so the last record replaces a previous one failed to read
+                    mStored.insert_or_assign(mReader.getHNRefId("NAME"), context);
+                }
+
+                mReader.skipRecord();
+            }
+
+            Log(Debug::Info) << "Using cell references cache " << mPath << " with " << mStored.size() << " cells";
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read cell references cache " << mPath << ": " << e.what();
+            mReader.close();
+            mStored.clear();
+            mKeyMatches = false;
+        }
+    }
+
+    bool CellRefCache::read(ESM::RefId cell, std::vector<CachedCellRef>& refs)
+    {
+        if (const auto it = mAdded.find(cell); it != mAdded.end())
+        {
+            refs = it->second;
+            return true;
+        }
+
+        const auto it = mStored.find(cell);
+        if (it == mStored.end())
+            return false;
+
+        try
+        {
+            readStored(it->second, refs);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read cell " << cell << " references from cache " << mPath << ": "
+                                << e.what();
+            refs.clear();
+            mStored.erase(it);
+            return false;
+        }
+    }
+
+    void CellRefCache::add(ESM::RefId cell, const std::vector<CachedCellRef>& refs)
+    {
+        if (!isOpen())
+            return;
+
+        mAdded.insert_or_assign(cell, refs);
+    }
+
+    void CellRefCache::write()
+    {
+        if (mAdded.empty())
+            return;
+
+        if (mKeyMatches)
+            append();
+        else
+            rewrite();
+
+        mAdded.clear();
+        load();
+    }
+
+    void CellRefCache::append()
+    {
+        // Writer always starts with a file header, so only the records after it are appended
+        std::ostringstream buffer;
+        ESM::ESMWriter writer;
+        saveHeader(writer, buffer, mAdded.size());
+        const std::streamoff headerSize = buffer.tellp();
+        for (const auto& [cell, cellRefs] : mAdded)
+            writeCell(writer, cell, cellRefs);
+        writer.close();
+        const std::string records = std::move(buffer).str().substr(static_cast<std::size_t>(headerSize));
+
+        mReader.close();
+
+        std::ofstream stream(mPath, std::ios::binary | std::ios::app);
+        stream.write(records.data(), static_cast<std::streamsize>(records.size()));
+        if (!stream)
+            throw std::runtime_error("Failed to append to file " + Files::pathToUnicodeString(mPath));
+    }
+
+    void CellRefCache::rewrite()
+    {
+        std::filesystem::create_directories(mPath.parent_path());
+
+        std::filesystem::path tmpPath = mPath;
+        tmpPath += ".tmp";
+
+        {
+            std::ofstream stream(tmpPath, std::ios::binary);
+
+            ESM::ESMWriter writer;
+            saveHeader(writer, stream, 1 + mAdded.size());
+
+            writer.startRecord(keyRecord);
+            writer.writeHNString("DATA", mKey);
+            writer.endRecord(keyRecord);
+
+            // Nothing is stored when the file doesn't match
+            for (const auto& [cell, cellRefs] : mAdded)
+                writeCell(writer, cell, cellRefs);
+
+            writer.close();
+
+            if (!stream)
+                throw std::runtime_error("Failed to write file " + Files::pathToUnicodeString(tmpPath));
+        }
+
+        mReader.close();
+        std::filesystem::rename(tmpPath, mPath);
+    }
+
+    void CellRefCache::readStored(const ESM::ESM_Context& context, std::vector<CachedCellRef>& refs)
+    {
+        mReader.restoreContext(context);
+        mReader.getHNRefId("NAME");
+
+        while (mReader.hasMoreSubs())
+        {
+            CachedCellRef& ref = refs.emplace_back();
+            ref.mRef.load(mReader, ref.mDeleted, true);
+            mReader.getHNT("LOCK", ref.mRef.mLockLevel, ref.mRef.mIsLocked);
+        }
+    }
+}
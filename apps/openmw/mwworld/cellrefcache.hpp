@@ -0,0 +1,88 @@
+#ifndef OPENMW_MWWORLD_CELLREFCACHE_H
+#define OPENMW_MWWORLD_CELLREFCACHE_H
+
+#include <components/esm/refid.hpp>
+#include <components/esm3/cellref.hpp>
+#include <components/esm3/esmreader.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ESM
+{
+    class ReadersCache;
+    struct Cell;
+}
+
+namespace ToUTF8
+{
+    class Utf8Encoder;
+}
+
+namespace MWWorld
+{
+    struct CachedCellRef
+    {
+        ESM::CellRef mRef;
+        bool mDeleted = false;
+    };
+
+    /// Read references of the cell from all content files modifying it in the load order skipping the ones moved to
+    /// other cells. Moved references leased by the cell are not included. Returns false if any content file failed.
+    bool readCellRefs(const ESM::Cell& cell, ESM::ReadersCache& readers, std::vector<CachedCellRef>& refs);
+
+    /// @brief Disk cache for the result of readCellRefs.
+    /// @par Loading a cell from content files requires reopening each of them and parsing all its references, what is
+    /// expensive for large load orders. The cache stores references of each cell in a single record, so loading a
+    /// cell is one seek and a sequential read. The file is ESM with own record types and is valid only for the same
+    /// content files (names, sizes and modification times) and encoding. Cells loaded from content files are kept in
+    /// memory and appended to the file on write() or destruction, the file is rewritten only when it doesn't match.
+    /// Not thread safe.
+    class CellRefCache
+    {
+    public:
+        CellRefCache() = default;
+
+        CellRefCache(const CellRefCache&) = delete;
+
+        ~CellRefCache();
+
+        /// Use existing cache file if it matches the content files, otherwise it will be replaced on write.
+        void open(const std::filesystem::path& path, const std::vector<std::filesystem::path>& contentFiles,
+            ToUTF8::Utf8Encoder* encoder);
+
+        bool isOpen() const { return !mPath.empty(); }
+
+        /// Returns false if the cell is not cached.
+        bool read(ESM::RefId cell, std::vector<CachedCellRef>& refs);
+
+        void add(ESM::RefId cell, const std::vector<CachedCellRef>& refs);
+
+        void write();
+
+        std::size_t getStoredCount() const { return mStored.size(); }
+
+        std::size_t getAddedCount() const { return mAdded.size(); }
+
+    private:
+        std::filesystem::path mPath;
+        std::string mKey;
+        ESM::ESMReader mReader;
+        std::unordered_map<ESM::RefId, ESM::ESM_Context> mStored;
+        std::unordered_map<ESM::RefId, std::vector<CachedCellRef>> mAdded;
+        bool mKeyMatches = false;
+
+        void load();
+
+        void append();
+
+        void rewrite();
+
+        void readStored(const ESM::ESM_Context& context, std::vector<CachedCellRef>& refs);
+    };
+}
+
+#endif
@@ -80,6 +80,7 @@
 #include "../mwmechanics/recharge.hpp"
 #include "../mwmechanics/spellutil.hpp"
 
+#include "cellrefcache.hpp"
 #include "class.hpp"
 #include "containerstore.hpp"
 #include "esmstore.hpp"
@@ -603,9 +604,11 @@ namespace MWWorld
         return false;
     }
 
-    CellStore::CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& esmStore, ESM::ReadersCache& readers)
+    CellStore::CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& esmStore, ESM::ReadersCache& readers,
+        CellRefCache& refCache)
         : mStore(esmStore)
         , mReaders(readers)
+        , mRefCache(refCache)
         , mCellVariant(std::move(cell))
         , mState(State_Unloaded)
         , mHasState(false)
@@ -771,49 +774,28 @@ namespace MWWorld
         }
     }
 
+    void CellStore::readRefs(const ESM::Cell& cell, std::vector<CachedCellRef>& refs)
+    {
+        if (mRefCache.read(cell.mId, refs))
+            return;
+
+        // Partially read references are used but not cached to try again next time
+        if (readCellRefs(cell, mReaders, refs))
+            mRefCache.add(cell.mId, refs);
+    }
+
     void CellStore::listRefs(const ESM::Cell& cell)
     {
         if (cell.mContextList.empty())
             return; // this is a dynamically generated cell -> skipping.
 
-        // Load references from all plugins that do something with this cell.
-        for (size_t i = 0; i < cell.mContextList.size(); i++)
-        {
-            try
-            {
-                // Reopen the ESM reader and seek to the right position.
-                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-                const ESM::ReadersCache::BusyItem reader = mReaders.get(index);
-                cell.restore(*reader, i);
-
-                ESM::CellRef ref;
-
-                // Get each reference in turn
-                ESM::MovedCellRef cMRef;
-                bool deleted = false;
-                bool moved = false;
-                while (ESM::Cell::getNextRef(
-                    *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                {
-                    if (deleted || moved)
-                        continue;
-
-                    // Don't list reference if it was moved to a different cell.
-                    ESM::MovedCellRefTracker::const_iterator iter
-                        = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum);
-                    if (iter != cell.mMovedRefs.end())
-                    {
-                        continue;
-                    }
+        std::vector<CachedCellRef> refs;
+        readRefs(cell, refs);
 
-                    mIds.push_back(std::move(ref.mRefID));
-                }
-            }
-            catch (std::exception& e)
-            {
-                Log(Debug::Error) << "An error occurred listing references for cell " << getCell()->getDescription()
-                                  << ": " << e.what();
-            }
+        for (CachedCellRef& ref : refs)
+        {
+            if (!ref.mDeleted)
+                mIds.push_back(std::move(ref.mRef.mRefID));
         }
 
         // List moved references, from separately tracked list.
@@ -860,44 +842,12 @@ namespace MWWorld
         if (cell.mContextList.empty())
             return; // this is a dynamically generated cell -> skipping.
 
-        // Load references from all plugins that do something with this cell.
-        for (size_t i = 0; i < cell.mContextList.size(); i++)
-        {
-            try
-            {
-                // Reopen the ESM reader and seek to the right position.
-                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-                const ESM::ReadersCache::BusyItem reader = mReaders.get(index);
-                cell.restore(*reader, i);
-
-                ESM::CellRef ref;
-                // Get each reference in turn
-                ESM::MovedCellRef cMRef;
-                bool deleted = false;
-                bool moved = false;
-                while (ESM::Cell::getNextRef(
-                    *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                {
-                    if (moved)
-                        continue;
+        std::vector<CachedCellRef> refs;
+        readRefs(cell, refs);
 
-                    // Don't load reference if it was moved to a different cell.
-                    ESM::MovedCellRefTracker::const_iterator iter
-                        = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum);
-                    if (iter != cell.mMovedRefs.end())
-                    {
-                        continue;
-                    }
+        for (CachedCellRef& ref : refs)
+            loadRef(ref.mRef, ref.mDeleted, refNumToID);
 
-                    loadRef(ref, deleted, refNumToID);
-                }
-            }
-            catch (std::exception& e)
-            {
-                Log(Debug::Error) << "An error occurred loading references for cell " << getCell()->getDescription()
-                                  << ": " << e.what();
-            }
-        }
         // Load moved references, from separately tracked list.
         for (const auto& leasedRef : cell.mLeasedRefs)
         {
@@ -86,6 +86,8 @@ namespace ESM4
 namespace MWWorld
 {
     class ESMStore;
+    class CellRefCache;
+    struct CachedCellRef;
     struct CellStoreImp;
 
     using CellStoreTuple = std::tuple<CellRefList<ESM::Activator>, CellRefList<ESM::Potion>,
@@ -145,7 +147,8 @@ namespace MWWorld
         }
 
         /// @param readerList The readers to use for loading of the cell on-demand.
-        CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers);
+        CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers,
+            CellRefCache& refCache);
 
         CellStore(const CellStore&) = delete;
 
@@ -348,6 +351,7 @@ namespace MWWorld
 
         const MWWorld::ESMStore& mStore;
         ESM::ReadersCache& mReaders;
+        CellRefCache& mRefCache;
 
         // Even though fog actually belongs to the player and not cells,
         // it makes sense to store it here since we need it once for each cell.
@@ -418,6 +422,9 @@ namespace MWWorld
         void rechargeItems(float duration);
         void checkItem(const Ptr& ptr);
 
+        /// Read references from the cache or from content files
+        void readRefs(const ESM::Cell& cell, std::vector<CachedCellRef>& refs);
+
         /// Run through references and store IDs
         void listRefs(const ESM::Cell& cell);
         void listRefs(const ESM4::Cell& cell);
@@ -15,6 +15,9 @@ namespace MWWorld
     {
         virtual ~ContentLoader() = default;
 
+        /// Called for each content file in the load order before any load to allow reading them in advance.
+        virtual void prefetch(const std::filesystem::path& filepath, int index) {}
+
         virtual void load(const std::filesystem::path& filepath, int& index, Loading::Listener* listener) = 0;
     };
 
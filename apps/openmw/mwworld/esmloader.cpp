@@ -1,16 +1,22 @@
 #include "esmloader.hpp"
 #include "esmstore.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
 
+#include <components/debug/debuglog.hpp>
 #include <components/esm/format.hpp>
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/readerscache.hpp>
 #include <components/esm4/reader.hpp>
 #include <components/files/conversion.hpp>
 #include <components/files/openfile.hpp>
+#include <components/loadinglistener/loadinglistener.hpp>
 #include <components/misc/strings/lower.hpp>
+#include <components/misc/workerpool.hpp>
 #include <components/resource/resourcesystem.hpp>
+#include <components/to_utf8/to_utf8.hpp>
 
 #include "../mwbase/environment.hpp"
 
@@ -25,11 +31,91 @@ namespace MWWorld
         , mDialogue(nullptr) // A content file containing INFO records without a DIAL record appends them to the
                              // previous file's dialogue
         , mESMVersions(esmVersions)
+        , mMaxDecodingFiles(std::max<std::size_t>(1, Misc::WorkerPool::get().getThreadsCount()))
     {
     }
 
+    EsmLoader::~EsmLoader()
+    {
+        // Decoding tasks refer to the store and the encoder
+        for (const auto& [index, future] : mDecodingFiles)
+            future.wait();
+    }
+
+    void EsmLoader::prefetch(const std::filesystem::path& filepath, int index)
+    {
+        mPendingFiles.push_back(PendingFile{ filepath, index });
+    }
+
+    void EsmLoader::startDecoding()
+    {
+        // Limit the number of decoded but not yet loaded files to bound memory usage
+        while (!mPendingFiles.empty() && mDecodingFiles.size() < mMaxDecodingFiles)
+        {
+            PendingFile file = std::move(mPendingFiles.front());
+            mPendingFiles.pop_front();
+            const ToUTF8::StatelessUtf8Encoder* const encoder
+                = mEncoder != nullptr ? &mEncoder->getStatelessEncoder() : nullptr;
+            auto task = std::make_shared<std::packaged_task<std::optional<DecodedFile>()>>(
+                [&store = mStore, path = std::move(file.mPath), index = file.mIndex, encoder] {
+                    return decode(store, path, index, encoder);
+                });
+            mDecodingFiles.emplace(file.mIndex, task->get_future());
+            Misc::WorkerPool::get().post([task] { (*task)(); });
+        }
+    }
+
+    std::optional<EsmLoader::DecodedFile> EsmLoader::takeDecoded(int index)
+    {
+        startDecoding();
+
+        const auto it = mDecodingFiles.find(index);
+        if (it == mDecodingFiles.end())
+            return std::nullopt;
+
+        std::future<std::optional<DecodedFile>> future = std::move(it->second);
+        mDecodingFiles.erase(it);
+
+        try
+        {
+            return future.get();
+        }
+        catch (const std::exception& e)
+        {
+            // Loading the file sequentially will report the error with all details
+            Log(Debug::Warning) << "Failed to decode content file in background: " << e.what();
+            return std::nullopt;
+        }
+    }
+
+    std::optional<EsmLoader::DecodedFile> EsmLoader::decode(const ESMStore& store,
+        const std::filesystem::path& filepath, int index, const ToUTF8::StatelessUtf8Encoder* encoder)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        auto stream = Files::openBinaryInputFileStream(filepath);
+        if (ESM::readFormat(*stream) != ESM::Format::Tes3)
+            return std::nullopt;
+        stream->seekg(0);
+
+        // Utf8Encoder has a buffer and can't be shared with the loading thread
+        std::optional<ToUTF8::Utf8Encoder> threadEncoder;
+        ESM::ESMReader reader;
+        if (encoder != nullptr)
+            reader.setEncoder(&threadEncoder.emplace(*encoder));
+        reader.setIndex(index);
+        reader.open(std::move(stream), filepath);
+
+        DecodedFile result;
+        store.decode(reader, result.mRecords);
+        result.mTime = std::chrono::steady_clock::now() - start;
+
+        return result;
+    }
+
     void EsmLoader::load(const std::filesystem::path& filepath, int& index, Loading::Listener* listener)
     {
+        std::optional<DecodedFile> decoded = takeDecoded(index);
 
         auto stream = Files::openBinaryInputFileStream(filepath);
         const ESM::Format format = ESM::readFormat(*stream);
@@ -54,7 +140,25 @@ namespace MWWorld
                   "Please run the launcher to fix this issue.");
 
                 mESMVersions[index] = reader->getVer();
-                mStore.load(*reader, listener, mDialogue);
+
+                const std::string filename = Files::pathToUnicodeString(filepath.filename());
+                const auto start = std::chrono::steady_clock::now();
+
+                if (decoded.has_value())
+                {
+                    mStore.merge(*reader, decoded->mRecords, listener, mDialogue);
+                    if (listener != nullptr)
+                    {
+                        listener->reportTime(filename, "parse", decoded->mTime);
+                        listener->reportTime(filename, "merge", std::chrono::steady_clock::now() - start);
+                    }
+                }
+                else
+                {
+                    mStore.load(*reader, listener, mDialogue);
+                    if (listener != nullptr)
+                        listener->reportTime(filename, "load", std::chrono::steady_clock::now() - start);
+                }
 
                 if (!mMasterFileFormat.has_value()
                     && (Misc::StringUtils::ciEndsWith(reader->getName().u8string(), u8".esm")
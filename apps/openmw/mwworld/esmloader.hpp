@@ -1,14 +1,19 @@
 #ifndef ESMLOADER_HPP
 #define ESMLOADER_HPP
 
+#include <chrono>
+#include <deque>
+#include <future>
 #include <map>
 #include <optional>
 #include <vector>
 
 #include "contentloader.hpp"
+#include "esmstore.hpp"
 
 namespace ToUTF8
 {
+    class StatelessUtf8Encoder;
     class Utf8Encoder;
 }
 
@@ -21,18 +26,36 @@ namespace ESM
 namespace MWWorld
 {
 
-    class ESMStore;
-
+    /// @brief Loads ESM3 and ESM4 content files into ESMStore.
+    /// @par Prefetched ESM3 files are decoded by ESMStore::decode on Misc::WorkerPool threads a few files ahead of the
+    /// one being loaded. Decoded records are merged into the store in the load order on the calling thread, so the result
+    /// is the same as of loading all files sequentially.
     struct EsmLoader : public ContentLoader
     {
         explicit EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder,
             std::vector<int>& esmVersions);
 
+        ~EsmLoader() override;
+
         std::optional<int> getMasterFileFormat() const { return mMasterFileFormat; }
 
+        void prefetch(const std::filesystem::path& filepath, int index) override;
+
         void load(const std::filesystem::path& filepath, int& index, Loading::Listener* listener) override;
 
     private:
+        struct PendingFile
+        {
+            std::filesystem::path mPath;
+            int mIndex;
+        };
+
+        struct DecodedFile
+        {
+            ESMStore::DecodedRecords mRecords;
+            std::chrono::steady_clock::duration mTime;
+        };
+
         ESM::ReadersCache& mReaders;
         MWWorld::ESMStore& mStore;
         ToUTF8::Utf8Encoder* mEncoder;
@@ -40,6 +63,16 @@ namespace MWWorld
         std::optional<int> mMasterFileFormat;
         std::vector<int>& mESMVersions;
         std::map<std::string, int> mNameToIndex;
+        std::size_t mMaxDecodingFiles;
+        std::deque<PendingFile> mPendingFiles;
+        std::map<int, std::future<std::optional<DecodedFile>>> mDecodingFiles;
+
+        void startDecoding();
+
+        std::optional<DecodedFile> takeDecoded(int index);
+
+        static std::optional<DecodedFile> decode(const ESMStore& store, const std::filesystem::path& filepath,
+            int index, const ToUTF8::StatelessUtf8Encoder* encoder);
     };
 
 } /* namespace MWWorld */
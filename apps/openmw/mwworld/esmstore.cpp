@@ -14,6 +14,7 @@
 #include <components/esm4/reader.hpp>
 #include <components/esm4/readerutils.hpp>
 #include <components/esmloader/load.hpp>
+#include <components/files/conversion.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
 #include <components/lua/configuration.hpp>
 #include <components/misc/algorithm.hpp>
@@ -402,69 +403,180 @@ namespace MWWorld
                 continue;
             }
 
-            // Look up the record type.
-            ESM::RecNameInts recName = static_cast<ESM::RecNameInts>(n.toInt());
-            const auto& it = mStoreImp->mRecNameToStore.find(recName);
+            loadRecord(esm, n, dialogue);
 
-            if (it == mStoreImp->mRecNameToStore.end())
+            if (listener != nullptr)
+                listener->setProgress(::EsmLoader::fileProgress * esm.getFileOffset() / esm.getFileSize());
+        }
+    }
+
+    void ESMStore::decode(ESM::ESMReader& esm, DecodedRecords& records) const
+    {
+        records.mFileSize = esm.getFileSize();
+
+        while (esm.hasMoreRecs())
+        {
+            ESM::NAME n = esm.getRecName();
+            const std::size_t offset = esm.getFileOffset() - decltype(n)::sCapacity;
+            esm.getRecHeader();
+            if (esm.getRecordFlags() & ESM::FLAG_Ignored)
             {
-                if (recName == ESM::REC_INFO)
-                {
-                    if (dialogue)
-                    {
-                        dialogue->readInfo(esm);
-                    }
-                    else
-                    {
-                        Log(Debug::Error) << "Error: info record without dialog";
-                        esm.skipRecord();
-                    }
-                }
-                else if (n.toInt() == ESM::REC_MGEF)
-                {
-                    getWritable<ESM::MagicEffect>().load(esm);
-                }
-                else if (n.toInt() == ESM::REC_SKIL)
-                {
-                    getWritable<ESM::Skill>().load(esm);
-                }
-                else if (n.toInt() == ESM::REC_FILT || n.toInt() == ESM::REC_DBGP)
-                {
-                    // ignore project file only records
-                    esm.skipRecord();
-                }
-                else if (n.toInt() == ESM::REC_LUAL)
-                {
-                    ESM::LuaScriptsCfg cfg;
-                    cfg.load(esm);
-                    cfg.adjustRefNums(esm);
-                    mLuaContent.push_back(std::move(cfg));
-                }
-                else
-                {
-                    throw std::runtime_error("Unknown record: " + n.toString());
-                }
+                esm.skipRecord();
+                continue;
             }
-            else
+
+            const ESM::RecNameInts recName = static_cast<ESM::RecNameInts>(n.toInt());
+            std::unique_ptr<DecodedRecord> record;
+
+            if (recName == ESM::REC_INFO)
             {
-                RecordId id = it->second->load(esm);
-                if (id.mIsDeleted)
-                {
-                    it->second->eraseStatic(id.mId);
-                    continue;
-                }
+                auto info = std::make_unique<TypedDecodedRecord<ESM::DialInfo>>();
+                info->mRecord.load(esm, info->mIsDeleted);
+                record = std::move(info);
+            }
+            else if (const auto it = mStoreImp->mRecNameToStore.find(recName);
+                     it != mStoreImp->mRecNameToStore.end())
+            {
+                record = it->second->decode(esm);
+            }
+
+            if (record == nullptr)
+                esm.skipRecord();
+
+            records.mRecords.push_back(DecodedFileRecord{ recName, offset, std::move(record) });
+        }
+    }
+
+    void ESMStore::merge(
+        ESM::ESMReader& esm, DecodedRecords& records, Loading::Listener* listener, ESM::Dialogue*& dialogue)
+    {
+        if (listener != nullptr)
+            listener->setProgressRange(::EsmLoader::fileProgress);
+
+        const auto mismatch = [&] {
+            return std::logic_error(
+                "Decoded records do not match content file " + Files::pathToUnicodeString(esm.getName()));
+        };
 
-                if (n.toInt() == ESM::REC_DIAL)
+        const std::size_t fileSize = esm.getFileSize();
+        if (records.mFileSize != fileSize)
+            throw mismatch();
+
+        // Context of the reader after the file header, only the position changes between records
+        ESM::ESM_Context context = esm.getContext();
+
+        for (DecodedFileRecord& record : records.mRecords)
+        {
+            if (record.mRecord == nullptr)
+            {
+                if (record.mOffset >= fileSize)
+                    throw mismatch();
+
+                context.filePos = record.mOffset;
+                context.leftFile = static_cast<std::streamsize>(fileSize - record.mOffset);
+                context.leftRec = 0;
+                context.leftSub = 0;
+                context.subCached = false;
+                esm.restoreContext(context);
+
+                ESM::NAME n = esm.getRecName();
+                if (static_cast<ESM::RecNameInts>(n.toInt()) != record.mType)
+                    throw mismatch();
+                esm.getRecHeader();
+
+                loadRecord(esm, n, dialogue);
+            }
+            else
+                insertDecodedRecord(record.mType, *record.mRecord, dialogue);
+
+            if (listener != nullptr)
+                listener->setProgress(::EsmLoader::fileProgress * record.mOffset / fileSize);
+        }
+    }
+
+    void ESMStore::loadRecord(ESM::ESMReader& esm, ESM::NAME n, ESM::Dialogue*& dialogue)
+    {
+        // Look up the record type.
+        ESM::RecNameInts recName = static_cast<ESM::RecNameInts>(n.toInt());
+        const auto& it = mStoreImp->mRecNameToStore.find(recName);
+
+        if (it == mStoreImp->mRecNameToStore.end())
+        {
+            if (recName == ESM::REC_INFO)
+            {
+                if (dialogue)
                 {
-                    dialogue = const_cast<ESM::Dialogue*>(getWritable<ESM::Dialogue>().find(id.mId));
+                    dialogue->readInfo(esm);
                 }
                 else
                 {
-                    dialogue = nullptr;
+                    Log(Debug::Error) << "Error: info record without dialog";
+                    esm.skipRecord();
                 }
             }
-            if (listener != nullptr)
-                listener->setProgress(::EsmLoader::fileProgress * esm.getFileOffset() / esm.getFileSize());
+            else if (n.toInt() == ESM::REC_MGEF)
+            {
+                getWritable<ESM::MagicEffect>().load(esm);
+            }
+            else if (n.toInt() == ESM::REC_SKIL)
+            {
+                getWritable<ESM::Skill>().load(esm);
+            }
+            else if (n.toInt() == ESM::REC_FILT || n.toInt() == ESM::REC_DBGP)
+            {
+                // ignore project file only records
+                esm.skipRecord();
+            }
+            else if (n.toInt() == ESM::REC_LUAL)
+            {
+                ESM::LuaScriptsCfg cfg;
+                cfg.load(esm);
+                cfg.adjustRefNums(esm);
+                mLuaContent.push_back(std::move(cfg));
+            }
+            else
+            {
+                throw std::runtime_error("Unknown record: " + n.toString());
+            }
+        }
+        else
+        {
+            onRecordLoaded(recName, it->second->load(esm), *it->second, dialogue);
+        }
+    }
+
+    void ESMStore::insertDecodedRecord(ESM::RecNameInts type, DecodedRecord& record, ESM::Dialogue*& dialogue)
+    {
+        if (type == ESM::REC_INFO)
+        {
+            auto& info = static_cast<TypedDecodedRecord<ESM::DialInfo>&>(record);
+            if (dialogue)
+                dialogue->insertInfo(std::move(info.mRecord), info.mIsDeleted);
+            else
+                Log(Debug::Error) << "Error: info record without dialog";
+            return;
+        }
+
+        DynamicStore& store = *mStoreImp->mRecNameToStore.at(type);
+        onRecordLoaded(type, store.insertDecoded(record), store, dialogue);
+    }
+
+    void ESMStore::onRecordLoaded(
+        ESM::RecNameInts type, const RecordId& id, DynamicStore& store, ESM::Dialogue*& dialogue)
+    {
+        if (id.mIsDeleted)
+        {
+            store.eraseStatic(id.mId);
+            return;
+        }
+
+        if (type == ESM::REC_DIAL)
+        {
+            dialogue = const_cast<ESM::Dialogue*>(getWritable<ESM::Dialogue>().find(id.mId));
+        }
+        else
+        {
+            dialogue = nullptr;
         }
     }
 
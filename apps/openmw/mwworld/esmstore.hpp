@@ -184,6 +184,12 @@ namespace MWWorld
 
         void setIdType(const ESM::RefId& id, ESM::RecNameInts type);
 
+        void loadRecord(ESM::ESMReader& esm, ESM::NAME name, ESM::Dialogue*& dialogue);
+
+        void insertDecodedRecord(ESM::RecNameInts type, DecodedRecord& record, ESM::Dialogue*& dialogue);
+
+        void onRecordLoaded(ESM::RecNameInts type, const RecordId& id, DynamicStore& store, ESM::Dialogue*& dialogue);
+
         using LuaContent = std::variant<ESM::LuaScriptsCfg, // data from an omwaddon
             std::filesystem::path>; // path to an omwscripts file
         std::vector<LuaContent> mLuaContent;
@@ -221,6 +227,32 @@ namespace MWWorld
         void load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue);
         void loadESM4(ESM4::Reader& esm);
 
+        struct DecodedFileRecord
+        {
+            ESM::RecNameInts mType;
+            // Position of the record name in the file
+            std::size_t mOffset;
+            // nullptr for the records left to be loaded by merge
+            std::unique_ptr<DecodedRecord> mRecord;
+        };
+
+        struct DecodedRecords
+        {
+            // Used to check that merge reads the same file
+            std::size_t mFileSize = 0;
+            // Records of a content file in the file order
+            std::vector<DecodedFileRecord> mRecords;
+        };
+
+        /// Read records of a content file not depending on the store content, other records are skipped.
+        /// Does not modify the store so can be called concurrently for different readers and with merge.
+        void decode(ESM::ESMReader& esm, DecodedRecords& records) const;
+
+        /// Same as load but uses the records decoded from the same file. Only the records not decoded are read from
+        /// the file, the reader is positioned to each of them directly.
+        void merge(ESM::ESMReader& esm, DecodedRecords& records, Loading::Listener* listener,
+            ESM::Dialogue*& dialogue);
+
         template <class T>
         const Store<T>& get() const
         {
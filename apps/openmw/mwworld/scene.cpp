@@ -1158,6 +1158,8 @@ namespace MWWorld
 
         mLastPlayerPos = playerPos;
 
+        mPreloader->setPlayerMovement(playerPos, moved / dt);
+
         if (mPreloadEnabled)
         {
             if (mPreloadDoors)
@@ -1198,7 +1200,8 @@ namespace MWWorld
             {
                 try
                 {
-                    preloadCellWithSurroundings(mWorld.getWorldModel().getCell(door.getCellRef().getDestCell()));
+                    preloadCellWithSurroundings(mWorld.getWorldModel().getCell(door.getCellRef().getDestCell()),
+                        door.getRefData().getPosition().asVec3());
                 }
                 catch (const std::exception& e)
                 {
@@ -1241,16 +1244,17 @@ namespace MWWorld
                 float loadDist = cellSize / 2 + cellSize - mCellLoadingThreshold + mPreloadDistance;
 
                 if (dist < loadDist)
-                    preloadCell(mWorld.getWorldModel().getExterior(cellIndex));
+                    preloadCell(mWorld.getWorldModel().getExterior(cellIndex),
+                        osg::Vec3f(thisCellCenter.x(), thisCellCenter.y(), playerPos.z()));
             }
         }
     }
 
-    void Scene::preloadCellWithSurroundings(CellStore& cell)
+    void Scene::preloadCellWithSurroundings(CellStore& cell, const osg::Vec3f& position, bool oneShot)
     {
         if (!cell.isExterior())
         {
-            mPreloader->preload(cell, mRendering.getReferenceTime());
+            mPreloader->preload(cell, mRendering.getReferenceTime(), position, oneShot);
             return;
         }
 
@@ -1281,12 +1285,12 @@ namespace MWWorld
         const ESM::RefId worldspace = cell.getCell()->getWorldSpace();
         for (const auto& [x, y] : cells)
             mPreloader->preload(mWorld.getWorldModel().getExterior(ESM::ExteriorCellLocation(x, y, worldspace)),
-                mRendering.getReferenceTime());
+                mRendering.getReferenceTime(), position, oneShot);
     }
 
-    void Scene::preloadCell(CellStore& cell)
+    void Scene::preloadCell(CellStore& cell, const osg::Vec3f& position)
     {
-        mPreloader->preload(cell, mRendering.getReferenceTime());
+        mPreloader->preload(cell, mRendering.getReferenceTime(), position);
     }
 
     void Scene::preloadTerrain(const osg::Vec3f& pos, ESM::RefId worldspace, bool sync)
@@ -1324,21 +1328,17 @@ namespace MWWorld
             if ((ptr.getRefData().getPosition().asVec3() - mPlayerPos).length2() > mPreloadDist * mPreloadDist)
                 return true;
 
-            if (ptr.getClass().isNpc())
-            {
-                const std::vector<ESM::Transport::Dest>& transport = ptr.get<ESM::NPC>()->mBase->mTransport.mList;
-                mList.insert(mList.begin(), transport.begin(), transport.end());
-            }
-            else
-            {
-                const std::vector<ESM::Transport::Dest>& transport = ptr.get<ESM::Creature>()->mBase->mTransport.mList;
-                mList.insert(mList.begin(), transport.begin(), transport.end());
-            }
+            const std::vector<ESM::Transport::Dest>& transport = ptr.getClass().isNpc()
+                ? ptr.get<ESM::NPC>()->mBase->mTransport.mList
+                : ptr.get<ESM::Creature>()->mBase->mTransport.mList;
+            for (const ESM::Transport::Dest& dest : transport)
+                mList.emplace_back(ptr.getRefData().getPosition().asVec3(), dest);
             return true;
         }
         float mPreloadDist;
         osg::Vec3f mPlayerPos;
-        std::vector<ESM::Transport::Dest> mList;
+        // Destinations with positions of the actors providing travel to them
+        std::vector<std::pair<osg::Vec3f, ESM::Transport::Dest>> mList;
     };
 
     void Scene::preloadFastTravelDestinations(
@@ -1352,16 +1352,16 @@ namespace MWWorld
             cellStore->forEachType<ESM::Creature>(listVisitor);
         }
 
-        for (ESM::Transport::Dest& dest : listVisitor.mList)
+        for (const auto& [actorPos, dest] : listVisitor.mList)
         {
             if (!dest.mCellName.empty())
-                preloadCell(mWorld.getWorldModel().getInterior(dest.mCellName));
+                preloadCell(mWorld.getWorldModel().getInterior(dest.mCellName), actorPos);
             else
             {
                 osg::Vec3f pos = dest.mPos.asVec3();
                 const ESM::ExteriorCellLocation cellIndex
                     = ESM::positionToExteriorCellLocation(pos.x(), pos.y(), extWorldspace);
-                preloadCellWithSurroundings(mWorld.getWorldModel().getExterior(cellIndex));
+                preloadCellWithSurroundings(mWorld.getWorldModel().getExterior(cellIndex), actorPos);
                 exteriorPositions.push_back(PositionCellGrid{ pos, gridCenterToBounds(getNewGridCenter(pos)) });
             }
         }
@@ -143,8 +143,10 @@ namespace MWWorld
 
         ~Scene();
 
-        void preloadCellWithSurroundings(MWWorld::CellStore& cell);
-        void preloadCell(MWWorld::CellStore& cell);
+        /// @param position Position in the current worldspace from where the cell is expected to be entered, used to
+        /// order preloads.
+        void preloadCellWithSurroundings(MWWorld::CellStore& cell, const osg::Vec3f& position, bool oneShot = false);
+        void preloadCell(MWWorld::CellStore& cell, const osg::Vec3f& position);
         void preloadTerrain(const osg::Vec3f& pos, ESM::RefId worldspace, bool sync = false);
         void reloadTerrain();
 
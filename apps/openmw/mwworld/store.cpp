@@ -213,23 +213,55 @@ namespace MWWorld
             T record;
             bool isDeleted = false;
             record.load(esm, isDeleted);
+            return insertLoaded(std::move(record), isDeleted);
+        }
+        else
+        {
+            std::stringstream msg;
+            msg << "Can not load record of type ESM::REC_" << getRecNameString(T::sRecordId).toStringView()
+                << ": ESM::ESMReader can load only ESM3 records.";
+            throw std::runtime_error(msg.str());
+        }
+    }
+
+    template <class T, class Id>
+    std::unique_ptr<DecodedRecord> TypedDynamicStore<T, Id>::decode(ESM::ESMReader& esm) const
+    {
+        if constexpr (!ESM::isESM4Rec(T::sRecordId))
+        {
+            auto result = std::make_unique<TypedDecodedRecord<T>>();
+            result->mRecord.load(esm, result->mIsDeleted);
+            return result;
+        }
+        else
+            return nullptr;
+    }
+
+    template <class T, class Id>
+    RecordId TypedDynamicStore<T, Id>::insertDecoded(DecodedRecord& record)
+    {
+        auto& typed = static_cast<TypedDecodedRecord<T>&>(record);
+        return insertLoaded(std::move(typed.mRecord), typed.mIsDeleted);
+    }
+
+    template <class T, class Id>
+    RecordId TypedDynamicStore<T, Id>::insertLoaded(T&& record, bool isDeleted)
+    {
+        if constexpr (!ESM::isESM4Rec(T::sRecordId))
+        {
+            const Id id = record.mId;
 
-            std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(record.mId, record);
+            std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(id, std::move(record));
             if (inserted.second)
                 mShared.push_back(&inserted.first->second);
 
             if constexpr (std::is_same_v<Id, ESM::RefId>)
-                return RecordId(record.mId, isDeleted);
+                return RecordId(id, isDeleted);
             else
                 return RecordId();
         }
         else
-        {
-            std::stringstream msg;
-            msg << "Can not load record of type ESM::REC_" << getRecNameString(T::sRecordId).toStringView()
-                << ": ESM::ESMReader can load only ESM3 records.";
-            throw std::runtime_error(msg.str());
-        }
+            throw std::logic_error("ESM4 records can not be inserted as loaded by ESM::ESMReader");
     }
 
     template <class T, class Id>
@@ -1085,6 +1117,10 @@ namespace MWWorld
         std::sort(mShared.begin(), mShared.end(),
             [](const ESM::Dialogue* l, const ESM::Dialogue* r) -> bool { return l->mId < r->mId; });
 
+        mInfoIndices.clear();
+        for (const auto& [id, dial] : mStatic)
+            mInfoIndices.emplace(id, MWDialogue::InfoIndex(dial));
+
         mKeywordSearchModFlag = true;
     }
 
@@ -1154,6 +1190,8 @@ namespace MWWorld
         if (eraseFromMap(mStatic, id))
             mKeywordSearchModFlag = true;
 
+        mInfoIndices.erase(id);
+
         return true;
     }
 
@@ -1164,6 +1202,14 @@ namespace MWWorld
             list.push_back(dialogue->mId);
     }
 
+    const MWDialogue::InfoIndex* Store<ESM::Dialogue>::getInfoIndex(const ESM::Dialogue& dialogue) const
+    {
+        const auto it = mInfoIndices.find(dialogue.mId);
+        if (it == mInfoIndices.end() || &it->second.getDialogue() != &dialogue)
+            return nullptr;
+        return &it->second;
+    }
+
     const MWDialogue::KeywordSearch<int>& Store<ESM::Dialogue>::getDialogIdKeywordSearch() const
     {
         if (mKeywordSearchModFlag)
@@ -5,6 +5,7 @@
 #include <memory>
 #include <set>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -26,6 +27,7 @@
 #include <components/misc/rng.hpp>
 #include <components/misc/strings/algorithm.hpp>
 
+#include "../mwdialogue/infoindex.hpp"
 #include "../mwdialogue/keywordsearch.hpp"
 
 namespace ESM
@@ -57,6 +59,19 @@ namespace MWWorld
     {
     }; // Empty interface to be parent of all store types
 
+    /// Record read from a content file without modifying a store to be inserted into it later
+    struct DecodedRecord
+    {
+        virtual ~DecodedRecord() = default;
+    };
+
+    template <class T>
+    struct TypedDecodedRecord final : DecodedRecord
+    {
+        T mRecord;
+        bool mIsDeleted = false;
+    };
+
     template <class Id>
     class DynamicStoreBase : public StoreBase
     {
@@ -73,6 +88,17 @@ namespace MWWorld
         virtual int getDynamicSize() const { return 0; }
         virtual RecordId load(ESM::ESMReader& esm) = 0;
 
+        /// Read a record the same way as load does without modifying the store, can be called from any thread.
+        /// Returns nullptr without reading anything if the record depends on the store content and has to be loaded
+        /// by load.
+        virtual std::unique_ptr<DecodedRecord> decode(ESM::ESMReader& esm) const { return nullptr; }
+
+        /// Insert a record returned by decode, the result is the same as of load for the same record.
+        virtual RecordId insertDecoded(DecodedRecord& record)
+        {
+            throw std::logic_error("Store does not support decoded records");
+        }
+
         virtual bool eraseStatic(const Id& id) { return false; }
         virtual void clearDynamic() {}
 
@@ -243,8 +269,13 @@ namespace MWWorld
         bool erase(const T& item);
 
         RecordId load(ESM::ESMReader& esm) override;
+        std::unique_ptr<DecodedRecord> decode(ESM::ESMReader& esm) const override;
+        RecordId insertDecoded(DecodedRecord& record) override;
         void write(ESM::ESMWriter& writer, Loading::Listener& progress) const override;
         RecordId read(ESM::ESMReader& reader, bool overrideOnly = false) override;
+
+    private:
+        RecordId insertLoaded(T&& record, bool isDeleted);
     };
 
     template <class T>
@@ -534,6 +565,8 @@ namespace MWWorld
         mutable bool mKeywordSearchModFlag;
         mutable MWDialogue::KeywordSearch<int /*unused*/> mKeywordSearch;
 
+        std::unordered_map<ESM::RefId, MWDialogue::InfoIndex> mInfoIndices;
+
     public:
         Store();
 
@@ -556,6 +589,9 @@ namespace MWWorld
         void listIdentifier(std::vector<ESM::RefId>& list) const override;
 
         const MWDialogue::KeywordSearch<int>& getDialogIdKeywordSearch() const;
+
+        /// Returns nullptr if the dialogue is not from this store or the store is not set up yet
+        const MWDialogue::InfoIndex* getInfoIndex(const ESM::Dialogue& dialogue) const;
     };
 
     template <typename T>
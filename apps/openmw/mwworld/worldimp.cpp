@@ -200,6 +200,14 @@ namespace MWWorld
             mLoaders.emplace(std::move(extension), &loader);
         }
 
+        void prefetch(const std::filesystem::path& filepath, int index) override
+        {
+            const auto it
+                = mLoaders.find(Misc::StringUtils::lowerCase(Files::pathToUnicodeString(filepath.extension())));
+            if (it != mLoaders.end())
+                it->second->prefetch(filepath, index);
+        }
+
         void load(const std::filesystem::path& filepath, int& index, Loading::Listener* listener) override
         {
             const auto it
@@ -249,16 +257,17 @@ namespace MWWorld
     }
 
     World::World(Resource::ResourceSystem* resourceSystem, int activationDistanceOverride, const std::string& startCell,
-        const std::filesystem::path& userDataPath)
+        const std::filesystem::path& userDataPath, const std::filesystem::path& cachePath)
         : mResourceSystem(resourceSystem)
         , mLocalScripts(mStore)
-        , mWorldModel(mStore, mReaders)
+        , mWorldModel(mStore, mReaders, mCellRefCache)
         , mTimeManager(std::make_unique<DateTimeManager>())
         , mSky(true)
         , mGodMode(false)
         , mScriptsEnabled(true)
         , mDiscardMovements(true)
         , mUserDataPath(userDataPath)
+        , mCachePath(cachePath)
         , mActivationDistanceOverride(activationDistanceOverride)
         , mStartCell(startCell)
         , mSwimHeightScale(0.f)
@@ -292,7 +301,7 @@ namespace MWWorld
     }
 
     void World::init(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode, SceneUtil::WorkQueue* workQueue,
-        SceneUtil::UnrefQueue& unrefQueue)
+        SceneUtil::UnrefQueue& unrefQueue, std::shared_ptr<const Terrain::ChunkDiskCache> terrainDiskCache)
     {
         mPhysics = std::make_unique<MWPhysics::PhysicsSystem>(mResourceSystem, rootNode);
 
@@ -307,8 +316,8 @@ namespace MWWorld
             mNavigator = DetourNavigator::makeNavigatorStub();
         }
 
-        mRendering = std::make_unique<MWRender::RenderingManager>(
-            viewer, rootNode, mResourceSystem, workQueue, *mNavigator, mGroundcoverStore, unrefQueue);
+        mRendering = std::make_unique<MWRender::RenderingManager>(viewer, rootNode, mResourceSystem, workQueue,
+            *mNavigator, mGroundcoverStore, unrefQueue, std::move(terrainDiskCache));
         mProjectileManager = std::make_unique<ProjectileManager>(
             mRendering->getLightRoot()->asGroup(), mResourceSystem, mRendering.get(), mPhysics.get());
         mRendering->preloadCommonAssets();
@@ -521,7 +530,8 @@ namespace MWWorld
                     if (getPlayerPtr().getCell()->isExterior())
                         mWorldScene->preloadTerrain(getPlayerPtr().getRefData().getPosition().asVec3(),
                             getPlayerPtr().getCell()->getCell()->getWorldSpace());
-                    mWorldScene->preloadCellWithSurroundings(*getPlayerPtr().getCell());
+                    mWorldScene->preloadCellWithSurroundings(
+                        *getPlayerPtr().getCell(), getPlayerPtr().getRefData().getPosition().asVec3(), true);
                 }
                 break;
             case ESM::REC_CSTA:
@@ -1505,6 +1515,9 @@ namespace MWWorld
                 updateNavigatorObject(*object, navigatorUpdateGuard.get());
 
         mNavigator->update(getPlayerPtr().getRefData().getPosition().asVec3(), navigatorUpdateGuard.get());
+
+        // Path queries requested by actors during this frame are processed in background and handled on the next one
+        mNavigator->dispatchPathQueries();
     }
 
     void World::updateNavigatorObject(
@@ -2859,26 +2872,35 @@ namespace MWWorld
         OMWScriptsLoader omwScriptsLoader(mStore);
         gameContentLoader.addLoader(".omwscripts", omwScriptsLoader);
 
-        int idx = 0;
+        std::vector<std::filesystem::path> paths;
         for (const std::string& file : content)
         {
             const auto filename = Files::pathFromUnicodeString(file);
             const Files::MultiDirCollection& col
                 = fileCollections.getCollection(Files::pathToUnicodeString(filename.extension()));
-            if (col.doesExist(file))
-            {
-                gameContentLoader.load(col.getPath(file), idx, listener);
-            }
-            else
+            if (!col.doesExist(file))
             {
                 std::string message = "Failed loading " + file + ": the content file does not exist";
                 throw std::runtime_error(message);
             }
+            paths.push_back(col.getPath(file));
+        }
+
+        for (std::size_t i = 0; i < paths.size(); ++i)
+            gameContentLoader.prefetch(paths[i], static_cast<int>(i));
+
+        int idx = 0;
+        for (const std::filesystem::path& path : paths)
+        {
+            gameContentLoader.load(path, idx, listener);
             idx++;
         }
 
         if (const auto v = esmLoader.getMasterFileFormat(); v.has_value() && *v == 0)
             ensureNeededRecords(); // Insert records that may not be present in all versions of master files.
+
+        if (Settings::cells().mReferencesDiskCache)
+            mCellRefCache.open(mCachePath / "cellrefs.cache", paths, encoder);
     }
 
     void World::loadGroundcoverFiles(const Files::Collections& fileCollections,
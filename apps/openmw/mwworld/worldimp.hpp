@@ -10,6 +10,7 @@
 
 #include "../mwbase/world.hpp"
 
+#include "cellrefcache.hpp"
 #include "contentloader.hpp"
 #include "esmstore.hpp"
 #include "globals.hpp"
@@ -61,6 +62,11 @@ namespace MWRender
     class PostProcessor;
 }
 
+namespace Terrain
+{
+    class ChunkDiskCache;
+}
+
 namespace ToUTF8
 {
     class Utf8Encoder;
@@ -86,6 +92,7 @@ namespace MWWorld
         Resource::ResourceSystem* mResourceSystem;
 
         ESM::ReadersCache mReaders;
+        CellRefCache mCellRefCache;
         MWWorld::ESMStore mStore;
         GroundcoverStore mGroundcoverStore;
         LocalScripts mLocalScripts;
@@ -112,6 +119,7 @@ namespace MWWorld
         std::vector<std::string> mContentFiles;
 
         std::filesystem::path mUserDataPath;
+        std::filesystem::path mCachePath;
 
         int mActivationDistanceOverride;
 
@@ -195,7 +203,7 @@ namespace MWWorld
         void removeContainerScripts(const Ptr& reference) override;
 
         World(Resource::ResourceSystem* resourceSystem, int activationDistanceOverride, const std::string& startCell,
-            const std::filesystem::path& userDataPath);
+            const std::filesystem::path& userDataPath, const std::filesystem::path& cachePath);
 
         void loadData(const Files::Collections& fileCollections, const std::vector<std::string>& contentFiles,
             const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
@@ -203,7 +211,7 @@ namespace MWWorld
 
         // Must be called after `loadData`.
         void init(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode, SceneUtil::WorkQueue* workQueue,
-            SceneUtil::UnrefQueue& unrefQueue);
+            SceneUtil::UnrefQueue& unrefQueue, std::shared_ptr<const Terrain::ChunkDiskCache> terrainDiskCache);
 
         virtual ~World();
 
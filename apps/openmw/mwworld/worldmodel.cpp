@@ -30,23 +30,23 @@ namespace MWWorld
 
         template <class T>
         CellStore& emplaceCellStore(ESM::RefId id, const T& cell, ESMStore& store, ESM::ReadersCache& readers,
-            std::unordered_map<ESM::RefId, CellStore>& cells)
+            CellRefCache& refCache, std::unordered_map<ESM::RefId, CellStore>& cells)
         {
-            const auto [it, inserted] = cells.emplace(
-                std::piecewise_construct, std::forward_as_tuple(id), std::forward_as_tuple(Cell(cell), store, readers));
+            const auto [it, inserted] = cells.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+                std::forward_as_tuple(Cell(cell), store, readers, refCache));
             assert(inserted);
             return it->second;
         }
 
         CellStore* emplaceInteriorCellStore(std::string_view name, ESMStore& store, ESM::ReadersCache& readers,
-            std::unordered_map<ESM::RefId, CellStore>& cells)
+            CellRefCache& refCache, std::unordered_map<ESM::RefId, CellStore>& cells)
         {
             if (const ESM::Cell* cell = store.get<ESM::Cell>().search(name))
-                return &emplaceCellStore(cell->mId, *cell, store, readers, cells);
+                return &emplaceCellStore(cell->mId, *cell, store, readers, refCache, cells);
             if (const ESM4::Cell* cell = store.get<ESM4::Cell>().searchCellName(name);
                 cell != nullptr && !cell->isExterior())
             {
-                return &emplaceCellStore(cell->mId, *cell, store, readers, cells);
+                return &emplaceCellStore(cell->mId, *cell, store, readers, refCache, cells);
             }
             return nullptr;
         }
@@ -104,7 +104,8 @@ namespace MWWorld
 
         CellStore* getOrCreateExterior(const ESM::ExteriorCellLocation& location,
             std::map<ESM::ExteriorCellLocation, MWWorld::CellStore*>& exteriors, ESMStore& store,
-            ESM::ReadersCache& readers, std::unordered_map<ESM::RefId, CellStore>& cells, bool triggerEvent)
+            ESM::ReadersCache& readers, CellRefCache& refCache, std::unordered_map<ESM::RefId, CellStore>& cells,
+            bool triggerEvent)
         {
             if (const auto it = exteriors.find(location); it != exteriors.end())
             {
@@ -113,7 +114,7 @@ namespace MWWorld
             }
             auto [cell, created] = createExteriorCell(location, store);
             const ESM::RefId id = cell.getId();
-            CellStore* const cellStore = &emplaceCellStore(id, std::move(cell), store, readers, cells);
+            CellStore* const cellStore = &emplaceCellStore(id, std::move(cell), store, readers, refCache, cells);
             exteriors.emplace(location, cellStore);
             if (created && triggerEvent)
                 MWBase::Environment::get().getLuaManager()->exteriorCreated(*cellStore);
@@ -132,7 +133,7 @@ MWWorld::CellStore& MWWorld::WorldModel::getOrInsertCellStore(const ESM::Cell& c
 
 MWWorld::CellStore& MWWorld::WorldModel::insertCellStore(const ESM::Cell& cell)
 {
-    CellStore& cellStore = emplaceCellStore(cell.mId, cell, mStore, mReaders, mCells);
+    CellStore& cellStore = emplaceCellStore(cell.mId, cell, mStore, mReaders, mRefCache, mCells);
     if (cell.mData.mFlags & ESM::Cell::Interior)
         mInteriors.emplace(cell.mName, &cellStore);
     else
@@ -184,9 +185,10 @@ void MWWorld::WorldModel::writeCell(ESM::ESMWriter& writer, CellStore& cell) con
     writer.endRecord(ESM::REC_CSTA);
 }
 
-MWWorld::WorldModel::WorldModel(MWWorld::ESMStore& store, ESM::ReadersCache& readers)
+MWWorld::WorldModel::WorldModel(MWWorld::ESMStore& store, ESM::ReadersCache& readers, CellRefCache& refCache)
     : mStore(store)
     , mReaders(readers)
+    , mRefCache(refCache)
     , mIdCache(Settings::cells().mPointersCacheSize, { ESM::RefId(), nullptr })
 {
     mDraftCell.mId = draftCellId;
@@ -196,7 +198,7 @@ namespace MWWorld
 {
     CellStore& WorldModel::getExterior(ESM::ExteriorCellLocation location, bool forceLoad) const
     {
-        CellStore* cellStore = getOrCreateExterior(location, mExteriors, mStore, mReaders, mCells, true);
+        CellStore* cellStore = getOrCreateExterior(location, mExteriors, mStore, mReaders, mRefCache, mCells, true);
 
         if (forceLoad && cellStore->getState() != CellStore::State_Loaded)
             cellStore->load();
@@ -211,7 +213,7 @@ namespace MWWorld
 
         if (it == mInteriors.end())
         {
-            cellStore = emplaceInteriorCellStore(name, mStore, mReaders, mCells);
+            cellStore = emplaceInteriorCellStore(name, mStore, mReaders, mRefCache, mCells);
             if (cellStore == nullptr)
                 return cellStore;
             mInteriors.emplace(name, cellStore);
@@ -249,7 +251,7 @@ namespace MWWorld
 
         if (id == draftCellId)
         {
-            CellStore& cellStore = emplaceCellStore(id, Cell(mDraftCell), mStore, mReaders, mCells);
+            CellStore& cellStore = emplaceCellStore(id, Cell(mDraftCell), mStore, mReaders, mRefCache, mCells);
             cellStore.load();
             return &cellStore;
         }
@@ -263,7 +265,7 @@ namespace MWWorld
         if (!cell.has_value())
             return nullptr;
 
-        CellStore& cellStore = emplaceCellStore(id, std::move(*cell), mStore, mReaders, mCells);
+        CellStore& cellStore = emplaceCellStore(id, std::move(*cell), mStore, mReaders, mRefCache, mCells);
 
         if (cellStore.isExterior())
             mExteriors.emplace(ESM::ExteriorCellLocation(cellStore.getCell()->getGridX(),
@@ -464,8 +466,8 @@ public:
         if (const auto* exteriorId = cellId.getIf<ESM::ESM3ExteriorCellRefId>())
         {
             ESM::ExteriorCellLocation location(exteriorId->getX(), exteriorId->getY(), ESM::Cell::sDefaultWorldspaceId);
-            return getOrCreateExterior(
-                location, mWorldModel.mExteriors, mWorldModel.mStore, mWorldModel.mReaders, mWorldModel.mCells, false);
+            return getOrCreateExterior(location, mWorldModel.mExteriors, mWorldModel.mStore, mWorldModel.mReaders,
+                mWorldModel.mRefCache, mWorldModel.mCells, false);
         }
         return mWorldModel.findCell(cellId);
     }
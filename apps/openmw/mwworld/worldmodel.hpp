@@ -35,12 +35,13 @@ namespace Loading
 namespace MWWorld
 {
     class ESMStore;
+    class CellRefCache;
 
     /// \brief Cell container
     class WorldModel
     {
     public:
-        explicit WorldModel(ESMStore& store, ESM::ReadersCache& reader);
+        explicit WorldModel(ESMStore& store, ESM::ReadersCache& reader, CellRefCache& refCache);
 
         WorldModel(const WorldModel&) = delete;
         WorldModel& operator=(const WorldModel&) = delete;
@@ -110,6 +111,7 @@ namespace MWWorld
 
         MWWorld::ESMStore& mStore;
         ESM::ReadersCache& mReaders;
+        CellRefCache& mRefCache;
         mutable std::unordered_map<ESM::RefId, CellStore> mCells;
         mutable std::map<std::string, CellStore*, Misc::StringUtils::CiComp> mInteriors;
         mutable std::map<ESM::ExteriorCellLocation, CellStore*> mExteriors;
@@ -33,6 +33,9 @@ namespace OMW
         State,
         Script,
         Mechanics,
+        MechanicsAi,
+        MechanicsSensing,
+        MechanicsAnimation,
         Physics,
         PhysicsWorker,
         World,
@@ -63,6 +66,16 @@ namespace OMW
     template <>
     inline const UserStats UserStatsValue<UserStatsType::Mechanics>::sValue{ "Mech", "mechanics" };
 
+    template <>
+    inline const UserStats UserStatsValue<UserStatsType::MechanicsAi>::sValue{ " -AI", "mechanicsai" };
+
+    template <>
+    inline const UserStats UserStatsValue<UserStatsType::MechanicsSensing>::sValue{ " -Sensing", "mechanicssensing" };
+
+    template <>
+    inline const UserStats UserStatsValue<UserStatsType::MechanicsAnimation>::sValue{ " -Animation",
+        "mechanicsanimation" };
+
     template <>
     inline const UserStats UserStatsValue<UserStatsType::Physics>::sValue{ "Phys", "physics" };
 
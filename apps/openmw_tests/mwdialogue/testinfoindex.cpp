@@ -0,0 +1,170 @@
+#include "apps/openmw/mwdialogue/infoindex.hpp"
+
+#include <components/esm3/loaddial.hpp>
+#include <components/misc/strings/algorithm.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWDialogue;
+
+    ESM::DialInfo makeInfo(std::string_view response)
+    {
+        ESM::DialInfo info;
+        info.blank();
+        info.mResponse = response;
+        return info;
+    }
+
+    std::vector<std::string> getCandidates(const InfoIndex& index, const InfoIndex::Speaker& speaker)
+    {
+        std::vector<std::string> result;
+        index.forEachCandidate(speaker, [&](const ESM::DialInfo& info) {
+            result.push_back(info.mResponse);
+            return true;
+        });
+        return result;
+    }
+
+    // Same speaker requirements as Filter::testActor and Filter::testPlayer check
+    bool matchesSpeaker(const ESM::DialInfo& info, const InfoIndex::Speaker& speaker)
+    {
+        if (!info.mActor.empty())
+        {
+            if (info.mActor != speaker.mId)
+                return false;
+        }
+        else if (!speaker.mIsNpc)
+            return false;
+        if (!speaker.mIsNpc)
+            return true;
+        if (!info.mRace.empty() && info.mRace != speaker.mRace)
+            return false;
+        if (!info.mClass.empty() && info.mClass != speaker.mClass)
+            return false;
+        if (!info.mFactionLess && !info.mFaction.empty() && info.mFaction != speaker.mFaction)
+            return false;
+        if (!info.mCell.empty() && !Misc::StringUtils::ciStartsWith(speaker.mCell, info.mCell.getRefIdString()))
+            return false;
+        return true;
+    }
+
+    struct MWDialogueInfoIndexTest : Test
+    {
+        ESM::Dialogue mDialogue;
+        InfoIndex::Speaker mSpeaker{
+            .mId = ESM::RefId::stringRefId("speaker"),
+            .mIsNpc = true,
+            .mRace = ESM::RefId::stringRefId("race"),
+            .mClass = ESM::RefId::stringRefId("class"),
+            .mFaction = ESM::RefId::stringRefId("faction"),
+            .mCell = "Balmora, Council Club",
+        };
+
+        MWDialogueInfoIndexTest() { mDialogue.blank(); }
+
+        ESM::DialInfo& addInfo(std::string_view response)
+        {
+            mDialogue.mInfo.push_back(makeInfo(response));
+            return mDialogue.mInfo.back();
+        }
+    };
+
+    TEST_F(MWDialogueInfoIndexTest, forEachCandidateShouldReturnInfosInDialogueOrder)
+    {
+        addInfo("a").mRace = ESM::RefId::stringRefId("race");
+        addInfo("b");
+        addInfo("c").mActor = ESM::RefId::stringRefId("speaker");
+        addInfo("d").mFaction = ESM::RefId::stringRefId("faction");
+        addInfo("e").mClass = ESM::RefId::stringRefId("class");
+        addInfo("f").mCell = ESM::RefId::stringRefId("balmora");
+        const InfoIndex index(mDialogue);
+        EXPECT_THAT(getCandidates(index, mSpeaker), ElementsAre("a", "b", "c", "d", "e", "f"));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, forEachCandidateShouldSkipInfosForOtherSpeakers)
+    {
+        addInfo("a").mActor = ESM::RefId::stringRefId("other");
+        addInfo("b").mRace = ESM::RefId::stringRefId("other");
+        addInfo("c").mClass = ESM::RefId::stringRefId("other");
+        addInfo("d").mFaction = ESM::RefId::stringRefId("other");
+        addInfo("e").mCell = ESM::RefId::stringRefId("Vivec");
+        addInfo("f").mCell = ESM::RefId::stringRefId("Balmora, Council Club, Cellar");
+        const InfoIndex index(mDialogue);
+        EXPECT_THAT(getCandidates(index, mSpeaker), IsEmpty());
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, forEachCandidateShouldReturnOnlyInfosForCreatureId)
+    {
+        addInfo("a");
+        addInfo("b").mActor = ESM::RefId::stringRefId("speaker");
+        addInfo("c").mRace = ESM::RefId::stringRefId("race");
+        const InfoIndex index(mDialogue);
+        mSpeaker.mIsNpc = false;
+        EXPECT_THAT(getCandidates(index, mSpeaker), ElementsAre("b"));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, forEachCandidateShouldNotUseFactionOfFactionLessInfo)
+    {
+        ESM::DialInfo& info = addInfo("a");
+        info.mFaction = ESM::RefId::stringRefId("FFFF");
+        info.mFactionLess = true;
+        const InfoIndex index(mDialogue);
+        EXPECT_THAT(getCandidates(index, mSpeaker), ElementsAre("a"));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, forEachCandidateShouldStopWhenFunctionReturnsFalse)
+    {
+        addInfo("a");
+        addInfo("b").mActor = ESM::RefId::stringRefId("speaker");
+        addInfo("c");
+        const InfoIndex index(mDialogue);
+        std::vector<std::string> candidates;
+        index.forEachCandidate(mSpeaker, [&](const ESM::DialInfo& info) {
+            candidates.push_back(info.mResponse);
+            return candidates.size() < 2;
+        });
+        EXPECT_THAT(candidates, ElementsAre("a", "b"));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, forEachCandidateShouldReturnAllInfosMatchingSpeaker)
+    {
+        const std::vector<ESM::RefId> values{ ESM::RefId(), ESM::RefId::stringRefId("speaker"),
+            ESM::RefId::stringRefId("race"), ESM::RefId::stringRefId("class"), ESM::RefId::stringRefId("faction"),
+            ESM::RefId::stringRefId("Balmora"), ESM::RefId::stringRefId("other") };
+        std::minstd_rand random;
+        std::uniform_int_distribution<std::size_t> value(0, values.size() - 1);
+        for (int i = 0; i < 1000; ++i)
+        {
+            ESM::DialInfo& info = addInfo(std::to_string(i));
+            info.mActor = values[value(random)];
+            info.mRace = values[value(random)];
+            info.mClass = values[value(random)];
+            info.mFaction = values[value(random)];
+            info.mCell = values[value(random)];
+        }
+        const InfoIndex index(mDialogue);
+        for (const bool isNpc : { true, false })
+        {
+            mSpeaker.mIsNpc = isNpc;
+            std::vector<std::string> expected;
+            for (const ESM::DialInfo& info : mDialogue.mInfo)
+                if (matchesSpeaker(info, mSpeaker))
+                    expected.push_back(info.mResponse);
+            std::vector<std::string> candidates;
+            index.forEachCandidate(mSpeaker, [&](const ESM::DialInfo& info) {
+                if (matchesSpeaker(info, mSpeaker))
+                    candidates.push_back(info.mResponse);
+                return true;
+            });
+            EXPECT_EQ(candidates, expected);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#include "apps/openmw/mwmechanics/actorsensing.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWMechanics;
+
+    constexpr float cellSize = 512;
+
+    SensingInput makeInput(const osg::Vec3f& position)
+    {
+        SensingInput result;
+        result.mPosition = position;
+        result.mHalfExtents = osg::Vec3f(20, 20, 60);
+        return result;
+    }
+
+    Misc::SpatialGrid<std::size_t> makeGrid(const std::vector<SensingInput>& inputs)
+    {
+        Misc::SpatialGrid<std::size_t> grid(cellSize);
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+            grid.insert(inputs[i].mPosition, i);
+        return grid;
+    }
+
+    std::vector<std::size_t> getHeadTrackCandidates(std::size_t index, const std::vector<SensingInput>& inputs)
+    {
+        std::vector<HeadTrackCandidate> candidates;
+        findHeadTrackCandidates(index, inputs, makeGrid(inputs), candidates);
+        std::vector<std::size_t> result;
+        for (const HeadTrackCandidate& candidate : candidates)
+            result.push_back(candidate.mIndex);
+        return result;
+    }
+
+    std::vector<CollisionCandidate> getCollisionCandidates(std::size_t index, const std::vector<SensingInput>& inputs)
+    {
+        std::vector<CollisionCandidate> result;
+        predictCollisions(index, inputs, makeGrid(inputs), result);
+        return result;
+    }
+
+    struct MWMechanicsActorSensingTest : Test
+    {
+        std::vector<SensingInput> mInputs;
+
+        MWMechanicsActorSensingTest()
+        {
+            SensingInput actor = makeInput(osg::Vec3f(0, 0, 0));
+            actor.mTrackNearby = true;
+            actor.mMaxHeadTrackDistance = 400;
+            actor.mDirection = osg::Vec2f(0, 1);
+            actor.mMovement = osg::Vec2f(0, 1);
+            actor.mMaxSpeed = 100;
+            actor.mAvoidCollisions = true;
+            actor.mIsMoving = true;
+            actor.mTimeToCheck = maxTimeToCheckCollisions;
+            mInputs.push_back(actor);
+        }
+    };
+
+    TEST_F(MWMechanicsActorSensingTest, findHeadTrackCandidatesShouldReturnActorsInFrontOrderedByDistance)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, 300, 0)));
+        mInputs.push_back(makeInput(osg::Vec3f(50, 100, 0)));
+        EXPECT_THAT(getHeadTrackCandidates(0, mInputs), ElementsAre(2, 1));
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, findHeadTrackCandidatesShouldIgnoreActorsBehind)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, -100, 0)));
+        EXPECT_THAT(getHeadTrackCandidates(0, mInputs), IsEmpty());
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, findHeadTrackCandidatesShouldIgnoreActorsFurtherThanMaxDistance)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, 401, 0)));
+        EXPECT_THAT(getHeadTrackCandidates(0, mInputs), IsEmpty());
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, findHeadTrackCandidatesShouldIgnoreDeadAndMagicallyHiddenActors)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, 100, 0)));
+        mInputs.back().mIsDead = true;
+        mInputs.push_back(makeInput(osg::Vec3f(0, 200, 0)));
+        mInputs.back().mIsMagicallyHidden = true;
+        EXPECT_THAT(getHeadTrackCandidates(0, mInputs), IsEmpty());
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, predictCollisionsShouldReturnStandingActorsAheadOrderedByTime)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, 150, 0)));
+        mInputs.push_back(makeInput(osg::Vec3f(0, 100, 0)));
+        const std::vector<CollisionCandidate> candidates = getCollisionCandidates(0, mInputs);
+        ASSERT_EQ(candidates.size(), 2);
+        EXPECT_EQ(candidates[0].mIndex, 2);
+        EXPECT_FLOAT_EQ(candidates[0].mTime, 0.5f);
+        EXPECT_FLOAT_EQ(candidates[0].mAngle, 0);
+        EXPECT_EQ(candidates[1].mIndex, 1);
+        EXPECT_FLOAT_EQ(candidates[1].mTime, 1.0f);
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, predictCollisionsShouldIgnoreTarget)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, 100, 0)));
+        mInputs.front().mTarget = 1;
+        EXPECT_THAT(getCollisionCandidates(0, mInputs), IsEmpty());
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, predictCollisionsShouldIgnoreActorsBehind)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, -100, 0)));
+        EXPECT_THAT(getCollisionCandidates(0, mInputs), IsEmpty());
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, predictCollisionsShouldIgnoreCollisionsAfterTimeToCheck)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(0, 150, 0)));
+        mInputs.front().mTimeToCheck = 1.0f;
+        EXPECT_THAT(getCollisionCandidates(0, mInputs), IsEmpty());
+    }
+
+    TEST_F(MWMechanicsActorSensingTest, predictCollisionsShouldReduceCorrectionForDeadActors)
+    {
+        mInputs.push_back(makeInput(osg::Vec3f(10, 100, 0)));
+        const std::vector<CollisionCandidate> alive = getCollisionCandidates(0, mInputs);
+        mInputs.back().mIsDead = true;
+        const std::vector<CollisionCandidate> dead = getCollisionCandidates(0, mInputs);
+        ASSERT_EQ(alive.size(), 1);
+        ASSERT_EQ(dead.size(), 1);
+        EXPECT_FLOAT_EQ(dead[0].mMovementCorrection.x(), alive[0].mMovementCorrection.x());
+        EXPECT_FLOAT_EQ(dead[0].mMovementCorrection.y(), alive[0].mMovementCorrection.y() * 0.5f);
+    }
+}
@@ -0,0 +1,130 @@
+#include "apps/openmw/mwmechanics/pathgrid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWMechanics;
+
+    void addEdge(ESM::Pathgrid& pathgrid, std::size_t v0, std::size_t v1)
+    {
+        pathgrid.mEdges.push_back(ESM::Pathgrid::Edge{ v0, v1 });
+    }
+
+    void addBidirectionalEdge(ESM::Pathgrid& pathgrid, std::size_t v0, std::size_t v1)
+    {
+        addEdge(pathgrid, v0, v1);
+        addEdge(pathgrid, v1, v0);
+    }
+
+    // Square lattice with side * side points connected to their neighbours
+    ESM::Pathgrid makeLattice(int side)
+    {
+        ESM::Pathgrid result;
+        result.blank();
+        for (int y = 0; y < side; ++y)
+            for (int x = 0; x < side; ++x)
+                result.mPoints.emplace_back(x * 256, y * 256, (x * y) % 3 * 64);
+        for (int y = 0; y < side; ++y)
+        {
+            for (int x = 0; x < side; ++x)
+            {
+                const std::size_t index = static_cast<std::size_t>(y * side + x);
+                if (x + 1 < side)
+                    addBidirectionalEdge(result, index, index + 1);
+                if (y + 1 < side)
+                    addBidirectionalEdge(result, index, index + side);
+            }
+        }
+        return result;
+    }
+
+    float getLength(const std::deque<ESM::Pathgrid::Point>& path)
+    {
+        float result = 0;
+        for (std::size_t i = 1; i < path.size(); ++i)
+            result += static_cast<float>(std::abs(path[i].mX - path[i - 1].mX) + std::abs(path[i].mY - path[i - 1].mY)
+                + std::abs(path[i].mZ - path[i - 1].mZ));
+        return result;
+    }
+
+    bool isSamePoint(const ESM::Pathgrid::Point& l, const ESM::Pathgrid::Point& r)
+    {
+        return l.mX == r.mX && l.mY == r.mY && l.mZ == r.mZ;
+    }
+
+    TEST(MWMechanicsPathgridGraphTest, findPathShouldReturnPathOfTheSameLengthAsAStarSearch)
+    {
+        const ESM::Pathgrid pathgrid = makeLattice(5);
+        const PathgridGraph graph(pathgrid);
+        for (std::size_t start = 0; start < pathgrid.mPoints.size(); ++start)
+        {
+            for (std::size_t end = 0; end < pathgrid.mPoints.size(); ++end)
+            {
+                const std::deque<ESM::Pathgrid::Point> expected = graph.aStarSearch(start, end);
+                const std::deque<ESM::Pathgrid::Point> path = graph.findPath(start, end);
+                ASSERT_EQ(path.size(), expected.size()) << start << " " << end;
+                ASSERT_TRUE(isSamePoint(path.front(), pathgrid.mPoints[start]));
+                ASSERT_TRUE(isSamePoint(path.back(), pathgrid.mPoints[end]));
+                EXPECT_FLOAT_EQ(getLength(path), getLength(expected)) << start << " " << end;
+            }
+        }
+    }
+
+    TEST(MWMechanicsPathgridGraphTest, findPathShouldReturnStartPointForSameStartAndEnd)
+    {
+        const ESM::Pathgrid pathgrid = makeLattice(2);
+        const PathgridGraph graph(pathgrid);
+        const std::deque<ESM::Pathgrid::Point> path = graph.findPath(1, 1);
+        ASSERT_EQ(path.size(), 1);
+        EXPECT_TRUE(isSamePoint(path.front(), pathgrid.mPoints[1]));
+    }
+
+    TEST(MWMechanicsPathgridGraphTest, findPathShouldReturnEmptyPathForNotConnectedPoints)
+    {
+        ESM::Pathgrid pathgrid = makeLattice(2);
+        pathgrid.mPoints.emplace_back(4096, 4096, 0);
+        const PathgridGraph graph(pathgrid);
+        EXPECT_TRUE(graph.findPath(0, 4).empty());
+        EXPECT_TRUE(graph.findPath(4, 0).empty());
+    }
+
+    TEST(MWMechanicsPathgridGraphTest, findPathShouldFollowEdgesDirection)
+    {
+        ESM::Pathgrid pathgrid;
+        pathgrid.blank();
+        pathgrid.mPoints.emplace_back(0, 0, 0);
+        pathgrid.mPoints.emplace_back(256, 0, 0);
+        pathgrid.mPoints.emplace_back(256, 256, 0);
+        pathgrid.mPoints.emplace_back(0, 256, 0);
+        // Cycle 0 -> 1 -> 2 -> 3 -> 0
+        addEdge(pathgrid, 0, 1);
+        addEdge(pathgrid, 1, 2);
+        addEdge(pathgrid, 2, 3);
+        addEdge(pathgrid, 3, 0);
+        const PathgridGraph graph(pathgrid);
+        const std::deque<ESM::Pathgrid::Point> path = graph.findPath(1, 0);
+        ASSERT_EQ(path.size(), 4);
+        EXPECT_TRUE(isSamePoint(path[1], pathgrid.mPoints[2]));
+        EXPECT_TRUE(isSamePoint(path[2], pathgrid.mPoints[3]));
+    }
+
+    TEST(MWMechanicsPathgridGraphTest, findPathShouldReuseTreeForTheSameEndPoint)
+    {
+        const ESM::Pathgrid pathgrid = makeLattice(3);
+        const PathgridGraph graph(pathgrid);
+        const std::deque<ESM::Pathgrid::Point> first = graph.findPath(0, 8);
+        const std::deque<ESM::Pathgrid::Point> second = graph.findPath(2, 8);
+        const std::deque<ESM::Pathgrid::Point> third = graph.findPath(0, 8);
+        EXPECT_FLOAT_EQ(getLength(second), getLength(graph.aStarSearch(2, 8)));
+        ASSERT_EQ(first.size(), third.size());
+        for (std::size_t i = 0; i < first.size(); ++i)
+            EXPECT_TRUE(isSamePoint(first[i], third[i]));
+    }
+}
@@ -0,0 +1,183 @@
+#include "apps/openmw/mwmechanics/slottable.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWMechanics;
+
+    std::vector<int> getValues(const SlotTable<int>& table)
+    {
+        std::vector<int> result;
+        for (const int value : table)
+            result.push_back(value);
+        return result;
+    }
+
+    std::vector<std::size_t> getIndices(const SlotTable<int>& table)
+    {
+        std::vector<std::size_t> result;
+        for (auto it = table.begin(); it != table.end(); ++it)
+            result.push_back(it.getIndex());
+        return result;
+    }
+
+    TEST(MWMechanicsSlotTableTest, emptyTableBeginShouldBeEqualToEnd)
+    {
+        const SlotTable<int> table;
+        EXPECT_TRUE(table.begin() == table.end());
+        EXPECT_EQ(table.size(), 0);
+    }
+
+    TEST(MWMechanicsSlotTableTest, emplaceShouldAppendSlots)
+    {
+        SlotTable<int> table;
+        EXPECT_EQ(table.emplace(std::make_unique<int>(1)), 0);
+        EXPECT_EQ(table.emplace(std::make_unique<int>(2)), 1);
+        EXPECT_EQ(table.emplace(std::make_unique<int>(3)), 2);
+        EXPECT_EQ(table.size(), 3);
+        EXPECT_EQ(table.getSlotsCount(), 3);
+        EXPECT_THAT(getValues(table), ElementsAre(1, 2, 3));
+    }
+
+    TEST(MWMechanicsSlotTableTest, iterationShouldSkipFreeSlots)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        table.emplace(std::make_unique<int>(3));
+        table.emplace(std::make_unique<int>(4));
+        table.erase(0);
+        table.erase(2);
+        EXPECT_EQ(table.size(), 2);
+        EXPECT_EQ(table.getSlotsCount(), 4);
+        EXPECT_FALSE(table.isUsed(0));
+        EXPECT_TRUE(table.isUsed(1));
+        EXPECT_EQ(table.get(2), nullptr);
+        EXPECT_THAT(getValues(table), ElementsAre(2, 4));
+        EXPECT_THAT(getIndices(table), ElementsAre(1, 3));
+    }
+
+    TEST(MWMechanicsSlotTableTest, iterationOverOnlyFreeSlotsShouldBeEmpty)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        table.erase(0);
+        table.erase(1);
+        EXPECT_TRUE(table.begin() == table.end());
+    }
+
+    TEST(MWMechanicsSlotTableTest, emplaceShouldReuseLastFreedSlot)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        table.emplace(std::make_unique<int>(3));
+        table.erase(0);
+        table.erase(1);
+        EXPECT_EQ(table.emplace(std::make_unique<int>(4)), 1);
+        EXPECT_EQ(table.emplace(std::make_unique<int>(5)), 0);
+        EXPECT_EQ(table.emplace(std::make_unique<int>(6)), 3);
+        EXPECT_EQ(table.getSlotsCount(), 4);
+    }
+
+    TEST(MWMechanicsSlotTableTest, iterationOrderShouldFollowSlotsAfterReuse)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        table.erase(0);
+        table.emplace(std::make_unique<int>(3));
+        EXPECT_THAT(getValues(table), ElementsAre(3, 2));
+    }
+
+    TEST(MWMechanicsSlotTableTest, eraseDuringIterationShouldNotInvalidateIterator)
+    {
+        SlotTable<int> table;
+        for (int i = 1; i <= 5; ++i)
+            table.emplace(std::make_unique<int>(i));
+        std::vector<int> visited;
+        for (auto it = table.begin(); it != table.end(); ++it)
+        {
+            visited.push_back(*it);
+            if (*it % 2 == 0)
+                table.erase(it.getIndex());
+        }
+        EXPECT_THAT(visited, ElementsAre(1, 2, 3, 4, 5));
+        EXPECT_THAT(getValues(table), ElementsAre(1, 3, 5));
+        EXPECT_EQ(table.size(), 3);
+    }
+
+    TEST(MWMechanicsSlotTableTest, eraseOfNextValueDuringIterationShouldSkipIt)
+    {
+        SlotTable<int> table;
+        for (int i = 1; i <= 3; ++i)
+            table.emplace(std::make_unique<int>(i));
+        std::vector<int> visited;
+        for (auto it = table.begin(); it != table.end(); ++it)
+        {
+            visited.push_back(*it);
+            if (it.getIndex() == 0)
+                table.erase(1);
+        }
+        EXPECT_THAT(visited, ElementsAre(1, 3));
+    }
+
+    TEST(MWMechanicsSlotTableTest, endShouldIncludeValuesAddedDuringIteration)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        std::vector<int> visited;
+        for (auto it = table.begin(); it != table.end(); ++it)
+        {
+            visited.push_back(*it);
+            if (*it < 3)
+                table.emplace(std::make_unique<int>(*it + 1));
+        }
+        EXPECT_THAT(visited, ElementsAre(1, 2, 3));
+    }
+
+    TEST(MWMechanicsSlotTableTest, iteratorsShouldBeComparable)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        auto it = table.begin();
+        const auto copy = it++;
+        EXPECT_TRUE(copy == table.begin());
+        EXPECT_FALSE(it == copy);
+        EXPECT_EQ(*it, 2);
+        ++it;
+        EXPECT_TRUE(it == table.end());
+    }
+
+    TEST(MWMechanicsSlotTableTest, clearShouldRemoveAllSlots)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        table.erase(0);
+        table.clear();
+        EXPECT_EQ(table.size(), 0);
+        EXPECT_EQ(table.getSlotsCount(), 0);
+        EXPECT_TRUE(table.begin() == table.end());
+        EXPECT_EQ(table.emplace(std::make_unique<int>(3)), 0);
+    }
+
+    TEST(MWMechanicsSlotTableTest, nonConstIteratorShouldAllowToModifyValues)
+    {
+        SlotTable<int> table;
+        table.emplace(std::make_unique<int>(1));
+        table.emplace(std::make_unique<int>(2));
+        for (int& value : table)
+            value *= 10;
+        EXPECT_THAT(getValues(table), ElementsAre(10, 20));
+    }
+}
@@ -117,6 +117,13 @@ set c to ( a - 1 )
 set d to ( b * c )
 set e to ( d / a )
 
+End)mwscript";
+
+    const std::string sScript5 = R"mwscript(Begin ref_ids
+
+player->AddItem "Fur_Boots", 1
+MessageBox "Fur boots added"
+
 End)mwscript";
 
     // https://forum.openmw.org/viewtopic.php?f=6&t=2262
@@ -802,6 +809,52 @@ End)mwscript";
         }
     }
 
+    TEST_F(MWScriptTest, mwscript_test_resolved_ref_ids)
+    {
+        registerExtensions();
+        bool ran = false;
+        if (const auto script = compile(sScript5))
+        {
+            const Interpreter::Program& program = script->mProgram;
+            ASSERT_EQ(program.mRefIds.size(), program.mStrings.size());
+            for (std::size_t i = 0; i < program.mStrings.size(); ++i)
+            {
+                if (program.mStrings[i] == "Fur boots added")
+                    EXPECT_TRUE(program.mRefIds[i].empty());
+                else
+                    EXPECT_EQ(program.mRefIds[i], ESM::RefId::stringRefId(program.mStrings[i]));
+            }
+            class AddItem : public Interpreter::Opcode0
+            {
+                bool& mRan;
+
+            public:
+                AddItem(bool& ran)
+                    : mRan(ran)
+                {
+                }
+
+                void execute(Interpreter::Runtime& runtime)
+                {
+                    const ESM::RefId target = runtime.getRefIdLiteral(runtime[0].mInteger);
+                    runtime.pop();
+                    const ESM::RefId item = runtime.getRefIdLiteral(runtime[0].mInteger);
+                    runtime.pop();
+                    const Interpreter::Type_Integer count = runtime[0].mInteger;
+                    runtime.pop();
+                    EXPECT_EQ(target, ESM::RefId::stringRefId("player"));
+                    EXPECT_EQ(item, ESM::RefId::stringRefId("fur_boots"));
+                    EXPECT_EQ(count, 1);
+                    mRan = true;
+                }
+            };
+            installOpcode<AddItem>(Compiler::Container::opcodeAddItemExplicit, ran);
+            TestInterpreterContext context;
+            run(*script, context);
+        }
+        EXPECT_TRUE(ran);
+    }
+
     TEST_F(MWScriptTest, mwscript_test_4061)
     {
         EXPECT_FALSE(!compile(sIssue4061));
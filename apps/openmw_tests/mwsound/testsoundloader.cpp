@@ -0,0 +1,179 @@
+#include "apps/openmw/mwsound/null_output.hpp"
+#include "apps/openmw/mwsound/sound_decoder.hpp"
+#include "apps/openmw/mwsound/soundloader.hpp"
+
+#include <components/testing/util.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWSound;
+    using SceneUtil::WorkPriority;
+
+    struct TestDecoder final : Sound_Decoder
+    {
+        std::string mData;
+        std::size_t mOffset = 0;
+
+        TestDecoder(const VFS::Manager* resourceMgr, std::string data)
+            : Sound_Decoder(resourceMgr)
+            , mData(std::move(data))
+        {
+        }
+
+        void open(VFS::Path::NormalizedView /*fname*/) override { mOffset = 0; }
+
+        void close() override {}
+
+        std::string getName() override { return "test"; }
+
+        void getInfo(int* samplerate, ChannelConfig* chans, SampleType* type) override
+        {
+            *samplerate = 44100;
+            *chans = ChannelConfig_Mono;
+            *type = SampleType_UInt8;
+        }
+
+        size_t read(char* buffer, size_t bytes) override
+        {
+            const std::size_t count = std::min(bytes, mData.size() - mOffset);
+            std::memcpy(buffer, mData.data() + mOffset, count);
+            mOffset += count;
+            return count;
+        }
+
+        size_t getSampleOffset() override { return mOffset; }
+    };
+
+    struct MWSoundSoundLoaderTest : Test
+    {
+        const VFS::Path::Normalized mPath{ "sound/test.wav" };
+        const VFS::Path::Normalized mOtherPath{ "sound/other.wav" };
+        TestingOpenMW::VFSTestFile mFile{ "" };
+        std::unique_ptr<VFS::Manager> mVFS = TestingOpenMW::createTestVFS({
+            { mPath, &mFile },
+            { mOtherPath, &mFile },
+        });
+        Null_Output mOutput;
+        int mDecodersCount = 0;
+        SoundLoader mLoader{ mOutput, [this] {
+                                ++mDecodersCount;
+                                return std::make_shared<TestDecoder>(mVFS.get(), "data");
+                            } };
+        // Without threads items stay queued until they are taken from the queue
+        osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue = new SceneUtil::WorkQueue(0);
+
+        MWSoundSoundLoaderTest() { mLoader.setWorkQueue(mWorkQueue.get()); }
+
+        ~MWSoundSoundLoaderTest() override { mLoader.setWorkQueue(nullptr); }
+
+        void runQueuedItem()
+        {
+            const osg::ref_ptr<SceneUtil::WorkItem> item = mWorkQueue->removeWorkItem(0);
+            ASSERT_NE(item, nullptr);
+            item->doWork();
+            item->signalDone();
+        }
+
+        std::size_t unload(Sound_Handle handle) { return mOutput.unloadSound(handle); }
+    };
+
+    TEST_F(MWSoundSoundLoaderTest, requestWithoutWorkQueueShouldFail)
+    {
+        mLoader.setWorkQueue(nullptr);
+        EXPECT_FALSE(mLoader.request(mPath, WorkPriority::Low));
+        EXPECT_FALSE(mLoader.isPending(mPath));
+        EXPECT_EQ(mDecodersCount, 0);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, requestShouldKeepPriority)
+    {
+        EXPECT_TRUE(mLoader.request(mPath, WorkPriority::Low));
+        EXPECT_TRUE(mLoader.request(mPath, WorkPriority::Low));
+        EXPECT_THAT(mLoader.getPriority(mPath), Optional(WorkPriority::Low));
+        EXPECT_EQ(mLoader.getPendingCount(), 1);
+        EXPECT_EQ(mWorkQueue->getNumItems(), 1);
+        EXPECT_EQ(mDecodersCount, 1);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, requestWithLowerPriorityShouldKeepHigherPriority)
+    {
+        mLoader.request(mPath, WorkPriority::High);
+        mLoader.request(mPath, WorkPriority::Normal);
+        EXPECT_THAT(mLoader.getPriority(mPath), Optional(WorkPriority::High));
+        EXPECT_EQ(mWorkQueue->getNumItems(), 1);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, requestWithHigherPriorityShouldReplaceNotStartedItem)
+    {
+        mLoader.request(mPath, WorkPriority::Low);
+        mLoader.request(mPath, WorkPriority::High);
+        EXPECT_THAT(mLoader.getPriority(mPath), Optional(WorkPriority::High));
+        EXPECT_EQ(mLoader.getPendingCount(), 1);
+        EXPECT_EQ(mWorkQueue->getNumItems(), 2);
+        // Decoder is moved to the new item
+        EXPECT_EQ(mDecodersCount, 1);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, getPriorityShouldReturnNulloptForNotRequestedPath)
+    {
+        mLoader.request(mPath, WorkPriority::Low);
+        EXPECT_EQ(mLoader.getPriority(mOtherPath), std::nullopt);
+        EXPECT_FALSE(mLoader.isPending(mOtherPath));
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, loadShouldTakeOverNotStartedItem)
+    {
+        mLoader.request(mPath, WorkPriority::Low);
+        const auto [handle, size] = mLoader.load(mPath);
+        EXPECT_NE(handle, nullptr);
+        EXPECT_EQ(size, 4);
+        EXPECT_FALSE(mLoader.isPending(mPath));
+        EXPECT_EQ(mDecodersCount, 1);
+        EXPECT_EQ(unload(handle), 4);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, loadShouldUseDecodedSoundOfFinishedItem)
+    {
+        mLoader.request(mPath, WorkPriority::Low);
+        runQueuedItem();
+        const auto [handle, size] = mLoader.load(mPath);
+        EXPECT_EQ(size, 4);
+        EXPECT_EQ(mDecodersCount, 1);
+        unload(handle);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, loadWithoutRequestShouldDecodeSound)
+    {
+        const auto [handle, size] = mLoader.load(mPath);
+        EXPECT_EQ(size, 4);
+        EXPECT_EQ(mDecodersCount, 1);
+        unload(handle);
+    }
+
+    TEST_F(MWSoundSoundLoaderTest, updateShouldReturnFinishedItems)
+    {
+        mLoader.request(mPath, WorkPriority::Low);
+        mLoader.request(mOtherPath, WorkPriority::Low);
+        runQueuedItem();
+        std::vector<SoundLoader::Loaded> loaded;
+        mLoader.update(loaded);
+        ASSERT_EQ(loaded.size(), 1);
+        EXPECT_EQ(loaded[0].mPath, mPath);
+        EXPECT_EQ(loaded[0].mSize, 4);
+        EXPECT_FALSE(mLoader.isPending(mPath));
+        EXPECT_TRUE(mLoader.isPending(mOtherPath));
+        unload(loaded[0].mHandle);
+    }
+}
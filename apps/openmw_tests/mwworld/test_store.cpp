@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <fstream>
+#include <functional>
 #include <span>
 
 #include <boost/program_options/options_description.hpp>
@@ -342,6 +343,64 @@ TYPED_TEST_P(StoreTest, delete_test)
     }
 }
 
+template <typename T>
+static void mergeEsmFile(const T& record, bool deleted, ESM::FormatVersion formatVersion, MWWorld::ESMStore& esmStore)
+{
+    MWWorld::ESMStore::DecodedRecords records;
+    {
+        ESM::ESMReader reader;
+        reader.open(getEsmFile(record, deleted, formatVersion), "filename");
+        esmStore.decode(reader, records);
+    }
+    ASSERT_EQ(records.mRecords.size(), 1);
+    EXPECT_NE(records.mRecords.front().mRecord, nullptr);
+
+    ESM::ESMReader reader;
+    ESM::Dialogue* dialogue = nullptr;
+    reader.open(getEsmFile(record, deleted, formatVersion), "filename");
+    esmStore.merge(reader, records, &dummyListener, dialogue);
+}
+
+/// Tests that records decoded separately from merging follow the same overriding rules as loaded ones.
+TYPED_TEST_P(StoreTest, merge_decoded_test)
+{
+    using RecordType = TypeParam;
+
+    for (const ESM::FormatVersion formatVersion : getFormats())
+    {
+        SCOPED_TRACE("FormatVersion: " + std::to_string(formatVersion));
+
+        RecordType record;
+        if constexpr (hasBlankFunction<RecordType>)
+            record.blank();
+        record.mId = ESM::RefId::stringRefId("foobar");
+        record.mModel = "the_model";
+
+        {
+            MWWorld::ESMStore esmStore;
+            mergeEsmFile(record, false, formatVersion, esmStore);
+            mergeEsmFile(record, true, formatVersion, esmStore);
+            esmStore.setUp();
+
+            EXPECT_EQ(esmStore.get<RecordType>().getSize(), 0);
+        }
+        {
+            MWWorld::ESMStore esmStore;
+            mergeEsmFile(record, false, formatVersion, esmStore);
+            mergeEsmFile(record, true, formatVersion, esmStore);
+            RecordType newRecord = record;
+            newRecord.mModel = "the_new_model";
+            mergeEsmFile(newRecord, false, formatVersion, esmStore);
+            esmStore.setUp();
+
+            const RecordType* merged = esmStore.get<RecordType>().search(record.mId);
+            ASSERT_NE(merged, nullptr);
+            EXPECT_EQ(merged->mModel, "the_new_model");
+            EXPECT_EQ(esmStore.get<RecordType>().getSize(), 1);
+        }
+    }
+}
+
 template <typename T>
 static unsigned int hasSameRecordId(const MWWorld::Store<T>& store, ESM::RecNameInts RecName)
 {
@@ -580,7 +639,7 @@ namespace
         RecordTypesTest, StoreSaveLoadTest, typename AsTestingTypes<RecordTypesWithSave>::Type);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(StoreTest, overwrite_test, delete_test);
+REGISTER_TYPED_TEST_SUITE_P(StoreTest, overwrite_test, delete_test, merge_decoded_test);
 
 static_assert(std::tuple_size_v<RecordTypesWithModel> == 19);
 
@@ -667,6 +726,25 @@ namespace
         esmStore.load(reader, &dummyListener, dialogue);
     }
 
+    void mergeEsmStore(int index, const std::function<std::unique_ptr<std::istream>()>& makeStream,
+        MWWorld::ESMStore& esmStore)
+    {
+        MWWorld::ESMStore::DecodedRecords records;
+        {
+            ESM::ESMReader reader;
+            reader.setIndex(index);
+            reader.open(makeStream(), "test");
+            esmStore.decode(reader, records);
+        }
+
+        ESM::ESMReader reader;
+        ESM::Dialogue* dialogue = nullptr;
+
+        reader.setIndex(index);
+        reader.open(makeStream(), "test");
+        esmStore.merge(reader, records, &dummyListener, dialogue);
+    }
+
     MATCHER_P(HasIdEqualTo, v, "")
     {
         return v == arg.mId;
@@ -868,4 +946,61 @@ namespace
         ASSERT_NE(dialogue, nullptr);
         EXPECT_THAT(dialogue->mInfo, ElementsAre(HasIdEqualTo("info0"), HasIdEqualTo("info2")));
     }
+
+    TEST(MWWorldStoreTest, shouldMergeDecodedDialogueInfosInTheSameOrderAsLoaded)
+    {
+        const DialogueData data = generateDialogueWithInfos(3);
+
+        ESM::DialInfo newInfo = data.mInfos[0];
+        newInfo.mPrev = data.mInfos[2].mId;
+        newInfo.mNext = {};
+
+        const std::array<std::size_t, 1> deleted = { 1 };
+        const std::array<std::function<std::unique_ptr<std::istream>()>, 3> files = {
+            [&] { return saveDialogueWithInfos(data.mDialogue, data.mInfos); },
+            [&] { return saveDialogueWithInfos(data.mDialogue, std::array{ newInfo }); },
+            [&] { return saveDialogueWithInfos(data.mDialogue, data.mInfos, deleted); },
+        };
+
+        MWWorld::ESMStore loaded;
+        MWWorld::ESMStore merged;
+        for (std::size_t i = 0; i < files.size(); ++i)
+        {
+            loadEsmStore(static_cast<int>(i), files[i](), loaded);
+            mergeEsmStore(static_cast<int>(i), files[i], merged);
+        }
+        loaded.setUp();
+        merged.setUp();
+
+        const ESM::Dialogue* loadedDialogue = loaded.get<ESM::Dialogue>().search(ESM::RefId::stringRefId("dialogue"));
+        ASSERT_NE(loadedDialogue, nullptr);
+        const ESM::Dialogue* mergedDialogue = merged.get<ESM::Dialogue>().search(ESM::RefId::stringRefId("dialogue"));
+        ASSERT_NE(mergedDialogue, nullptr);
+        EXPECT_THAT(mergedDialogue->mInfo, ElementsAre(HasIdEqualTo("info0"), HasIdEqualTo("info2")));
+        std::vector<ESM::RefId> loadedIds;
+        for (const ESM::DialInfo& info : loadedDialogue->mInfo)
+            loadedIds.push_back(info.mId);
+        std::vector<ESM::RefId> mergedIds;
+        for (const ESM::DialInfo& info : mergedDialogue->mInfo)
+            mergedIds.push_back(info.mId);
+        EXPECT_EQ(mergedIds, loadedIds);
+    }
+
+    TEST(MWWorldStoreTest, mergeShouldThrowWhenDecodedRecordsDoNotMatchFile)
+    {
+        const DialogueData data = generateDialogueWithInfos(3);
+
+        MWWorld::ESMStore esmStore;
+        MWWorld::ESMStore::DecodedRecords records;
+        {
+            ESM::ESMReader reader;
+            reader.open(saveDialogueWithInfos(data.mDialogue, data.mInfos), "test");
+            esmStore.decode(reader, records);
+        }
+
+        ESM::ESMReader reader;
+        ESM::Dialogue* dialogue = nullptr;
+        reader.open(saveDialogueWithInfos(data.mDialogue, std::span(data.mInfos).subspan(1)), "test");
+        EXPECT_THROW(esmStore.merge(reader, records, &dummyListener, dialogue), std::logic_error);
+    }
 }
@@ -0,0 +1,283 @@
+#include "apps/openmw/mwworld/cellrefcache.hpp"
+
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+#include <components/testing/util.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWWorld;
+
+    ESM::CellRef makeCellRef(std::uint32_t index, std::string_view id)
+    {
+        ESM::CellRef result;
+        result.blank();
+        result.mRefNum = ESM::RefNum{ .mIndex = index, .mContentFile = 0 };
+        result.mRefID = ESM::RefId::stringRefId(id);
+        result.mPos.pos[0] = static_cast<float>(index);
+        result.mPos.pos[1] = 2;
+        result.mPos.pos[2] = 3;
+        return result;
+    }
+
+    auto tie(const CachedCellRef& v)
+    {
+        return std::tie(v.mRef.mRefNum, v.mRef.mRefID, v.mRef.mScale, v.mRef.mOwner, v.mRef.mCount, v.mRef.mKey,
+            v.mRef.mLockLevel, v.mRef.mIsLocked, v.mRef.mTeleport, v.mRef.mPos, v.mDeleted);
+    }
+
+    void expectEqual(const std::vector<CachedCellRef>& actual, const std::vector<CachedCellRef>& expected)
+    {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < actual.size(); ++i)
+            EXPECT_EQ(tie(actual[i]), tie(expected[i])) << i;
+    }
+
+    std::string readFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    struct MWWorldCellRefCacheTest : Test
+    {
+        const std::filesystem::path mContentPath = TestingOpenMW::temporaryFilePath("MWWorldCellRefCacheTest.esp");
+        const std::filesystem::path mCachePath = TestingOpenMW::temporaryFilePath("MWWorldCellRefCacheTest.cache");
+        const std::filesystem::path mOtherContentPath
+            = TestingOpenMW::temporaryFilePath("MWWorldCellRefCacheTest.other.esp");
+        ESM::ReadersCache mReaders;
+        ESM::Cell mCell;
+
+        void SetUp() override
+        {
+            std::filesystem::remove(mCachePath);
+            std::ofstream(mOtherContentPath) << "other";
+
+            ESM::Cell cell;
+            cell.blank();
+            cell.mName = "Test cell";
+            cell.mData.mFlags = ESM::Cell::Interior;
+
+            ESM::CellRef locked = makeCellRef(2, "chest");
+            locked.mKey = ESM::RefId::stringRefId("key");
+            locked.mLockLevel = 0;
+            locked.mIsLocked = true;
+
+            ESM::CellRef unlocked = makeCellRef(3, "door");
+            unlocked.mLockLevel = -50;
+            unlocked.mIsLocked = true; // To write the lock level
+            unlocked.mScale = 1.5f;
+            unlocked.mOwner = ESM::RefId::stringRefId("owner");
+            unlocked.mCount = 7;
+
+            {
+                std::ofstream stream(mContentPath, std::ios::binary);
+                ESM::ESMWriter writer;
+                writer.setFormatVersion(ESM::DefaultFormatVersion);
+                writer.setRecordCount(1);
+                writer.save(stream);
+                writer.startRecord(ESM::REC_CELL);
+                cell.save(writer);
+                makeCellRef(1, "barrel").save(writer);
+                locked.save(writer);
+                unlocked.save(writer);
+                makeCellRef(4, "deleted").save(writer, false, false, true);
+                const std::int32_t target[2] = { 1, 2 };
+                writer.writeHNT("MVRF", std::uint32_t{ 5 });
+                writer.writeHNT("CNDT", target);
+                makeCellRef(5, "moved").save(writer);
+                makeCellRef(6, "moved elsewhere").save(writer);
+                writer.endRecord(ESM::REC_CELL);
+                writer.close();
+            }
+
+            const ESM::ReadersCache::BusyItem reader = mReaders.get(0);
+            reader->open(mContentPath);
+            reader->setIndex(0);
+            ASSERT_EQ(reader->getRecName(), ESM::REC_CELL);
+            reader->getRecHeader();
+            bool isDeleted = false;
+            mCell.load(*reader, isDeleted);
+
+            ESM::MovedCellRef moved;
+            moved.mRefNum.mIndex = 6;
+            moved.mRefNum.mContentFile = 0;
+            mCell.mMovedRefs.push_back(moved);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove(mCachePath);
+            std::filesystem::remove(mContentPath);
+            std::filesystem::remove(mOtherContentPath);
+        }
+    };
+
+    TEST_F(MWWorldCellRefCacheTest, readCellRefsShouldSkipMovedRefs)
+    {
+        std::vector<CachedCellRef> refs;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, refs));
+        ASSERT_EQ(refs.size(), 4);
+        EXPECT_EQ(refs[0].mRef.mRefID, ESM::RefId::stringRefId("barrel"));
+        EXPECT_EQ(refs[0].mRef.mRefNum, (ESM::RefNum{ .mIndex = 1, .mContentFile = 0 }));
+        EXPECT_TRUE(refs[1].mRef.mIsLocked);
+        EXPECT_FALSE(refs[2].mRef.mIsLocked);
+        EXPECT_EQ(refs[2].mRef.mLockLevel, -50);
+        EXPECT_TRUE(refs[3].mDeleted);
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, readShouldReturnFalseForNotAddedCell)
+    {
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath }, nullptr);
+        std::vector<CachedCellRef> refs;
+        EXPECT_FALSE(cache.read(mCell.mId, refs));
+        EXPECT_TRUE(refs.empty());
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, readShouldReturnAddedRefs)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath }, nullptr);
+        cache.add(mCell.mId, expected);
+        std::vector<CachedCellRef> refs;
+        ASSERT_TRUE(cache.read(mCell.mId, refs));
+        expectEqual(refs, expected);
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, readShouldReturnWrittenRefs)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        {
+            CellRefCache cache;
+            cache.open(mCachePath, { mContentPath }, nullptr);
+            cache.add(mCell.mId, expected);
+            cache.write();
+            EXPECT_EQ(cache.getAddedCount(), 0);
+            EXPECT_EQ(cache.getStoredCount(), 1);
+        }
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath }, nullptr);
+        EXPECT_EQ(cache.getStoredCount(), 1);
+        std::vector<CachedCellRef> refs;
+        ASSERT_TRUE(cache.read(mCell.mId, refs));
+        expectEqual(refs, expected);
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, writeShouldKeepStoredCells)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        const ESM::RefId otherCell = ESM::RefId::stringRefId("Other cell");
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath }, nullptr);
+        cache.add(mCell.mId, expected);
+        cache.write();
+        cache.add(otherCell, { expected.front() });
+        cache.write();
+        EXPECT_EQ(cache.getStoredCount(), 2);
+        std::vector<CachedCellRef> refs;
+        ASSERT_TRUE(cache.read(mCell.mId, refs));
+        expectEqual(refs, expected);
+        refs.clear();
+        ASSERT_TRUE(cache.read(otherCell, refs));
+        expectEqual(refs, { expected.front() });
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, writeShouldAppendAddedCellsToMatchingFile)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath }, nullptr);
+        cache.add(mCell.mId, expected);
+        cache.write();
+        const std::string before = readFile(mCachePath);
+        cache.add(ESM::RefId::stringRefId("Other cell"), { expected.front() });
+        cache.write();
+        const std::string after = readFile(mCachePath);
+        ASSERT_GT(after.size(), before.size());
+        EXPECT_EQ(after.substr(0, before.size()), before);
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, writeShouldNotChangeFileWithoutAddedCells)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        {
+            CellRefCache cache;
+            cache.open(mCachePath, { mContentPath }, nullptr);
+            cache.add(mCell.mId, expected);
+        }
+        const std::string before = readFile(mCachePath);
+        {
+            CellRefCache cache;
+            cache.open(mCachePath, { mContentPath }, nullptr);
+            std::vector<CachedCellRef> refs;
+            ASSERT_TRUE(cache.read(mCell.mId, refs));
+        }
+        EXPECT_EQ(readFile(mCachePath), before);
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, writeShouldReplaceFileWrittenForDifferentContentFiles)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        {
+            CellRefCache cache;
+            cache.open(mCachePath, { mContentPath, mOtherContentPath }, nullptr);
+            cache.add(ESM::RefId::stringRefId("Other cell"), { expected.front() });
+        }
+        {
+            CellRefCache cache;
+            cache.open(mCachePath, { mContentPath }, nullptr);
+            cache.add(mCell.mId, expected);
+        }
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath }, nullptr);
+        EXPECT_EQ(cache.getStoredCount(), 1);
+        std::vector<CachedCellRef> refs;
+        ASSERT_TRUE(cache.read(mCell.mId, refs));
+        expectEqual(refs, expected);
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, openShouldIgnoreFileWrittenForDifferentContentFiles)
+    {
+        std::vector<CachedCellRef> expected;
+        ASSERT_TRUE(readCellRefs(mCell, mReaders, expected));
+        {
+            CellRefCache cache;
+            cache.open(mCachePath, { mContentPath }, nullptr);
+            cache.add(mCell.mId, expected);
+        }
+        CellRefCache cache;
+        cache.open(mCachePath, { mContentPath, mOtherContentPath }, nullptr);
+        EXPECT_EQ(cache.getStoredCount(), 0);
+        std::vector<CachedCellRef> refs;
+        EXPECT_FALSE(cache.read(mCell.mId, refs));
+    }
+
+    TEST_F(MWWorldCellRefCacheTest, addShouldBeIgnoredWhenNotOpen)
+    {
+        CellRefCache cache;
+        cache.add(mCell.mId, {});
+        EXPECT_EQ(cache.getAddedCount(), 0);
+    }
+}
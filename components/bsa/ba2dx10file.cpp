@@ -1,38 +1,25 @@
 #include "ba2dx10file.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
-#include <lz4frame.h>
-
-#if defined(_MSC_VER)
-// why is this necessary? These are included with /external:I
-#pragma warning(push)
-#pragma warning(disable : 4706)
-#pragma warning(disable : 4702)
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#pragma warning(pop)
-#else
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#endif
-
-#include <boost/iostreams/device/array.hpp>
 #include <components/bsa/ba2file.hpp>
+#include <components/bsa/decompress.hpp>
 #include <components/bsa/memorystream.hpp>
 #include <components/esm/fourcc.hpp>
 #include <components/files/constrainedfilestream.hpp>
 #include <components/files/conversion.hpp>
 #include <components/misc/strings/lower.hpp>
+#include <components/misc/workerpool.hpp>
 
 namespace Bsa
 {
+    // Decompressing chunks of smaller textures in parallel costs more than it saves
+    constexpr std::size_t sMinParallelTextureSize = 1024 * 1024;
+
     BA2DX10File::BA2DX10File() {}
 
     BA2DX10File::~BA2DX10File() = default;
@@ -41,6 +28,8 @@ namespace Bsa
     {
         mFiles.clear();
         mFiles.reserve(fileCount);
+        mFileRecords.clear();
+        mFileRecords.reserve(fileCount);
         for (uint32_t i = 0; i < fileCount; ++i)
         {
             uint32_t nameHash, extHash, dirHash;
@@ -80,7 +69,8 @@ namespace Bsa
                     fail("Corrupted BSA");
             }
 
-            mFolders[dirHash][{ nameHash, extHash }] = std::move(file);
+            mFolders[dirHash][{ nameHash, extHash }] = mFileRecords.size();
+            mFileRecords.push_back(std::move(file));
 
             FileStruct fileStruct{};
             mFiles.push_back(fileStruct);
@@ -160,7 +150,7 @@ namespace Bsa
         mIsLoaded = true;
     }
 
-    std::optional<BA2DX10File::FileRecord> BA2DX10File::getFileRecord(const std::string& str) const
+    const BA2DX10File::FileRecord* BA2DX10File::getFileRecord(const std::string& str) const
     {
         for (const auto c : str)
         {
@@ -188,14 +178,14 @@ namespace Bsa
         uint32_t folderHash = generateHash(folder);
         auto it = mFolders.find(folderHash);
         if (it == mFolders.end())
-            return std::nullopt; // folder not found
+            return nullptr; // folder not found
 
         uint32_t fileHash = generateHash(fileName);
         uint32_t extHash = generateExtensionHash(ext);
         auto iter = it->second.find({ fileHash, extHash });
         if (iter == it->second.end())
-            return std::nullopt; // file not found
-        return iter->second;
+            return nullptr; // file not found
+        return &mFileRecords[iter->second];
     }
 
 #pragma pack(push)
@@ -240,9 +230,7 @@ namespace Bsa
 
     Files::IStreamPtr BA2DX10File::getFile(const FileStruct* file)
     {
-        if (auto fileRec = getFileRecord(file->name()); fileRec)
-            return getFile(*fileRec);
-        fail("File not found: " + std::string(file->name()));
+        return getFile(mFileRecords[getFileIndex(file)]);
     }
 
     void BA2DX10File::addFile(const std::string& filename, std::istream& file)
@@ -253,7 +241,7 @@ namespace Bsa
 
     Files::IStreamPtr BA2DX10File::getFile(const char* file)
     {
-        if (auto fileRec = getFileRecord(file); fileRec)
+        if (const FileRecord* fileRec = getFileRecord(file); fileRec != nullptr)
             return getFile(*fileRec);
         fail("File not found: " + std::string(file));
     }
@@ -652,32 +640,46 @@ namespace Bsa
         buff = (char*)std::memcpy(buff, &dds, sizeof(uint32_t)) + sizeof(uint32_t);
         std::memcpy(buff, &header, headerSize);
 
+        std::vector<size_t> chunkOffsets;
+        chunkOffsets.reserve(fileRecord.texturesChunks.size());
         size_t offset = sizeof(uint32_t) + headerSize;
-        // append chunks
         for (const auto& c : fileRecord.texturesChunks)
         {
+            chunkOffsets.push_back(offset);
+            offset += c.size;
+        }
+
+        // append chunks
+        const auto readChunk = [&](std::size_t index) {
+            const TextureChunkRecord& c = fileRecord.texturesChunks[index];
+            char* const output = memoryStreamPtr->getRawData() + chunkOffsets[index];
+            std::vector<char> buffer;
             if (c.packedSize != 0)
             {
-                Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.packedSize);
-                std::istream* fileStream = streamPtr.get();
-
-                boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
-                inputStreamBuf.push(boost::iostreams::zlib_decompressor());
-                inputStreamBuf.push(*fileStream);
-
-                boost::iostreams::basic_array_sink<char> sr(memoryStreamPtr->getRawData() + offset, c.size);
-                boost::iostreams::copy(inputStreamBuf, sr);
+                const std::string_view input = readRegion(c.offset, c.packedSize, buffer);
+                try
+                {
+                    decompressZlib(input, output, c.size);
+                }
+                catch (const std::exception& e)
+                {
+                    fail(e.what());
+                }
             }
             // uncompressed chunk
             else
             {
-                Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.size);
-                std::istream* fileStream = streamPtr.get();
-
-                fileStream->read(memoryStreamPtr->getRawData() + offset, c.size);
+                const std::string_view input = readRegion(c.offset, c.size, buffer);
+                std::memcpy(output, input.data(), c.size);
             }
-            offset += c.size;
-        }
+        };
+
+        // Large textures consist of many chunks which are independent of each other
+        if (fileRecord.texturesChunks.size() > 1 && textureSize >= sMinParallelTextureSize)
+            Misc::WorkerPool::get().parallelFor(fileRecord.texturesChunks.size(), readChunk);
+        else
+            for (std::size_t i = 0; i < fileRecord.texturesChunks.size(); ++i)
+                readChunk(i);
 
         return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
     }
@@ -3,7 +3,6 @@
 
 #include <list>
 #include <map>
-#include <optional>
 #include <string>
 #include <vector>
 
@@ -36,12 +35,16 @@ namespace Bsa
 
         uint32_t mVersion{ 0u };
 
-        using FolderRecord = std::map<std::pair<uint32_t, uint32_t>, FileRecord>;
+        /// Records of the files from mFiles with the same index
+        std::vector<FileRecord> mFileRecords;
+
+        /// Maps name and extension hashes to an index in mFileRecords
+        using FolderRecord = std::map<std::pair<uint32_t, uint32_t>, std::size_t>;
         std::map<uint32_t, FolderRecord> mFolders;
 
         std::list<std::vector<char>> mFileNames;
 
-        std::optional<FileRecord> getFileRecord(const std::string& str) const;
+        const FileRecord* getFileRecord(const std::string& str) const;
 
         Files::IStreamPtr getFile(const FileRecord& fileRecord);
 
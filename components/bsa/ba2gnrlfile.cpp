@@ -4,25 +4,8 @@
 #include <filesystem>
 #include <fstream>
 
-#include <lz4frame.h>
-
-#if defined(_MSC_VER)
-// why is this necessary? These are included with /external:I
-#pragma warning(push)
-#pragma warning(disable : 4706)
-#pragma warning(disable : 4702)
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#pragma warning(pop)
-#else
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#endif
-
-#include <boost/iostreams/device/array.hpp>
 #include <components/bsa/ba2file.hpp>
+#include <components/bsa/decompress.hpp>
 #include <components/bsa/memorystream.hpp>
 #include <components/esm/fourcc.hpp>
 #include <components/files/constrainedfilestream.hpp>
@@ -31,20 +14,6 @@
 
 namespace Bsa
 {
-    // special marker for invalid records,
-    const uint32_t sInvalidOffset = std::numeric_limits<uint32_t>::max();
-
-    BA2GNRLFile::FileRecord::FileRecord()
-        : size(0)
-        , offset(sInvalidOffset)
-    {
-    }
-
-    bool BA2GNRLFile::FileRecord::isValid() const
-    {
-        return offset != sInvalidOffset;
-    }
-
     BA2GNRLFile::BA2GNRLFile() {}
 
     BA2GNRLFile::~BA2GNRLFile() = default;
@@ -53,6 +22,8 @@ namespace Bsa
     {
         mFiles.clear();
         mFiles.reserve(fileCount);
+        mFileRecords.clear();
+        mFileRecords.reserve(fileCount);
         for (uint32_t i = 0; i < fileCount; ++i)
         {
             uint32_t nameHash, extHash, dirHash;
@@ -72,7 +43,8 @@ namespace Bsa
             if (baadfood != 0xBAADF00D)
                 fail("Corrupted BSA");
 
-            mFolders[dirHash][{ nameHash, extHash }] = file;
+            mFolders[dirHash][{ nameHash, extHash }] = mFileRecords.size();
+            mFileRecords.push_back(file);
 
             FileStruct fileStruct{};
             fileStruct.fileSize = file.size;
@@ -150,7 +122,7 @@ namespace Bsa
         mIsLoaded = true;
     }
 
-    BA2GNRLFile::FileRecord BA2GNRLFile::getFileRecord(const std::string& str) const
+    const BA2GNRLFile::FileRecord* BA2GNRLFile::getFileRecord(const std::string& str) const
     {
         for (const auto c : str)
         {
@@ -178,24 +150,19 @@ namespace Bsa
         uint32_t folderHash = generateHash(folder);
         auto it = mFolders.find(folderHash);
         if (it == mFolders.end())
-            return FileRecord(); // folder not found, return default which has offset of sInvalidOffset
+            return nullptr;
 
         uint32_t fileHash = generateHash(fileName);
         uint32_t extHash = generateExtensionHash(ext);
         auto iter = it->second.find({ fileHash, extHash });
         if (iter == it->second.end())
-            return FileRecord(); // file not found, return default which has offset of sInvalidOffset
-        return iter->second;
+            return nullptr;
+        return &mFileRecords[iter->second];
     }
 
     Files::IStreamPtr BA2GNRLFile::getFile(const FileStruct* file)
     {
-        FileRecord fileRec = getFileRecord(file->name());
-        if (!fileRec.isValid())
-        {
-            fail("File not found: " + std::string(file->name()));
-        }
-        return getFile(fileRec);
+        return getFile(mFileRecords[getFileIndex(file)]);
     }
 
     void BA2GNRLFile::addFile(const std::string& filename, std::istream& file)
@@ -206,31 +173,28 @@ namespace Bsa
 
     Files::IStreamPtr BA2GNRLFile::getFile(const char* file)
     {
-        FileRecord fileRec = getFileRecord(file);
-        if (!fileRec.isValid())
+        const FileRecord* fileRec = getFileRecord(file);
+        if (fileRec == nullptr)
         {
             fail("File not found: " + std::string(file));
         }
-        return getFile(fileRec);
+        return getFile(*fileRec);
     }
 
     Files::IStreamPtr BA2GNRLFile::getFile(const FileRecord& fileRecord)
     {
-        const uint32_t inputSize = fileRecord.packedSize ? fileRecord.packedSize : fileRecord.size;
-        Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, fileRecord.offset, inputSize);
+        if (!fileRecord.packedSize)
+            return openRegion(fileRecord.offset, fileRecord.size);
+        std::vector<char> buffer;
+        const std::string_view input = readRegion(fileRecord.offset, fileRecord.packedSize, buffer);
         auto memoryStreamPtr = std::make_unique<MemoryInputStream>(fileRecord.size);
-        if (fileRecord.packedSize)
+        try
         {
-            boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
-            inputStreamBuf.push(boost::iostreams::zlib_decompressor());
-            inputStreamBuf.push(*streamPtr);
-
-            boost::iostreams::basic_array_sink<char> sr(memoryStreamPtr->getRawData(), fileRecord.size);
-            boost::iostreams::copy(inputStreamBuf, sr);
+            decompressZlib(input, memoryStreamPtr->getRawData(), fileRecord.size);
         }
-        else
+        catch (const std::exception& e)
         {
-            streamPtr->read(memoryStreamPtr->getRawData(), fileRecord.size);
+            fail(e.what());
         }
         return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
     }
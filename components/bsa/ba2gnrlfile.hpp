@@ -15,21 +15,23 @@ namespace Bsa
     private:
         struct FileRecord
         {
-            FileRecord();
-            uint32_t size;
-            uint32_t offset;
+            uint32_t size = 0;
+            uint32_t offset = 0;
             uint32_t packedSize = 0;
-            bool isValid() const;
         };
 
         uint32_t mVersion{ 0u };
 
-        using FolderRecord = std::map<std::pair<uint32_t, uint32_t>, FileRecord>;
+        /// Records of the files from mFiles with the same index
+        std::vector<FileRecord> mFileRecords;
+
+        /// Maps name and extension hashes to an index in mFileRecords
+        using FolderRecord = std::map<std::pair<uint32_t, uint32_t>, std::size_t>;
         std::map<uint32_t, FolderRecord> mFolders;
 
         std::list<std::vector<char>> mFileNames;
 
-        FileRecord getFileRecord(const std::string& str) const;
+        const FileRecord* getFileRecord(const std::string& str) const;
 
         Files::IStreamPtr getFile(const FileRecord& fileRecord);
 
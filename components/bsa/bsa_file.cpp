@@ -23,14 +23,18 @@
 
 #include "bsa_file.hpp"
 
+#include <components/bsa/memorystream.hpp>
+#include <components/debug/debuglog.hpp>
 #include <components/esm/fourcc.hpp>
 #include <components/files/constrainedfilestream.hpp>
+#include <components/platform/file.hpp>
 
 #include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 
 using namespace Bsa;
 
@@ -234,14 +238,28 @@ void Bsa::BSAFile::writeHeader()
 }
 
 /// Open an archive file.
-void BSAFile::open(const std::filesystem::path& file)
+void BSAFile::open(const std::filesystem::path& file, bool memoryMapped)
 {
     if (mIsLoaded)
         close();
 
     mFilepath = file;
     if (std::filesystem::exists(file))
+    {
         readHeader();
+        if (memoryMapped)
+        {
+            try
+            {
+                mMapping = std::make_shared<const Platform::File::MappedFile>(file);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Failed to map archive " << file << " into memory, fallback to reading: "
+                                    << e.what();
+            }
+        }
+    }
     else
     {
         {
@@ -260,12 +278,45 @@ void Bsa::BSAFile::close()
 
     mFiles.clear();
     mStringBuf.clear();
+    mMapping.reset();
     mIsLoaded = false;
 }
 
+Files::IStreamPtr Bsa::BSAFile::openRegion(std::size_t offset, std::size_t size) const
+{
+    if (mMapping == nullptr)
+        return Files::openConstrainedFileStream(mFilepath, offset, size);
+    if (offset > mMapping->size() || size > mMapping->size() - offset)
+        fail("Region is outside the archive");
+    return std::make_unique<MappedInputStream>(mMapping, mMapping->data() + offset, size);
+}
+
+std::string_view Bsa::BSAFile::readRegion(std::size_t offset, std::size_t size, std::vector<char>& buffer) const
+{
+    if (mMapping != nullptr)
+    {
+        if (offset > mMapping->size() || size > mMapping->size() - offset)
+            fail("Region is outside the archive");
+        return std::string_view(mMapping->data() + offset, size);
+    }
+    buffer.resize(size);
+    Files::IStreamPtr stream = Files::openConstrainedFileStream(mFilepath, offset, size);
+    stream->read(buffer.data(), size);
+    if (static_cast<std::size_t>(stream->gcount()) != size)
+        fail("Failed to read " + std::to_string(size) + " bytes at offset " + std::to_string(offset));
+    return std::string_view(buffer.data(), size);
+}
+
+std::size_t Bsa::BSAFile::getFileIndex(const FileStruct* file) const
+{
+    if (std::less<>()(file, mFiles.data()) || !std::less<>()(file, mFiles.data() + mFiles.size()))
+        fail("File does not belong to the archive");
+    return static_cast<std::size_t>(file - mFiles.data());
+}
+
 Files::IStreamPtr Bsa::BSAFile::getFile(const FileStruct* file)
 {
-    return Files::openConstrainedFileStream(mFilepath, file->offset, file->fileSize);
+    return openRegion(file->offset, file->fileSize);
 }
 
 void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
@@ -273,6 +324,9 @@ void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
     if (!mIsLoaded)
         fail("Unable to add file " + filename + " the archive is not opened");
 
+    if (mMapping != nullptr)
+        fail("Unable to add file " + filename + " the archive is memory mapped");
+
     auto newStartOfDataBuffer = 12 + (12 + 8) * (mFiles.size() + 1) + mStringBuf.size() + filename.size() + 1;
     if (mFiles.empty())
         std::filesystem::resize_file(mFilepath, newStartOfDataBuffer);
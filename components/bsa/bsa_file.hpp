@@ -26,12 +26,19 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <components/files/conversion.hpp>
 #include <components/files/istreamptr.hpp>
 
+namespace Platform::File
+{
+    class MappedFile;
+}
+
 namespace Bsa
 {
 
@@ -96,6 +103,9 @@ namespace Bsa
         /// Used for error messages
         std::filesystem::path mFilepath;
 
+        /// Archive contents mapped into memory, only when opened as memory mapped
+        std::shared_ptr<const Platform::File::MappedFile> mMapping;
+
         /// Error handling
         [[noreturn]] void fail(const std::string& msg) const;
 
@@ -103,6 +113,17 @@ namespace Bsa
         virtual void readHeader();
         virtual void writeHeader();
 
+        /// Open a stream over a region of the archive. For memory mapped archive the stream is a view over the
+        /// mapping, otherwise the region is read from the file.
+        Files::IStreamPtr openRegion(std::size_t offset, std::size_t size) const;
+
+        /// Get contents of a region of the archive. For memory mapped archive returns a view over the mapping,
+        /// otherwise reads the region into the buffer.
+        std::string_view readRegion(std::size_t offset, std::size_t size, std::vector<char>& buffer) const;
+
+        /// Get position of the file in the table of files. Fails if the file does not belong to this archive.
+        std::size_t getFileIndex(const FileStruct* file) const;
+
     public:
         /* -----------------------------------
          * BSA management methods
@@ -120,7 +141,9 @@ namespace Bsa
         }
 
         /// Open an archive file.
-        void open(const std::filesystem::path& file);
+        /// @param memoryMapped map existing archive into memory to serve files without reading and copying.
+        /// Such archive can not be modified.
+        void open(const std::filesystem::path& file, bool memoryMapped = false);
 
         void close();
 
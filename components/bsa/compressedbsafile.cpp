@@ -25,26 +25,11 @@
 #include "compressedbsafile.hpp"
 
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
-#include <lz4frame.h>
-
-#if defined(_MSC_VER)
-#pragma warning(push)
-#pragma warning(disable : 4706)
-#pragma warning(disable : 4702)
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#pragma warning(pop)
-#else
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filter/zlib.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#endif
-
-#include <boost/iostreams/device/array.hpp>
+#include <components/bsa/decompress.hpp>
 #include <components/bsa/memorystream.hpp>
 #include <components/files/constrainedfilestream.hpp>
 #include <components/files/conversion.hpp>
@@ -183,6 +168,7 @@ namespace Bsa
         if (input.bad())
             fail("Failed to read compressed BSA filenames: input error");
 
+        mFileRecords.clear();
         for (auto& [folder, filelist] : folders)
         {
             std::map<std::uint64_t, FileRecord> fileMap;
@@ -197,13 +183,14 @@ namespace Bsa
                 fileStruct.offset = fileRec.mOffset;
                 fileStruct.setNameInfos(0, &fileRec.mName);
                 mFiles.emplace_back(fileStruct);
+                mFileRecords.push_back(&fileRec);
             }
         }
 
         mIsLoaded = true;
     }
 
-    CompressedBSAFile::FileRecord CompressedBSAFile::getFileRecord(const std::string& str) const
+    const CompressedBSAFile::FileRecord* CompressedBSAFile::getFileRecord(const std::string& str) const
     {
         for (const auto c : str)
         {
@@ -231,24 +218,19 @@ namespace Bsa
 
         auto it = mFolders.find(folderHash);
         if (it == mFolders.end())
-            return FileRecord();
+            return nullptr;
 
         std::uint64_t fileHash = generateHash(stem, ext);
         auto iter = it->second.mFiles.find(fileHash);
         if (iter == it->second.mFiles.end())
-            return FileRecord();
+            return nullptr;
 
-        return iter->second;
+        return &iter->second;
     }
 
     Files::IStreamPtr CompressedBSAFile::getFile(const FileStruct* file)
     {
-        FileRecord fileRec = getFileRecord(file->name());
-        if (fileRec.mOffset == std::numeric_limits<uint32_t>::max())
-        {
-            fail("File not found: " + std::string(file->name()));
-        }
-        return getFile(fileRec);
+        return getFile(*mFileRecords[getFileIndex(file)]);
     }
 
     void CompressedBSAFile::addFile(const std::string& filename, std::istream& file)
@@ -259,67 +241,56 @@ namespace Bsa
 
     Files::IStreamPtr CompressedBSAFile::getFile(const char* file)
     {
-        FileRecord fileRec = getFileRecord(file);
-        if (fileRec.mOffset == std::numeric_limits<uint32_t>::max())
+        const FileRecord* fileRec = getFileRecord(file);
+        if (fileRec == nullptr)
         {
             fail("File not found: " + std::string(file));
         }
-        return getFile(fileRec);
+        return getFile(*fileRec);
     }
 
     Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
     {
-        size_t size = fileRecord.mSize & (~FileSizeFlag_Compression);
-        size_t resultSize = size;
-        Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, fileRecord.mOffset, size);
-        bool compressed = (fileRecord.mSize != size) == ((mHeader.mFlags & ArchiveFlag_Compress) == 0);
+        const size_t size = fileRecord.mSize & (~FileSizeFlag_Compression);
+        const bool compressed = (fileRecord.mSize != size) == ((mHeader.mFlags & ArchiveFlag_Compress) == 0);
+        std::vector<char> buffer;
+        std::string_view input = readRegion(fileRecord.mOffset, size, buffer);
         if ((mHeader.mFlags & ArchiveFlag_EmbeddedNames) != 0)
         {
             // Skip over the embedded file name
-            uint8_t length = 0;
-            streamPtr->read(reinterpret_cast<char*>(&length), 1);
-            streamPtr->ignore(length);
-            size -= length + sizeof(uint8_t);
+            const std::size_t length = input.empty() ? 0 : static_cast<std::uint8_t>(input.front());
+            if (input.size() < length + sizeof(uint8_t))
+                fail("Embedded file name is outside the file record");
+            input.remove_prefix(length + sizeof(uint8_t));
         }
-        if (compressed)
+
+        if (!compressed)
         {
-            streamPtr->read(reinterpret_cast<char*>(&resultSize), sizeof(uint32_t));
-            size -= sizeof(uint32_t);
+            if (mMapping != nullptr)
+                return std::make_unique<MappedInputStream>(mMapping, input.data(), input.size());
+            auto memoryStreamPtr = std::make_unique<MemoryInputStream>(input.size());
+            std::memcpy(memoryStreamPtr->getRawData(), input.data(), input.size());
+            return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
         }
+
+        std::uint32_t uncompressedSize = 0;
+        if (input.size() < sizeof(uncompressedSize))
+            fail("Compressed file record is too small");
+        std::memcpy(&uncompressedSize, input.data(), sizeof(uncompressedSize));
+        input.remove_prefix(sizeof(uncompressedSize));
+        const size_t resultSize = uncompressedSize;
         auto memoryStreamPtr = std::make_unique<MemoryInputStream>(resultSize);
 
-        if (compressed)
+        try
         {
             if (mHeader.mVersion != Version_SSE)
-            {
-                boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
-                inputStreamBuf.push(boost::iostreams::zlib_decompressor());
-                inputStreamBuf.push(*streamPtr);
-
-                boost::iostreams::basic_array_sink<char> sr(memoryStreamPtr->getRawData(), resultSize);
-                boost::iostreams::copy(inputStreamBuf, sr);
-            }
+                decompressZlib(input, memoryStreamPtr->getRawData(), resultSize);
             else
-            {
-                auto buffer = std::vector<char>(size);
-                streamPtr->read(buffer.data(), size);
-                LZ4F_decompressionContext_t context = nullptr;
-                LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
-                LZ4F_decompressOptions_t options = {};
-                LZ4F_errorCode_t errorCode = LZ4F_decompress(
-                    context, memoryStreamPtr->getRawData(), &resultSize, buffer.data(), &size, &options);
-                if (LZ4F_isError(errorCode))
-                    fail("LZ4 decompression error (file " + Files::pathToUnicodeString(mFilepath)
-                        + "): " + LZ4F_getErrorName(errorCode));
-                errorCode = LZ4F_freeDecompressionContext(context);
-                if (LZ4F_isError(errorCode))
-                    fail("LZ4 decompression error (file " + Files::pathToUnicodeString(mFilepath)
-                        + "): " + LZ4F_getErrorName(errorCode));
-            }
+                decompressLz4Frame(input, memoryStreamPtr->getRawData(), resultSize);
         }
-        else
+        catch (const std::exception& e)
         {
-            streamPtr->read(memoryStreamPtr->getRawData(), size);
+            fail(e.what());
         }
 
         return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
@@ -108,7 +108,10 @@ namespace Bsa
 
         std::map<std::uint64_t, FolderRecord> mFolders;
 
-        FileRecord getFileRecord(const std::string& str) const;
+        /// Records of the files from mFiles with the same index
+        std::vector<const FileRecord*> mFileRecords;
+
+        const FileRecord* getFileRecord(const std::string& str) const;
 
         /// \brief Normalizes given filename or folder and generates format-compatible hash.
         static std::uint64_t generateHash(const std::filesystem::path& stem, std::string extension);
@@ -0,0 +1,37 @@
+#include "decompress.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include <lz4frame.h>
+#include <zlib.h>
+
+namespace Bsa
+{
+    std::size_t decompressZlib(std::string_view input, char* output, std::size_t outputSize)
+    {
+        uLongf outputLength = static_cast<uLongf>(outputSize);
+        const int result = uncompress(reinterpret_cast<Bytef*>(output), &outputLength,
+            reinterpret_cast<const Bytef*>(input.data()), static_cast<uLong>(input.size()));
+        if (result != Z_OK)
+            throw std::runtime_error("zlib decompression error: " + std::to_string(result));
+        return static_cast<std::size_t>(outputLength);
+    }
+
+    std::size_t decompressLz4Frame(std::string_view input, char* output, std::size_t outputSize)
+    {
+        LZ4F_decompressionContext_t context = nullptr;
+        LZ4F_errorCode_t errorCode = LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
+        if (LZ4F_isError(errorCode))
+            throw std::runtime_error(std::string("LZ4 decompression error: ") + LZ4F_getErrorName(errorCode));
+        std::size_t inputSize = input.size();
+        LZ4F_decompressOptions_t options = {};
+        errorCode = LZ4F_decompress(context, output, &outputSize, input.data(), &inputSize, &options);
+        const LZ4F_errorCode_t freeErrorCode = LZ4F_freeDecompressionContext(context);
+        if (LZ4F_isError(errorCode))
+            throw std::runtime_error(std::string("LZ4 decompression error: ") + LZ4F_getErrorName(errorCode));
+        if (LZ4F_isError(freeErrorCode))
+            throw std::runtime_error(std::string("LZ4 decompression error: ") + LZ4F_getErrorName(freeErrorCode));
+        return outputSize;
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef BSA_DECOMPRESS_H
+#define BSA_DECOMPRESS_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace Bsa
+{
+    /// Decompress zlib stream into the preallocated output buffer.
+    /// @return number of bytes written to the output, throws on corrupted input or insufficient output size.
+    std::size_t decompressZlib(std::string_view input, char* output, std::size_t outputSize);
+
+    /// Decompress LZ4 frame into the preallocated output buffer.
+    /// @return number of bytes written to the output, throws on corrupted input.
+    std::size_t decompressLz4Frame(std::string_view input, char* output, std::size_t outputSize);
+}
+
+#endif
@@ -27,7 +27,10 @@
 #define BSA_MEMORY_STREAM_H
 
 #include <components/files/memorystream.hpp>
+#include <components/platform/file.hpp>
+
 #include <istream>
+#include <memory>
 #include <vector>
 
 namespace Bsa
@@ -53,5 +56,25 @@ namespace Bsa
         char* getRawData() { return this->data(); }
     };
 
+    /**
+        Read-only stream over a region of a memory mapped archive.
+
+        Data is not copied, the mapping is kept alive while the stream exists.
+     */
+    class MappedInputStream : public Files::MemBuf, public std::istream
+    {
+    public:
+        explicit MappedInputStream(
+            std::shared_ptr<const Platform::File::MappedFile> mapping, const char* data, size_t size)
+            : Files::MemBuf(data, size)
+            , std::istream(static_cast<std::streambuf*>(this))
+            , mMapping(std::move(mapping))
+        {
+        }
+
+    private:
+        std::shared_ptr<const Platform::File::MappedFile> mMapping;
+    };
+
 }
 #endif
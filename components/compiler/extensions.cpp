@@ -126,7 +126,7 @@ namespace Compiler
             if (iter->second.mCodeExplicit == -1)
                 throw std::logic_error("explicit references not supported");
 
-            int index = literals.addString(id);
+            int index = literals.addRefId(id);
             Generator::pushInt(code, literals, index);
         }
 
@@ -171,7 +171,7 @@ namespace Compiler
             if (iter->second.mCodeExplicit == -1)
                 throw std::logic_error("explicit references not supported");
 
-            int index = literals.addString(id);
+            int index = literals.addRefId(id);
             Generator::pushInt(code, literals, index);
         }
 
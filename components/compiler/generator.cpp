@@ -300,6 +300,12 @@ namespace Compiler::Generator
         opPushInt(code, index);
     }
 
+    void pushRefId(CodeContainer& code, Literals& literals, const std::string& value)
+    {
+        int index = literals.addRefId(value);
+        opPushInt(code, index);
+    }
+
     void assignToLocal(CodeContainer& code, char localType, int localIndex, const CodeContainer& value, char valueType)
     {
         opPushInt(code, localIndex);
@@ -665,7 +671,7 @@ namespace Compiler::Generator
 
         opPushInt(code, index);
 
-        index = literals.addString(id);
+        index = literals.addRefId(id);
 
         opPushInt(code, index);
 
@@ -713,7 +719,7 @@ namespace Compiler::Generator
 
         opPushInt(code, index);
 
-        index = literals.addString(id);
+        index = literals.addRefId(id);
 
         opPushInt(code, index);
 
@@ -57,6 +57,8 @@ namespace Compiler
 
         void pushString(CodeContainer& code, Literals& literals, const std::string& value);
 
+        void pushRefId(CodeContainer& code, Literals& literals, const std::string& value);
+
         void assignToLocal(
             CodeContainer& code, char localType, int localIndex, const CodeContainer& value, char valueType);
 
@@ -32,10 +32,20 @@ namespace Compiler
         return index;
     }
 
+    int Literals::addRefId(const std::string& value)
+    {
+        int index = addString(value);
+
+        mRefIds.push_back(index);
+
+        return index;
+    }
+
     void Literals::clear()
     {
         mIntegers.clear();
         mFloats.clear();
         mStrings.clear();
+        mRefIds.clear();
     }
 }
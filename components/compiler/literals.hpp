@@ -15,6 +15,7 @@ namespace Compiler
         std::vector<Interpreter::Type_Integer> mIntegers;
         std::vector<Interpreter::Type_Float> mFloats;
         std::vector<std::string> mStrings;
+        std::vector<int> mRefIds;
 
     public:
         const std::vector<Interpreter::Type_Integer>& getIntegers() const { return mIntegers; }
@@ -23,6 +24,9 @@ namespace Compiler
 
         const std::vector<std::string>& getStrings() const { return mStrings; }
 
+        const std::vector<int>& getRefIds() const { return mRefIds; }
+        ///< indices of string literals used as ids.
+
         int addInteger(Interpreter::Type_Integer value);
         ///< add integer liternal and return index.
 
@@ -32,6 +36,9 @@ namespace Compiler
         int addString(const std::string& value);
         ///< add string literal and return value.
 
+        int addRefId(const std::string& value);
+        ///< add string literal used as id and return index.
+
         void clear();
         ///< remove all literals.
     };
@@ -15,12 +15,19 @@ namespace Compiler
 
     Interpreter::Program Output::getProgram() const
     {
-        return Interpreter::Program{
+        Interpreter::Program program{
             .mInstructions = mCode,
             .mIntegers = mLiterals.getIntegers(),
             .mFloats = mLiterals.getFloats(),
             .mStrings = mLiterals.getStrings(),
         };
+
+        // Resolve ids once here so running the program does not need to look them up by name
+        program.mRefIds.resize(program.mStrings.size());
+        for (const int index : mLiterals.getRefIds())
+            program.mRefIds[index] = ESM::RefId::stringRefId(program.mStrings[index]);
+
+        return program;
     }
 
     const Literals& Output::getLiterals() const
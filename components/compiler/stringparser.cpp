@@ -28,7 +28,7 @@ namespace Compiler
         if (!mDiscard)
         {
             if (mSmashCase)
-                Generator::pushString(mCode, mLiterals, Misc::StringUtils::lowerCase(name));
+                Generator::pushRefId(mCode, mLiterals, Misc::StringUtils::lowerCase(name));
             else
                 Generator::pushString(mCode, mLiterals, name);
         }
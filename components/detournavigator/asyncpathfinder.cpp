@@ -0,0 +1,178 @@
+#include "asyncpathfinder.hpp"
+#include "debug.hpp"
+#include "findsmoothpath.hpp"
+#include "navmeshcacheitem.hpp"
+#include "settings.hpp"
+#include "settingsutils.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/guarded.hpp>
+
+#include <DetourNavMeshQuery.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace DetourNavigator
+{
+    namespace
+    {
+        double toSeconds(std::chrono::steady_clock::duration value)
+        {
+            return std::chrono::duration<double>(value).count();
+        }
+    }
+
+    AsyncPathFinder::AsyncPathFinder(const Settings& settings)
+        : mSettings(settings)
+    {
+        for (std::size_t i = 0; i < mSettings.get().mAsyncPathFinderThreads; ++i)
+            mThreads.emplace_back([&] { process(); });
+    }
+
+    AsyncPathFinder::~AsyncPathFinder()
+    {
+        stop();
+    }
+
+    SharedPathQuery AsyncPathFinder::request(const PathRequest& request, const SharedNavMeshCacheItem& navMesh)
+    {
+        auto query = std::make_shared<PathQuery>(request, navMesh);
+        if (!query->isDone())
+            mRequested.push_back(query);
+        return query;
+    }
+
+    void AsyncPathFinder::dispatch()
+    {
+        if (mThreads.empty())
+        {
+            dtNavMeshQuery navMeshQuery;
+            for (const std::shared_ptr<PathQuery>& query : mRequested)
+            {
+                if (query.use_count() == 1)
+                    ++mCancelled;
+                else
+                {
+                    query->setResult(findPath(navMeshQuery, *query));
+                    const std::chrono::steady_clock::duration latency
+                        = std::chrono::steady_clock::now() - query->mRequestTime;
+                    ++mDone;
+                    mTotalLatency += latency;
+                    mMaxLatency = std::max(mMaxLatency, latency);
+                }
+            }
+            mRequested.clear();
+        }
+
+        std::lock_guard lock(mMutex);
+
+        mLastStats.mDone = std::exchange(mDone, 0);
+        mLastStats.mCancelled = std::exchange(mCancelled, 0);
+        mLastStats.mAverageLatency
+            = mLastStats.mDone == 0 ? 0 : toSeconds(mTotalLatency) / static_cast<double>(mLastStats.mDone);
+        mLastStats.mMaxLatency = toSeconds(mMaxLatency);
+        mTotalLatency = {};
+        mMaxLatency = {};
+
+        if (mRequested.empty())
+            return;
+
+        std::move(mRequested.begin(), mRequested.end(), std::back_inserter(mQueue));
+        mRequested.clear();
+        mHasQuery.notify_all();
+    }
+
+    void AsyncPathFinder::stop()
+    {
+        {
+            std::lock_guard lock(mMutex);
+            mShouldStop = true;
+            mQueue.clear();
+            mHasQuery.notify_all();
+        }
+        for (std::thread& thread : mThreads)
+            if (thread.joinable())
+                thread.join();
+    }
+
+    AsyncPathFinderStats AsyncPathFinder::getStats() const
+    {
+        std::lock_guard lock(mMutex);
+        AsyncPathFinderStats result = mLastStats;
+        result.mQueued = mQueue.size();
+        result.mProcessing = mProcessing;
+        return result;
+    }
+
+    void AsyncPathFinder::process() noexcept
+    {
+        Log(Debug::Debug) << "Start process path queries by thread=" << std::this_thread::get_id();
+        dtNavMeshQuery navMeshQuery;
+        std::unique_lock lock(mMutex);
+        while (true)
+        {
+            mHasQuery.wait(lock, [&] { return mShouldStop || !mQueue.empty(); });
+            if (mShouldStop)
+                break;
+
+            std::shared_ptr<PathQuery> query = std::move(mQueue.front());
+            mQueue.pop_front();
+
+            // Nobody waits for the result
+            if (query.use_count() == 1)
+            {
+                ++mCancelled;
+                continue;
+            }
+
+            ++mProcessing;
+            lock.unlock();
+
+            PathResult result;
+            try
+            {
+                result = findPath(navMeshQuery, *query);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "Failed to find path: " << e.what();
+                result = PathResult{ .mStatus = Status::FindPathOverPolygonsFailed, .mPath = {} };
+            }
+
+            const std::chrono::steady_clock::duration latency = std::chrono::steady_clock::now() - query->mRequestTime;
+
+            lock.lock();
+            --mProcessing;
+            ++mDone;
+            mTotalLatency += latency;
+            mMaxLatency = std::max(mMaxLatency, latency);
+            query->setResult(std::move(result));
+        }
+        Log(Debug::Debug) << "Stop path queries processing by thread=" << std::this_thread::get_id();
+    }
+
+    PathResult AsyncPathFinder::findPath(dtNavMeshQuery& navMeshQuery, const PathQuery& query) const
+    {
+        const Settings& settings = mSettings.get();
+        const PathRequest& request = query.mRequest;
+        PathResult result;
+        auto out = std::back_inserter(result.mPath);
+        FromNavMeshCoordinatesIterator outTransform(out, settings.mRecast);
+        const auto locked = query.mNavMesh->lockConst();
+        // Query is initialized for each search because navmesh may differ from the previous one
+        if (const dtStatus status = navMeshQuery.init(&locked->getImpl(), settings.mDetour.mMaxNavMeshQueryNodes);
+            dtStatusFailed(status))
+        {
+            Log(Debug::Error) << "Failed to init dtNavMeshQuery for async path finder: " << WriteDtStatus{ status };
+            result.mStatus = Status::InitNavMeshQueryFailed;
+            return result;
+        }
+        result.mStatus = findSmoothPath(navMeshQuery,
+            toNavMeshCoordinates(settings.mRecast, request.mAgentBounds.mHalfExtents),
+            toNavMeshCoordinates(settings.mRecast, request.mStart), toNavMeshCoordinates(settings.mRecast, request.mEnd),
+            request.mIncludeFlags, request.mAreaCosts, settings.mDetour, request.mEndTolerance, outTransform);
+        return result;
+    }
+}
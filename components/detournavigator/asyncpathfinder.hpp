@@ -0,0 +1,66 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+
+#include "pathquery.hpp"
+#include "sharednavmeshcacheitem.hpp"
+#include "stats.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class dtNavMeshQuery;
+
+namespace DetourNavigator
+{
+    struct Settings;
+
+    /**
+     * @brief AsyncPathFinder runs path queries on background threads.
+     * Queries are collected until dispatch is called and then passed to the threads as a batch. Each thread has own
+     * dtNavMeshQuery, so the threads only take navmesh lock for the duration of a single search and never contend
+     * with a caller thread for the query object shared by the navmesh. Without threads queries are processed by
+     * dispatch on the calling thread.
+     */
+    class AsyncPathFinder
+    {
+    public:
+        explicit AsyncPathFinder(const Settings& settings);
+
+        ~AsyncPathFinder();
+
+        SharedPathQuery request(const PathRequest& request, const SharedNavMeshCacheItem& navMesh);
+
+        void dispatch();
+
+        void stop();
+
+        AsyncPathFinderStats getStats() const;
+
+    private:
+        std::reference_wrapper<const Settings> mSettings;
+        std::vector<std::shared_ptr<PathQuery>> mRequested;
+        mutable std::mutex mMutex;
+        std::condition_variable mHasQuery;
+        std::deque<std::shared_ptr<PathQuery>> mQueue;
+        std::size_t mProcessing = 0;
+        std::size_t mDone = 0;
+        std::size_t mCancelled = 0;
+        std::chrono::steady_clock::duration mTotalLatency{};
+        std::chrono::steady_clock::duration mMaxLatency{};
+        AsyncPathFinderStats mLastStats;
+        bool mShouldStop = false;
+        std::vector<std::thread> mThreads;
+
+        void process() noexcept;
+
+        PathResult findPath(dtNavMeshQuery& navMeshQuery, const PathQuery& query) const;
+    };
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include "heightfieldshape.hpp"
 #include "objectid.hpp"
 #include "objecttransform.hpp"
+#include "pathquery.hpp"
 #include "recastmeshtiles.hpp"
 #include "sharednavmeshcacheitem.hpp"
 #include "updateguard.hpp"
@@ -178,6 +179,18 @@ namespace DetourNavigator
          */
         virtual void wait(WaitConditionType waitConditionType, Loading::Listener* listener) = 0;
 
+        /**
+         * @brief requestPath creates a path search to be done by a background thread. Queries requested before
+         * dispatchPathQueries call are processed as a batch.
+         * @return query which has a result when PathQuery::isDone returns true.
+         */
+        virtual SharedPathQuery requestPath(const PathRequest& request) = 0;
+
+        /**
+         * @brief dispatchPathQueries passes queries requested since the last call to background threads.
+         */
+        virtual void dispatchPathQueries() = 0;
+
         /**
          * @brief getNavMesh returns navmesh for specific agent half extents
          * @return navmesh
@@ -12,6 +12,7 @@ namespace DetourNavigator
     NavigatorImpl::NavigatorImpl(const Settings& settings, std::unique_ptr<NavMeshDb>&& db)
         : mSettings(settings)
         , mNavMeshManager(mSettings, std::move(db))
+        , mPathFinder(mSettings)
     {
     }
 
@@ -155,6 +156,16 @@ namespace DetourNavigator
         mNavMeshManager.wait(waitConditionType, listener);
     }
 
+    SharedPathQuery NavigatorImpl::requestPath(const PathRequest& request)
+    {
+        return mPathFinder.request(request, mNavMeshManager.getNavMesh(request.mAgentBounds));
+    }
+
+    void NavigatorImpl::dispatchPathQueries()
+    {
+        mPathFinder.dispatch();
+    }
+
     SharedNavMeshCacheItem NavigatorImpl::getNavMesh(const AgentBounds& agentBounds) const
     {
         return mNavMeshManager.getNavMesh(agentBounds);
@@ -172,7 +183,9 @@ namespace DetourNavigator
 
     Stats NavigatorImpl::getStats() const
     {
-        return mNavMeshManager.getStats();
+        Stats result = mNavMeshManager.getStats();
+        result.mPathFinder = mPathFinder.getStats();
+        return result;
     }
 
     RecastMeshTiles NavigatorImpl::getRecastMeshTiles() const
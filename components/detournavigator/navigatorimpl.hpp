@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVIGATORIMPL_H
 #define OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVIGATORIMPL_H
 
+#include "asyncpathfinder.hpp"
 #include "navigator.hpp"
 #include "navmeshmanager.hpp"
 #include "updateguard.hpp"
@@ -61,6 +62,10 @@ namespace DetourNavigator
 
         void wait(WaitConditionType waitConditionType, Loading::Listener* listener) override;
 
+        SharedPathQuery requestPath(const PathRequest& request) override;
+
+        void dispatchPathQueries() override;
+
         SharedNavMeshCacheItem getNavMesh(const AgentBounds& agentBounds) const override;
 
         std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const override;
@@ -76,6 +81,7 @@ namespace DetourNavigator
     private:
         Settings mSettings;
         NavMeshManager mNavMeshManager;
+        AsyncPathFinder mPathFinder;
         std::optional<TilePosition> mLastPlayerPosition;
         std::map<AgentBounds, std::size_t> mAgents;
         std::unordered_map<ObjectId, ObjectId> mAvoidIds;
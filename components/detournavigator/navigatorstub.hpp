@@ -73,6 +73,13 @@ namespace DetourNavigator
 
         void wait(WaitConditionType /*waitConditionType*/, Loading::Listener* /*listener*/) override {}
 
+        SharedPathQuery requestPath(const PathRequest& request) override
+        {
+            return std::make_shared<PathQuery>(request, mEmptyNavMeshCacheItem);
+        }
+
+        void dispatchPathQueries() override {}
+
         SharedNavMeshCacheItem getNavMesh(const AgentBounds& /*agentBounds*/) const override
         {
             return mEmptyNavMeshCacheItem;
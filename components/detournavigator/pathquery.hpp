@@ -0,0 +1,82 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHQUERY_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHQUERY_H
+
+#include "agentbounds.hpp"
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "sharednavmeshcacheitem.hpp"
+#include "status.hpp"
+
+#include <osg/Vec3f>
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace DetourNavigator
+{
+    struct PathRequest
+    {
+        AgentBounds mAgentBounds;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mIncludeFlags = Flag_none;
+        AreaCosts mAreaCosts;
+        float mEndTolerance = 0;
+    };
+
+    struct PathResult
+    {
+        Status mStatus = Status::NavMeshNotFound;
+        std::vector<osg::Vec3f> mPath;
+    };
+
+    /**
+     * @brief PathQuery is a path search requested with Navigator::requestPath. Result becomes available after
+     * the query is processed by a background thread. Dropping all references to a not yet processed query cancels it.
+     * Query without navmesh is done on construction with Status::NavMeshNotFound.
+     */
+    class PathQuery
+    {
+    public:
+        explicit PathQuery(const PathRequest& request, const SharedNavMeshCacheItem& navMesh)
+            : mRequest(request)
+            , mNavMesh(navMesh)
+            , mRequestTime(std::chrono::steady_clock::now())
+        {
+            if (mNavMesh == nullptr)
+                setResult(PathResult{ .mStatus = Status::NavMeshNotFound, .mPath = {} });
+        }
+
+        const PathRequest& getRequest() const { return mRequest; }
+
+        bool isDone() const { return mDone.load(std::memory_order_acquire); }
+
+        const PathResult& getResult() const
+        {
+            assert(isDone());
+            return mResult;
+        }
+
+    private:
+        const PathRequest mRequest;
+        const SharedNavMeshCacheItem mNavMesh;
+        const std::chrono::steady_clock::time_point mRequestTime;
+        PathResult mResult;
+        std::atomic_bool mDone{ false };
+
+        void setResult(PathResult&& result)
+        {
+            mResult = std::move(result);
+            mDone.store(true, std::memory_order_release);
+        }
+
+        friend class AsyncPathFinder;
+    };
+
+    using SharedPathQuery = std::shared_ptr<const PathQuery>;
+}
+
+#endif
@@ -40,11 +40,22 @@ namespace DetourNavigator
             out.setAttribute(frameNumber, "NavMesh Recast Heightfields", static_cast<double>(stats.mHeightfields));
             out.setAttribute(frameNumber, "NavMesh Recast Water", static_cast<double>(stats.mWater));
         }
+
+        void reportStats(const AsyncPathFinderStats& stats, unsigned int frameNumber, osg::Stats& out)
+        {
+            out.setAttribute(frameNumber, "NavMesh PathFinder Queued", static_cast<double>(stats.mQueued));
+            out.setAttribute(frameNumber, "NavMesh PathFinder Processing", static_cast<double>(stats.mProcessing));
+            out.setAttribute(frameNumber, "NavMesh PathFinder Done", static_cast<double>(stats.mDone));
+            out.setAttribute(frameNumber, "NavMesh PathFinder Cancelled", static_cast<double>(stats.mCancelled));
+            out.setAttribute(frameNumber, "NavMesh PathFinder Latency", stats.mAverageLatency * 1000);
+            out.setAttribute(frameNumber, "NavMesh PathFinder MaxLatency", stats.mMaxLatency * 1000);
+        }
     }
 
     void reportStats(const Stats& stats, unsigned int frameNumber, osg::Stats& out)
     {
         reportStats(stats.mUpdater, frameNumber, out);
         reportStats(stats.mRecast, frameNumber, out);
+        reportStats(stats.mPathFinder, frameNumber, out);
     }
 }
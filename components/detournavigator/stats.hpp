@@ -58,10 +58,22 @@ namespace DetourNavigator
         std::size_t mWater = 0;
     };
 
+    struct AsyncPathFinderStats
+    {
+        std::size_t mQueued = 0;
+        std::size_t mProcessing = 0;
+        // Values below are for the queries finished between the last two dispatches
+        std::size_t mDone = 0;
+        std::size_t mCancelled = 0;
+        double mAverageLatency = 0;
+        double mMaxLatency = 0;
+    };
+
     struct Stats
     {
         AsyncNavMeshUpdaterStats mUpdater;
         TileCachedRecastMeshManagerStats mRecast;
+        AsyncPathFinderStats mPathFinder;
     };
 
     void reportStats(const Stats& stats, unsigned int frameNumber, osg::Stats& out);
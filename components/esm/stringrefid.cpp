@@ -1,15 +1,19 @@
 #include "stringrefid.hpp"
 #include "serializerefid.hpp"
 
+#include <array>
+#include <atomic>
 #include <charconv>
+#include <deque>
 #include <iomanip>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <sstream>
 #include <system_error>
-#include <unordered_set>
+#include <vector>
 
-#include "components/misc/guarded.hpp"
 #include "components/misc/strings/algorithm.hpp"
 #include "components/misc/utf8stream.hpp"
 
@@ -17,23 +21,139 @@ namespace ESM
 {
     namespace
     {
-        using StringsSet = std::unordered_set<std::string, Misc::StringUtils::CiHash, Misc::StringUtils::CiEqual>;
+        constexpr std::size_t shardBits = 4;
+        constexpr std::size_t initialIndexSize = 64;
 
         const std::string emptyString;
 
-        Misc::ScopeGuarded<StringsSet>& getRefIds()
+        struct Entry
         {
-            static Misc::ScopeGuarded<StringsSet> refIds;
+            std::string mValue;
+            std::size_t mHash;
+        };
+
+        // Open addressing hash table with linear probing. Slots are only changed from null to non-null value, so
+        // readers don't need a lock.
+        struct Index
+        {
+            std::size_t mMask;
+            std::unique_ptr<std::atomic<const Entry*>[]> mSlots;
+
+            explicit Index(std::size_t size)
+                : mMask(size - 1)
+                , mSlots(std::make_unique<std::atomic<const Entry*>[]>(size))
+            {
+            }
+
+            const Entry* find(std::string_view value, std::size_t hash) const
+            {
+                for (std::size_t i = hash & mMask;; i = (i + 1) & mMask)
+                {
+                    const Entry* const entry = mSlots[i].load(std::memory_order_acquire);
+                    if (entry == nullptr)
+                        return nullptr;
+                    if (entry->mHash == hash && Misc::StringUtils::ciEqual(entry->mValue, value))
+                        return entry;
+                }
+            }
+
+            void insert(const Entry& entry)
+            {
+                std::size_t i = entry.mHash & mMask;
+                while (mSlots[i].load(std::memory_order_relaxed) != nullptr)
+                    i = (i + 1) & mMask;
+                mSlots[i].store(&entry, std::memory_order_release);
+            }
+        };
+
+        // Insertions are serialized by the mutex. Lookups are lock-free: when the index is full a new bigger one is
+        // published and the old one is kept alive because it still may be read by other threads. A lookup missing an
+        // entry that is being inserted concurrently falls back to the locked path.
+        class Shard
+        {
+        public:
+            Shard()
+            {
+                mIndex.store(mIndices.emplace_back(std::make_unique<Index>(initialIndexSize)).get(),
+                    std::memory_order_relaxed);
+            }
+
+            const Entry* find(std::string_view value, std::size_t hash) const
+            {
+                return mIndex.load(std::memory_order_acquire)->find(value, hash);
+            }
+
+            const Entry& findOrInsert(std::string_view value, std::size_t hash)
+            {
+                if (const Entry* const entry = find(value, hash))
+                    return *entry;
+                const std::lock_guard lock(mMutex);
+                Index* index = mIndex.load(std::memory_order_relaxed);
+                if (const Entry* const entry = index->find(value, hash))
+                    return *entry;
+                const Entry& entry = mEntries.emplace_back(Entry{ std::string(value), hash });
+                // Keep load factor under 0.5 to have short probe sequences
+                if (mEntries.size() * 2 > index->mMask + 1)
+                {
+                    auto bigger = std::make_unique<Index>((index->mMask + 1) * 2);
+                    for (const Entry& v : mEntries)
+                        bigger->insert(v);
+                    index = mIndices.emplace_back(std::move(bigger)).get();
+                    mIndex.store(index, std::memory_order_release);
+                }
+                else
+                    index->insert(entry);
+                return entry;
+            }
+
+        private:
+            std::mutex mMutex;
+            std::deque<Entry> mEntries;
+            std::vector<std::unique_ptr<Index>> mIndices;
+            std::atomic<Index*> mIndex;
+        };
+
+        // Strings are distributed over shards to reduce contention between concurrent insertions. The case-insensitive
+        // hash is computed once per operation and stored next to the string to avoid string comparisons for mismatching
+        // entries.
+        class StringsTable
+        {
+        public:
+            const Entry* find(std::string_view value) const
+            {
+                const std::size_t hash = Misc::StringUtils::CiHash{}(value);
+                return getShard(hash).find(value, hash);
+            }
+
+            const Entry& findOrInsert(std::string_view value)
+            {
+                const std::size_t hash = Misc::StringUtils::CiHash{}(value);
+                return getShard(hash).findOrInsert(value, hash);
+            }
+
+        private:
+            std::array<Shard, std::size_t{ 1 } << shardBits> mShards;
+
+            // Index slots are selected by the lower bits of the hash
+            static std::size_t getShardIndex(std::size_t hash)
+            {
+                return hash >> (std::numeric_limits<std::size_t>::digits - shardBits);
+            }
+
+            Shard& getShard(std::size_t hash) { return mShards[getShardIndex(hash)]; }
+
+            const Shard& getShard(std::size_t hash) const { return mShards[getShardIndex(hash)]; }
+        };
+
+        StringsTable& getRefIds()
+        {
+            static StringsTable refIds;
             return refIds;
         }
 
         Misc::NotNullPtr<const std::string> getOrInsertString(std::string_view id)
         {
-            const auto locked = getRefIds().lock();
-            auto it = locked->find(id);
-            if (it == locked->end())
-                it = locked->emplace(id).first;
-            return &*it;
+            return &getRefIds().findOrInsert(id).mValue;
         }
 
         void addHex(unsigned char value, std::string& result)
@@ -137,12 +257,11 @@ namespace ESM
 
     std::optional<StringRefId> StringRefId::deserializeExisting(std::string_view value)
     {
-        const auto locked = getRefIds().lock();
-        auto it = locked->find(value);
-        if (it == locked->end())
+        const Entry* const entry = getRefIds().find(value);
+        if (entry == nullptr)
             return {};
         StringRefId id;
-        id.mValue = &*it;
+        id.mValue = &entry->mValue;
         return id;
     }
 }
@@ -112,6 +112,11 @@ namespace ESM
         DialInfo info;
         bool isDeleted = false;
         info.load(esm, isDeleted);
+        insertInfo(std::move(info), isDeleted);
+    }
+
+    void Dialogue::insertInfo(DialInfo&& info, bool isDeleted)
+    {
         mInfoOrder.insertInfo(std::move(info), isDeleted);
     }
 
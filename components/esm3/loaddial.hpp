@@ -64,6 +64,9 @@ namespace ESM
         /// Read the next info record
         void readInfo(ESMReader& esm);
 
+        /// Add an info record read separately
+        void insertInfo(DialInfo&& info, bool isDeleted);
+
         void blank();
         ///< Set record to default state (does not touch the ID and does not change the type).
     };
@@ -6,6 +6,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -127,6 +128,50 @@ namespace ESMTerrain
         }
     }
 
+    struct CellRowSamples
+    {
+        std::size_t mCellX;
+        std::size_t mCellY;
+        std::size_t mBeginX;
+        std::size_t mY;
+        std::size_t mCount;
+        std::size_t mVertexX;
+        std::size_t mVertexY;
+    };
+
+    /// Same as sampleCellGrid but merges samples of the same cell with the same Y into a single call to process them
+    /// at once. Sample i of the row has local X equal to mBeginX + i * sampleSize and vertex X equal to mVertexX + i.
+    template <class F>
+    void sampleCellGridRows(std::size_t cellSize, std::size_t sampleSize, std::size_t beginX, std::size_t beginY,
+        std::size_t distance, F&& f)
+    {
+        std::optional<CellRowSamples> current;
+        sampleCellGrid(cellSize, sampleSize, beginX, beginY, distance,
+            [&](std::size_t cellX, std::size_t cellY, std::size_t x, std::size_t y, std::size_t vertX,
+                std::size_t vertY) {
+                if (current.has_value() && current->mCellX == cellX && current->mCellY == cellY && current->mY == y
+                    && current->mVertexY == vertY && current->mVertexX + current->mCount == vertX
+                    && current->mBeginX + current->mCount * sampleSize == x)
+                {
+                    ++current->mCount;
+                    return;
+                }
+                if (current.has_value())
+                    f(*current);
+                current = CellRowSamples{
+                    .mCellX = cellX,
+                    .mCellY = cellY,
+                    .mBeginX = x,
+                    .mY = y,
+                    .mCount = 1,
+                    .mVertexX = vertX,
+                    .mVertexY = vertY,
+                };
+            });
+        if (current.has_value())
+            f(*current);
+    }
+
     inline int getBlendmapSize(float size, int textureSize)
     {
         return static_cast<int>(textureSize * size) + 1;
@@ -1,8 +1,16 @@
 #include "storage.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <optional>
+#include <set>
+#include <span>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <osg/Image>
 #include <osg/Plane>
@@ -16,6 +24,8 @@
 #include <components/misc/strings/algorithm.hpp>
 #include <components/vfs/manager.hpp>
 
+#include <extern/smhasher/MurmurHash3.h>
+
 #include "gridsampling.hpp"
 
 namespace ESMTerrain
@@ -40,6 +50,72 @@ namespace ESMTerrain
 
             return { tex, land->getPlugin() };
         }
+
+        // Samples of the terrain chunk for the cell grid sampling functions
+        struct ChunkGrid
+        {
+            std::size_t mSampleSize;
+            std::size_t mCellSize;
+            int mStartCellX;
+            int mStartCellY;
+            std::size_t mBeginX;
+            std::size_t mBeginY;
+            std::size_t mDistance;
+        };
+
+        ChunkGrid makeChunkGrid(int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace)
+        {
+            if (lodLevel < 0 || 63 < lodLevel)
+                throw std::invalid_argument("Invalid terrain lod level: " + std::to_string(lodLevel));
+
+            if (size <= 0)
+                throw std::invalid_argument("Invalid terrain size: " + std::to_string(size));
+
+            const std::size_t cellSize = static_cast<std::size_t>(ESM::getLandSize(worldspace));
+            const osg::Vec2f origin = center - osg::Vec2f(size, size) * 0.5f;
+            const int startCellX = static_cast<int>(std::floor(origin.x()));
+            const int startCellY = static_cast<int>(std::floor(origin.y()));
+
+            return ChunkGrid{
+                // LOD level n means every 2^n-th vertex is kept
+                .mSampleSize = std::size_t{ 1 } << lodLevel,
+                .mCellSize = cellSize,
+                .mStartCellX = startCellX,
+                .mStartCellY = startCellY,
+                .mBeginX = static_cast<std::size_t>((origin.x() - startCellX) * cellSize),
+                .mBeginY = static_cast<std::size_t>((origin.y() - startCellY) * cellSize),
+                .mDistance = static_cast<std::size_t>(size * (cellSize - 1)) + 1,
+            };
+        }
+
+        class Hash
+        {
+        public:
+            void update(const void* data, std::size_t size)
+            {
+                std::array<std::uint64_t, 2> result;
+                MurmurHash3_x64_128(data, static_cast<int>(size), mValue.data(), result.data());
+                mValue = result;
+            }
+
+            template <class T>
+            void update(std::span<const T> values)
+            {
+                update(values.data(), values.size_bytes());
+            }
+
+            void update(std::string_view value)
+            {
+                const std::uint64_t size = value.size();
+                update(&size, sizeof(size));
+                update(value.data(), value.size());
+            }
+
+            const std::array<std::uint64_t, 2>& getValue() const { return mValue; }
+
+        private:
+            std::array<std::uint64_t, 2> mValue{ 0, 0 };
+        };
     }
 
     class LandCache
@@ -241,15 +317,9 @@ namespace ESMTerrain
     void Storage::fillVertexBuffers(int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace,
         osg::Vec3Array& positions, osg::Vec3Array& normals, osg::Vec4ubArray& colours)
     {
-        if (lodLevel < 0 || 63 < lodLevel)
-            throw std::invalid_argument("Invalid terrain lod level: " + std::to_string(lodLevel));
-
-        if (size <= 0)
-            throw std::invalid_argument("Invalid terrain size: " + std::to_string(size));
-
-        // LOD level n means every 2^n-th vertex is kept
-        const std::size_t sampleSize = std::size_t{ 1 } << lodLevel;
-        const std::size_t cellSize = static_cast<std::size_t>(ESM::getLandSize(worldspace));
+        const ChunkGrid grid = makeChunkGrid(lodLevel, size, center, worldspace);
+        const std::size_t sampleSize = grid.mSampleSize;
+        const std::size_t cellSize = grid.mCellSize;
         const std::size_t numVerts = static_cast<std::size_t>(size * (cellSize - 1) / sampleSize) + 1;
 
         positions.resize(numVerts * numVerts);
@@ -258,109 +328,130 @@ namespace ESMTerrain
 
         const bool alteration = useAlteration();
         const int landSizeInUnits = ESM::getCellSize(worldspace);
-        const osg::Vec2f origin = center - osg::Vec2f(size, size) * 0.5f;
-        const int startCellX = static_cast<int>(std::floor(origin.x()));
-        const int startCellY = static_cast<int>(std::floor(origin.y()));
+        const int startCellX = grid.mStartCellX;
+        const int startCellY = grid.mStartCellY;
         LandCache cache(startCellX - 1, startCellY - 1, static_cast<std::size_t>(std::ceil(size)) + 2);
-        std::pair lastCell{ startCellX, startCellY };
-        const LandObject* land = getLand(ESM::ExteriorCellLocation(startCellX, startCellY, worldspace), cache);
-        const ESM::LandData* heightData = nullptr;
-        const ESM::LandData* normalData = nullptr;
-        const ESM::LandData* colourData = nullptr;
         bool validHeightDataExists = false;
 
-        if (land != nullptr)
-        {
-            heightData = land->getData(ESM::Land::DATA_VHGT);
-            normalData = land->getData(ESM::Land::DATA_VNML);
-            colourData = land->getData(ESM::Land::DATA_VCLR);
-            validHeightDataExists = true;
-        }
-
-        const auto handleSample = [&](std::size_t cellShiftX, std::size_t cellShiftY, std::size_t row, std::size_t col,
-                                      std::size_t vertX, std::size_t vertY) {
-            const int cellX = startCellX + cellShiftX;
-            const int cellY = startCellY + cellShiftY;
-            const std::pair cell{ cellX, cellY };
-            const ESM::ExteriorCellLocation cellLocation(cellX, cellY, worldspace);
-
-            if (lastCell != cell)
+        // Values for a single column of samples within a cell. Stored as separate arrays to allow the compiler to
+        // vectorize loops over them.
+        std::vector<float> heights(cellSize);
+        std::vector<float> normalsX(cellSize);
+        std::vector<float> normalsY(cellSize);
+        std::vector<float> normalsZ(cellSize);
+
+        // Output vertices with the same X are stored sequentially so samples are grouped by X to write them in order.
+        // Swapped coordinates are passed to sampleCellGridRows for this.
+        const auto handleColumn = [&](const CellRowSamples& samples) {
+            const ESM::ExteriorCellLocation cellLocation(startCellX + static_cast<int>(samples.mCellY),
+                startCellY + static_cast<int>(samples.mCellX), worldspace);
+            const LandObject* const land = getLand(cellLocation, cache);
+
+            const ESM::LandData* heightData = nullptr;
+            const ESM::LandData* normalData = nullptr;
+            const ESM::LandData* colourData = nullptr;
+
+            if (land != nullptr)
             {
-                land = getLand(cellLocation, cache);
+                heightData = land->getData(ESM::Land::DATA_VHGT);
+                normalData = land->getData(ESM::Land::DATA_VNML);
+                colourData = land->getData(ESM::Land::DATA_VCLR);
+                validHeightDataExists = true;
+            }
 
-                heightData = nullptr;
-                normalData = nullptr;
-                colourData = nullptr;
+            const std::size_t count = samples.mCount;
+            const std::size_t x = samples.mY;
+            const std::size_t firstY = samples.mBeginX;
+            const std::size_t srcBegin = firstY * cellSize + x;
+            const std::size_t srcStride = sampleSize * cellSize;
+            const std::size_t vertX = samples.mVertexY;
+            const std::size_t dstBegin = vertX * numVerts + samples.mVertexX;
 
-                if (land != nullptr)
-                {
-                    heightData = land->getData(ESM::Land::DATA_VHGT);
-                    normalData = land->getData(ESM::Land::DATA_VNML);
-                    colourData = land->getData(ESM::Land::DATA_VCLR);
-                    validHeightDataExists = true;
-                }
+            assert(count <= cellSize);
 
-                lastCell = cell;
+            if (heightData != nullptr)
+            {
+                const float* const src = heightData->getHeights().data() + srcBegin;
+                for (std::size_t i = 0; i < count; ++i)
+                    heights[i] = src[i * srcStride];
             }
+            else
+                std::fill_n(heights.begin(), count, defaultHeight);
 
-            float height = defaultHeight;
-            if (heightData != nullptr)
-                height = heightData->getHeights()[col * cellSize + row];
             if (alteration)
-                height += getAlteredHeight(col, row);
+                for (std::size_t i = 0; i < count; ++i)
+                    heights[i] += getAlteredHeight(firstY + i * sampleSize, x);
 
-            const std::size_t vertIndex = vertX * numVerts + vertY;
-
-            positions[vertIndex]
-                = osg::Vec3f((vertX / static_cast<float>(numVerts - 1) - 0.5f) * size * landSizeInUnits,
-                    (vertY / static_cast<float>(numVerts - 1) - 0.5f) * size * landSizeInUnits, height);
-
-            const std::size_t srcArrayIndex = col * cellSize * 3 + row * 3;
-
-            osg::Vec3f normal(0, 0, 1);
+            const float positionX = (vertX / static_cast<float>(numVerts - 1) - 0.5f) * size * landSizeInUnits;
+            for (std::size_t i = 0; i < count; ++i)
+                positions[dstBegin + i] = osg::Vec3f(positionX,
+                    ((samples.mVertexX + i) / static_cast<float>(numVerts - 1) - 0.5f) * size * landSizeInUnits,
+                    heights[i]);
 
             if (normalData != nullptr)
             {
-                for (std::size_t i = 0; i < 3; ++i)
-                    normal[i] = normalData->getNormals()[srcArrayIndex + i];
-
-                normal.normalize();
+                const std::int8_t* const src = normalData->getNormals().data() + srcBegin * 3;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    normalsX[i] = src[i * srcStride * 3];
+                    normalsY[i] = src[i * srcStride * 3 + 1];
+                    normalsZ[i] = src[i * srcStride * 3 + 2];
+                }
+                // Same as osg::Vec3f::normalize
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const float length
+                        = std::sqrt(normalsX[i] * normalsX[i] + normalsY[i] * normalsY[i] + normalsZ[i] * normalsZ[i]);
+                    const float scale = length > 0 ? 1.0f / length : 1.0f;
+                    normalsX[i] *= scale;
+                    normalsY[i] *= scale;
+                    normalsZ[i] *= scale;
+                }
+                for (std::size_t i = 0; i < count; ++i)
+                    normals[dstBegin + i] = osg::Vec3f(normalsX[i], normalsY[i], normalsZ[i]);
             }
-
-            // Normals apparently don't connect seamlessly between cells
-            if (col == cellSize - 1 || row == cellSize - 1)
-                fixNormal(normal, cellLocation, col, row, cache);
-
-            // some corner normals appear to be complete garbage (z < 0)
-            if ((row == 0 || row == cellSize - 1) && (col == 0 || col == cellSize - 1))
-                averageNormal(normal, cellLocation, col, row, cache);
-
-            assert(normal.z() > 0);
-
-            normals[vertIndex] = normal;
-
-            osg::Vec4ub color(255, 255, 255, 255);
+            else
+                std::fill_n(normals.begin() + dstBegin, count, osg::Vec3f(0, 0, 1));
 
             if (colourData != nullptr)
-                for (std::size_t i = 0; i < 3; ++i)
-                    color[i] = colourData->getColors()[srcArrayIndex + i];
+            {
+                const std::uint8_t* const src = colourData->getColors().data() + srcBegin * 3;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::uint8_t* const colour = src + i * srcStride * 3;
+                    colours[dstBegin + i] = osg::Vec4ub(colour[0], colour[1], colour[2], 255);
+                }
+            }
+            else
+                std::fill_n(colours.begin() + dstBegin, count, osg::Vec4ub(255, 255, 255, 255));
 
             // Does nothing by default, override in OpenMW-CS
             if (alteration)
-                adjustColor(col, row, heightData, color);
+                for (std::size_t i = 0; i < count; ++i)
+                    adjustColor(firstY + i * sampleSize, x, heightData, colours[dstBegin + i]);
 
-            // Unlike normals, colors mostly connect seamlessly between cells, but not always...
-            if (col == cellSize - 1 || row == cellSize - 1)
-                fixColour(color, cellLocation, col, row, cache);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t y = firstY + i * sampleSize;
+                const bool isBorder = y == cellSize - 1 || x == cellSize - 1;
 
-            colours[vertIndex] = color;
-        };
+                // Normals apparently don't connect seamlessly between cells
+                if (isBorder)
+                    fixNormal(normals[dstBegin + i], cellLocation, y, x, cache);
+
+                // some corner normals appear to be complete garbage (z < 0)
+                if ((x == 0 || x == cellSize - 1) && (y == 0 || y == cellSize - 1))
+                    averageNormal(normals[dstBegin + i], cellLocation, y, x, cache);
 
-        const std::size_t beginX = static_cast<std::size_t>((origin.x() - startCellX) * cellSize);
-        const std::size_t beginY = static_cast<std::size_t>((origin.y() - startCellY) * cellSize);
-        const std::size_t distance = static_cast<std::size_t>(size * (cellSize - 1)) + 1;
+                assert(normals[dstBegin + i].z() > 0);
+
+                // Unlike normals, colors mostly connect seamlessly between cells, but not always...
+                if (isBorder)
+                    fixColour(colours[dstBegin + i], cellLocation, y, x, cache);
+            }
+        };
 
-        sampleCellGrid(cellSize, sampleSize, beginX, beginY, distance, handleSample);
+        sampleCellGridRows(cellSize, sampleSize, grid.mBeginY, grid.mBeginX, grid.mDistance, handleColumn);
 
         if (!validHeightDataExists && ESM::isEsm4Ext(worldspace))
             std::fill(positions.begin(), positions.end(), osg::Vec3f());
@@ -465,6 +556,67 @@ namespace ESMTerrain
             blendmaps.clear(); // If a single texture fills the whole terrain, there is no need to blend
     }
 
+    std::optional<std::array<std::uint64_t, 2>> Storage::getChunkHash(
+        int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace)
+    {
+        // Altered terrain may change without changing the land
+        if (useAlteration())
+            return std::nullopt;
+
+        const ChunkGrid grid = makeChunkGrid(lodLevel, size, center, worldspace);
+
+        // Far chunks skip cells between samples so the data of such cells doesn't affect the chunk. Border vertices
+        // are fixed using the neighbour cells.
+        std::set<std::pair<int, int>> cells;
+        sampleCellGridRows(grid.mCellSize, grid.mSampleSize, grid.mBeginX, grid.mBeginY, grid.mDistance,
+            [&](const CellRowSamples& samples) {
+                const int cellX = grid.mStartCellX + static_cast<int>(samples.mCellX);
+                const int cellY = grid.mStartCellY + static_cast<int>(samples.mCellY);
+                for (int x = cellX - 1; x <= cellX + 1; ++x)
+                    for (int y = cellY - 1; y <= cellY + 1; ++y)
+                        cells.emplace(x, y);
+            });
+
+        Hash hash;
+        for (const auto& [x, y] : cells)
+        {
+            const osg::ref_ptr<const LandObject> land = getLand(ESM::ExteriorCellLocation(x, y, worldspace));
+            const std::array<std::uint64_t, 2> landHash = land == nullptr
+                ? std::array<std::uint64_t, 2>{ 0, 0 }
+                : land->getHash([&](const ESM::LandData& data) { return getLandHash(data); });
+            const std::int32_t cell[] = { x, y };
+            hash.update(cell, sizeof(cell));
+            hash.update(landHash.data(), sizeof(landHash));
+        }
+        return hash.getValue();
+    }
+
+    std::array<std::uint64_t, 2> Storage::getLandHash(const ESM::LandData& data)
+    {
+        Hash hash;
+        const std::int32_t properties[] = { data.getLandSize(), data.getLoadFlags(), data.getPlugin() };
+        hash.update(properties, sizeof(properties));
+        hash.update(data.getHeights());
+        hash.update(data.getNormals());
+        hash.update(data.getColors());
+        hash.update(data.getTextures());
+
+        // Texture names depend on the content files and layers depend on the VFS and settings
+        const std::set<std::uint16_t> textures(data.getTextures().begin(), data.getTextures().end());
+        for (const std::uint16_t texture : textures)
+        {
+            const UniqueTextureId id
+                = texture == 0 ? UniqueTextureId(0, 0) : UniqueTextureId(texture, data.getPlugin());
+            const Terrain::LayerInfo info = getLayerInfo(getTextureName(id));
+            hash.update(info.mDiffuseMap);
+            hash.update(info.mNormalMap);
+            const bool flags[] = { info.mParallax, info.mSpecular };
+            hash.update(flags, sizeof(flags));
+        }
+
+        return hash.getValue();
+    }
+
     float Storage::getHeightAt(const osg::Vec3f& worldPos, ESM::RefId worldspace)
     {
         const float cellSize = ESM::getCellSize(worldspace);
@@ -1,8 +1,11 @@
 #ifndef OPENMW_COMPONENTS_ESMTERRAIN_STORAGE_H
 #define OPENMW_COMPONENTS_ESMTERRAIN_STORAGE_H
 
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <mutex>
+#include <optional>
 
 #include <components/terrain/storage.hpp>
 
@@ -51,8 +54,21 @@ namespace ESMTerrain
 
         int getPlugin() const { return mData.getPlugin(); }
 
+        /// Returns hash of the land data computed by compute on the first call. Shared by all terrain chunks using
+        /// this land.
+        template <class F>
+        std::array<std::uint64_t, 2> getHash(F&& compute) const
+        {
+            const std::lock_guard lock(mHashMutex);
+            if (!mHash.has_value())
+                mHash = compute(mData);
+            return *mHash;
+        }
+
     private:
         ESM::LandData mData;
+        mutable std::mutex mHashMutex;
+        mutable std::optional<std::array<std::uint64_t, 2>> mHash;
 
         LandObject(const LandObject& copy, const osg::CopyOp& copyOp);
     };
@@ -112,6 +128,11 @@ namespace ESMTerrain
         void getBlendmaps(float chunkSize, const osg::Vec2f& chunkCenter, ImageVector& blendmaps,
             std::vector<Terrain::LayerInfo>& layerList, ESM::RefId worldspace) override;
 
+        /// Hash of all land data and texture layers of the cells with samples of the chunk and their neighbours.
+        /// Returns std::nullopt when the terrain is altered (OpenMW-CS).
+        std::optional<std::array<std::uint64_t, 2>> getChunkHash(
+            int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace) override;
+
         float getHeightAt(const osg::Vec3f& worldPos, ESM::RefId worldspace) override;
 
         /// Get the transformation factor for mapping cell units to world units.
@@ -148,6 +169,8 @@ namespace ESMTerrain
 
         std::string getTextureName(UniqueTextureId id);
 
+        std::array<std::uint64_t, 2> getLandHash(const ESM::LandData& data);
+
         std::map<std::string, Terrain::LayerInfo> mLayerInfoMap;
         std::mutex mLayerInfoMutex;
 
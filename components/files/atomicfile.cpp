@@ -0,0 +1,41 @@
+#include "atomicfile.hpp"
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+namespace Files
+{
+    std::optional<std::string> readFileContent(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream.is_open())
+            return std::nullopt;
+        std::ostringstream buffer;
+        buffer << stream.rdbuf();
+        return std::move(buffer).str();
+    }
+
+    void writeFileAtomically(const std::filesystem::path& path, std::string_view data)
+    {
+        std::filesystem::path tmpPath = path;
+        tmpPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+        try
+        {
+            {
+                std::ofstream stream(tmpPath, std::ios::binary);
+                stream.exceptions(std::ios::failbit | std::ios::badbit);
+                stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+            }
+            std::filesystem::rename(tmpPath, path);
+        }
+        catch (...)
+        {
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            throw;
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef OPENMW_COMPONENTS_FILES_ATOMICFILE_H
+#define OPENMW_COMPONENTS_FILES_ATOMICFILE_H
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Files
+{
+    /// Returns the whole file content or nullopt if the file can't be opened.
+    std::optional<std::string> readFileContent(const std::filesystem::path& path);
+
+    /// Writes data into a temporary file and renames it to path, so readers never see a partially written file.
+    /// Same file may be written by different threads at the same time, the last rename wins.
+    /// Throws on failure, the temporary file is removed.
+    void writeFileAtomically(const std::filesystem::path& path, std::string_view data);
+}
+
+#endif
@@ -9,6 +9,9 @@
 namespace Files
 {
     std::array<std::uint64_t, 2> getHash(std::string_view fileName, std::istream& stream);
+
+    /// Returns the same value as getHash for a stream with the same content
+    std::array<std::uint64_t, 2> getHash(std::string_view data);
 }
 
 #endif
@@ -0,0 +1,57 @@
+#ifndef INTERPRETER_DISPATCHTABLE_H_INCLUDED
+#define INTERPRETER_DISPATCHTABLE_H_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Interpreter
+{
+    /// @brief Opcodes of a single segment stored in flat arrays directly indexed by the code.
+    /// @par Codes are clustered in a few small ranges (built-in instructions start from 0 and extensions from 0x20000
+    /// or 0x2000000), so each range of pageSize codes gets its own array and a lookup checks only a couple of ranges.
+    template <class T>
+    class DispatchTable
+    {
+    public:
+        static constexpr unsigned pageSize = 1024;
+
+        /// Returns false if there already is an opcode with the same code.
+        bool insert(unsigned code, std::unique_ptr<T>&& opcode)
+        {
+            const unsigned base = code - code % pageSize;
+            auto page = std::find_if(mPages.begin(), mPages.end(), [&](const Page& v) { return v.mBase == base; });
+            if (page == mPages.end())
+                page = mPages.insert(page, Page{ .mBase = base, .mOpcodes = std::vector<std::unique_ptr<T>>(pageSize) });
+            std::unique_ptr<T>& slot = page->mOpcodes[code - base];
+            if (slot != nullptr)
+                return false;
+            slot = std::move(opcode);
+            return true;
+        }
+
+        /// Returns nullptr if there is no opcode with the given code.
+        T* find(unsigned code) const
+        {
+            for (const Page& page : mPages)
+            {
+                const unsigned index = code - page.mBase;
+                if (index < pageSize)
+                    return page.mOpcodes[index].get();
+            }
+            return nullptr;
+        }
+
+    private:
+        struct Page
+        {
+            unsigned mBase;
+            std::vector<std::unique_ptr<T>> mOpcodes;
+        };
+
+        std::vector<Page> mPages;
+    };
+}
+
+#endif
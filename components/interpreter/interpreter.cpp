@@ -22,14 +22,12 @@ namespace Interpreter
     }
 
     template <typename T>
-    auto& getDispatcher(const T& segment, unsigned int seg, int opcode)
+    auto& getDispatcher(const DispatchTable<T>& segment, unsigned int seg, int opcode)
     {
-        auto it = segment.find(opcode);
-        if (it == segment.end())
-        {
+        T* const dispatcher = segment.find(opcode);
+        if (dispatcher == nullptr)
             abortUnknownCode(seg, opcode);
-        }
-        return it->second;
+        return *dispatcher;
     }
 
     void Interpreter::execute(Type_Code code)
@@ -43,7 +41,7 @@ namespace Interpreter
                 const int opcode = code >> 24;
                 const unsigned int arg0 = code & 0xffffff;
 
-                return getDispatcher(mSegment0, 0, opcode)->execute(mRuntime, arg0);
+                return getDispatcher(mSegment0, 0, opcode).execute(mRuntime, arg0);
             }
 
             case 2:
@@ -51,7 +49,7 @@ namespace Interpreter
                 const int opcode = (code >> 20) & 0x3ff;
                 const unsigned int arg0 = code & 0xfffff;
 
-                return getDispatcher(mSegment2, 2, opcode)->execute(mRuntime, arg0);
+                return getDispatcher(mSegment2, 2, opcode).execute(mRuntime, arg0);
             }
         }
 
@@ -64,14 +62,14 @@ namespace Interpreter
                 const int opcode = (code >> 8) & 0x3ffff;
                 const unsigned int arg0 = code & 0xff;
 
-                return getDispatcher(mSegment3, 3, opcode)->execute(mRuntime, arg0);
+                return getDispatcher(mSegment3, 3, opcode).execute(mRuntime, arg0);
             }
 
             case 0x32:
             {
                 const int opcode = code & 0x3ffffff;
 
-                return getDispatcher(mSegment5, 5, opcode)->execute(mRuntime);
+                return getDispatcher(mSegment5, 5, opcode).execute(mRuntime);
             }
         }
 
@@ -1,7 +1,6 @@
 #ifndef INTERPRETER_INTERPRETER_H_INCLUDED
 #define INTERPRETER_INTERPRETER_H_INCLUDED
 
-#include <map>
 #include <memory>
 #include <stack>
 #include <stdexcept>
@@ -9,6 +8,7 @@
 
 #include <components/misc/strings/format.hpp>
 
+#include "dispatchtable.hpp"
 #include "opcodes.hpp"
 #include "program.hpp"
 #include "runtime.hpp"
@@ -23,10 +23,10 @@ namespace Interpreter
         std::stack<Runtime> mCallstack;
         bool mRunning = false;
         Runtime mRuntime;
-        std::map<int, std::unique_ptr<Opcode1>> mSegment0;
-        std::map<int, std::unique_ptr<Opcode1>> mSegment2;
-        std::map<int, std::unique_ptr<Opcode1>> mSegment3;
-        std::map<int, std::unique_ptr<Opcode0>> mSegment5;
+        DispatchTable<Opcode1> mSegment0;
+        DispatchTable<Opcode1> mSegment2;
+        DispatchTable<Opcode1> mSegment3;
+        DispatchTable<Opcode0> mSegment5;
 
         void execute(Type_Code code);
 
@@ -37,10 +37,9 @@ namespace Interpreter
         template <typename T, typename... Args>
         void installSegment(auto& segment, std::string_view name, int code, Args&&... args)
         {
-            if (segment.find(code) != segment.end())
+            if (!segment.insert(code, std::make_unique<T>(std::forward<Args>(args)...)))
                 throw std::invalid_argument(Misc::StringUtils::format(
                     "Duplicated interpreter instruction code in segment %s: 0x%x", name, code));
-            segment.emplace(code, std::make_unique<T>(std::forward<Args>(args)...));
         }
 
     public:
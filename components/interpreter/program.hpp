@@ -3,6 +3,8 @@
 
 #include "types.hpp"
 
+#include <components/esm/refid.hpp>
+
 #include <string>
 #include <vector>
 
@@ -14,6 +16,8 @@ namespace Interpreter
         std::vector<Type_Integer> mIntegers;
         std::vector<Type_Float> mFloats;
         std::vector<std::string> mStrings;
+        // String literals known to be ids resolved at compile time, other elements are empty
+        std::vector<ESM::RefId> mRefIds;
     };
 }
 
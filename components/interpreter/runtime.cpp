@@ -31,6 +31,20 @@ namespace Interpreter
         return mProgram->mStrings[static_cast<std::size_t>(index)];
     }
 
+    ESM::RefId Runtime::getRefIdLiteral(int index) const
+    {
+        const std::string_view value = getStringLiteral(index);
+
+        if (static_cast<std::size_t>(index) < mProgram->mRefIds.size())
+        {
+            const ESM::RefId& id = mProgram->mRefIds[static_cast<std::size_t>(index)];
+            if (!id.empty())
+                return id;
+        }
+
+        return ESM::RefId::stringRefId(value);
+    }
+
     void Runtime::configure(const Program& program, Context& context)
     {
         clear();
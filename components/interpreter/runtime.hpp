@@ -4,6 +4,8 @@
 #include <string_view>
 #include <vector>
 
+#include <components/esm/refid.hpp>
+
 #include "types.hpp"
 
 namespace Interpreter
@@ -30,6 +32,9 @@ namespace Interpreter
 
         std::string_view getStringLiteral(int index) const;
 
+        ESM::RefId getRefIdLiteral(int index) const;
+        ///< Return string literal as id, uses the value resolved at compile time when available.
+
         void configure(const Program& program, Context& context);
         ///< \a context and \a code must exist as least until either configure, clear or
         /// the destructor is called.
@@ -1,9 +1,11 @@
 #ifndef COMPONENTS_LOADINGLISTENER_ASYNCLISTENER_H
 #define COMPONENTS_LOADINGLISTENER_ASYNCLISTENER_H
 
+#include <chrono>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "loadinglistener.hpp"
 
@@ -40,6 +42,12 @@ namespace Loading
         { /* not implemented */
         }
 
+        void reportTime(std::string_view item, std::string_view stage, std::chrono::steady_clock::duration time) override
+        {
+            std::lock_guard<std::mutex> guard(mMutex);
+            mTimeReports.push_back(TimeReport{ std::string(item), std::string(stage), time });
+        }
+
         void update()
         {
             std::lock_guard<std::mutex> guard(mMutex);
@@ -49,18 +57,29 @@ namespace Loading
                 mBaseListener.setProgressRange(*mRangeUpdate);
             if (mProgressUpdate)
                 mBaseListener.setProgress(*mProgressUpdate);
+            for (const TimeReport& report : mTimeReports)
+                mBaseListener.reportTime(report.mItem, report.mStage, report.mTime);
+            mTimeReports.clear();
             mLabelUpdate = std::nullopt;
             mRangeUpdate = std::nullopt;
             mProgressUpdate = std::nullopt;
         }
 
     private:
+        struct TimeReport
+        {
+            std::string mItem;
+            std::string mStage;
+            std::chrono::steady_clock::duration mTime;
+        };
+
         Listener& mBaseListener;
         std::mutex mMutex;
         std::optional<std::string> mLabelUpdate;
         bool mImportantLabel = false;
         std::optional<size_t> mRangeUpdate;
         std::optional<size_t> mProgressUpdate;
+        std::vector<TimeReport> mTimeReports;
     };
 }
 
@@ -1,8 +1,10 @@
 #ifndef COMPONENTS_LOADINGLISTENER_H
 #define COMPONENTS_LOADINGLISTENER_H
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace Loading
 {
@@ -32,6 +34,13 @@ namespace Loading
         /// Increase current progress, default by 1.
         virtual void increaseProgress(size_t increase = 1) {}
 
+        /// Report how long a stage of loading took, e.g. parsing of a content file.
+        /// @param item The loaded item, e.g. a content file name
+        /// @param stage The name of the stage
+        virtual void reportTime(std::string_view item, std::string_view stage, std::chrono::steady_clock::duration time)
+        {
+        }
+
         virtual ~Listener() = default;
     };
 
@@ -0,0 +1,141 @@
+#ifndef OPENMW_COMPONENTS_MISC_SPATIALGRID_H
+#define OPENMW_COMPONENTS_MISC_SPATIALGRID_H
+
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Misc
+{
+    /// \class SpatialGrid
+    /// Uniform grid over XY plane to find values located near a position without checking all of them.
+    /// Values are bucketed by the position they are inserted with, so the grid has to be rebuilt when they move.
+    /// Buckets are kept in a single vector sorted by cell to make iteration over a row of cells contiguous.
+    template <class T>
+    class SpatialGrid
+    {
+    public:
+        explicit SpatialGrid(float cellSize)
+            : mCellSize(cellSize)
+        {
+            assert(cellSize > 0);
+        }
+
+        float getCellSize() const { return mCellSize; }
+
+        std::size_t size() const { return mItems.size(); }
+
+        bool empty() const { return mItems.empty(); }
+
+        void clear() { mItems.clear(); }
+
+        void insert(const osg::Vec3f& position, const T& value)
+        {
+            Item item{ getCell(position), value };
+            mItems.insert(std::upper_bound(mItems.begin(), mItems.end(), item, compareItems), std::move(item));
+        }
+
+        /// Removes all items with the given value
+        void erase(const T& value)
+        {
+            std::erase_if(mItems, [&](const Item& item) { return item.mValue == value; });
+        }
+
+        /// Replaces content by values made by getValue from each element of the range and bucketed by getPosition.
+        /// Values from the same cell keep the order of the range.
+        template <class Range, class GetValue, class GetPosition>
+        void rebuild(Range&& range, GetValue&& getValue, GetPosition&& getPosition)
+        {
+            mItems.clear();
+            for (auto&& element : range)
+            {
+                T value = getValue(element);
+                const Cell cell = getCell(getPosition(value));
+                mItems.push_back(Item{ cell, std::move(value) });
+            }
+            std::stable_sort(mItems.begin(), mItems.end(), compareItems);
+        }
+
+        /// Calls function for each value from the cells intersecting the square with given center and half size.
+        /// It's a broad phase, the caller is responsible to check exact distance.
+        template <class Function>
+        void forEachNear(const osg::Vec3f& position, float radius, Function&& function) const
+        {
+            const Cell min = getCell(position - osg::Vec3f(radius, radius, 0));
+            const Cell max = getCell(position + osg::Vec3f(radius, radius, 0));
+
+            // Searching each row is pointless when the area covers more rows than there are items
+            if (static_cast<std::int64_t>(max.mY) - static_cast<std::int64_t>(min.mY)
+                >= static_cast<std::int64_t>(mItems.size()))
+            {
+                for (const Item& item : mItems)
+                    if (item.mCell.mY >= min.mY && item.mCell.mY <= max.mY && item.mCell.mX >= min.mX
+                        && item.mCell.mX <= max.mX)
+                        function(item.mValue);
+                return;
+            }
+
+            // Rows are sorted, so each next row is searched after the end of the previous one
+            auto it = mItems.begin();
+            for (int y = min.mY; y <= max.mY && it != mItems.end(); ++y)
+            {
+                const Cell first{ .mY = y, .mX = min.mX };
+                const Cell last{ .mY = y, .mX = max.mX };
+                it = std::lower_bound(
+                    it, mItems.end(), first, [](const Item& item, const Cell& cell) { return item.mCell < cell; });
+                for (; it != mItems.end() && it->mCell <= last; ++it)
+                    function(it->mValue);
+            }
+        }
+
+        /// Same as forEachNear but also looks into the neighbouring cells for values which could move by up to the
+        /// cell size since they were inserted.
+        template <class Function>
+        void forEachNearMoving(const osg::Vec3f& position, float radius, Function&& function) const
+        {
+            forEachNear(position, radius + mCellSize, std::forward<Function>(function));
+        }
+
+    private:
+        // Rows go first to make cells with the same y adjacent
+        struct Cell
+        {
+            int mY;
+            int mX;
+
+            friend auto operator<=>(const Cell& l, const Cell& r) = default;
+        };
+
+        struct Item
+        {
+            Cell mCell;
+            T mValue;
+        };
+
+        float mCellSize;
+        std::vector<Item> mItems;
+
+        static bool compareItems(const Item& l, const Item& r) { return l.mCell < r.mCell; }
+
+        static int toCellIndex(float value)
+        {
+            constexpr float limit = 1 << 30;
+            if (std::isnan(value))
+                return 0;
+            return static_cast<int>(std::clamp(std::floor(value), -limit, limit));
+        }
+
+        Cell getCell(const osg::Vec3f& position) const
+        {
+            return Cell{ .mY = toCellIndex(position.y() / mCellSize), .mX = toCellIndex(position.x() / mCellSize) };
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,138 @@
+#include "workerpool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace Misc
+{
+    namespace
+    {
+        struct ParallelForState
+        {
+            explicit ParallelForState(std::size_t count, const std::function<void(std::size_t)>& function)
+                : mCount(count)
+                , mFunction(function)
+            {
+            }
+
+            std::size_t mCount;
+            const std::function<void(std::size_t)>& mFunction;
+            std::atomic_size_t mNext{ 0 };
+            std::size_t mFinished = 0;
+            std::exception_ptr mException;
+            std::mutex mMutex;
+            std::condition_variable mAllFinished;
+
+            // Function is accessed only after claiming an index, the caller does not return before all claimed
+            // indices are finished so the reference stays valid.
+            void process()
+            {
+                std::size_t finished = 0;
+                std::exception_ptr exception;
+                for (std::size_t i = mNext++; i < mCount; i = mNext++)
+                {
+                    try
+                    {
+                        if (exception == nullptr)
+                            mFunction(i);
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+                    ++finished;
+                }
+                if (finished == 0)
+                    return;
+                const std::lock_guard lock(mMutex);
+                if (mException == nullptr)
+                    mException = std::move(exception);
+                mFinished += finished;
+                if (mFinished == mCount)
+                    mAllFinished.notify_all();
+            }
+        };
+    }
+
+    WorkerPool::WorkerPool(std::size_t threadsCount)
+    {
+        mThreads.reserve(threadsCount);
+        for (std::size_t i = 0; i < threadsCount; ++i)
+            mThreads.emplace_back([this] { run(); });
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mStopped = true;
+            mTasks.clear();
+        }
+        mHasTask.notify_all();
+        for (std::thread& thread : mThreads)
+            thread.join();
+    }
+
+    WorkerPool& WorkerPool::get()
+    {
+        static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency() / 2));
+        return pool;
+    }
+
+    void WorkerPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& function)
+    {
+        if (count == 0)
+            return;
+
+        const auto state = std::make_shared<ParallelForState>(count, function);
+
+        if (count > 1 && !mThreads.empty())
+        {
+            const std::size_t helpers = std::min(count - 1, mThreads.size());
+            {
+                const std::lock_guard lock(mMutex);
+                for (std::size_t i = 0; i < helpers; ++i)
+                    mTasks.emplace_back([state] { state->process(); });
+            }
+            if (helpers == 1)
+                mHasTask.notify_one();
+            else
+                mHasTask.notify_all();
+        }
+
+        state->process();
+
+        std::unique_lock lock(state->mMutex);
+        state->mAllFinished.wait(lock, [&] { return state->mFinished == state->mCount; });
+        if (state->mException != nullptr)
+            std::rethrow_exception(state->mException);
+    }
+
+    void WorkerPool::post(std::function<void()> function)
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mTasks.push_back(std::move(function));
+        }
+        mHasTask.notify_one();
+    }
+
+    void WorkerPool::run()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mMutex);
+                mHasTask.wait(lock, [&] { return mStopped || !mTasks.empty(); });
+                if (mStopped)
+                    return;
+                task = std::move(mTasks.front());
+                mTasks.pop_front();
+            }
+            task();
+        }
+    }
+}
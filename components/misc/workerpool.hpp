@@ -0,0 +1,50 @@
+#ifndef OPENMW_COMPONENTS_MISC_WORKERPOOL_H
+#define OPENMW_COMPONENTS_MISC_WORKERPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Misc
+{
+    /// @brief Pool of threads to process independent parts of a single task in parallel.
+    /// @par The calling thread takes part in the processing so nested use from other worker threads can not deadlock
+    /// even when all pool threads are busy.
+    class WorkerPool
+    {
+    public:
+        explicit WorkerPool(std::size_t threadsCount);
+
+        ~WorkerPool();
+
+        /// Shared instance with a number of threads based on hardware concurrency.
+        static WorkerPool& get();
+
+        /// Call function for each index in [0, count) using pool threads and the calling thread.
+        /// Returns when all calls are finished, rethrows the first thrown exception.
+        /// @note Thread safe.
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)>& function);
+
+        /// Call function on a pool thread without waiting for it. Function must not throw, it's discarded without a
+        /// call if the pool is destroyed first.
+        /// @note Thread safe.
+        void post(std::function<void()> function);
+
+        std::size_t getThreadsCount() const { return mThreads.size(); }
+
+    private:
+        std::mutex mMutex;
+        std::condition_variable mHasTask;
+        std::deque<std::function<void()>> mTasks;
+        bool mStopped = false;
+        std::vector<std::thread> mThreads;
+
+        void run();
+    };
+}
+
+#endif
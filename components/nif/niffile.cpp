@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <array>
+#include <istream>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <sstream>
@@ -23,6 +25,30 @@
 
 namespace Nif
 {
+    namespace
+    {
+        std::string readFile(std::istream& stream, std::string_view filename)
+        {
+            std::string result;
+            const std::istream::pos_type start = stream.tellg();
+            if (start != std::istream::pos_type(-1) && stream.seekg(0, std::ios_base::end))
+            {
+                const std::istream::pos_type end = stream.tellg();
+                stream.seekg(start);
+                result.resize(static_cast<std::size_t>(end - start));
+                stream.read(result.data(), static_cast<std::streamsize>(result.size()));
+                result.resize(static_cast<std::size_t>(stream.gcount()));
+            }
+            else
+            {
+                stream.clear();
+                result.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            }
+            if (stream.bad())
+                throw Nif::Exception("Failed to read file", filename);
+            return result;
+        }
+    }
 
     Reader::Reader(NIFFile& file, const ToUTF8::StatelessUtf8Encoder* encoder)
         : mVersion(file.mVersion)
@@ -537,10 +563,14 @@ namespace Nif
         if (writeDebug)
             Log(Debug::Verbose) << "NIF Debug: Reading file: '" << mFilename << "'";
 
-        const std::array<std::uint64_t, 2> fileHash = Files::getHash(mFilename, *stream);
+        // Decoding from memory is much cheaper than going through std::istream for each field
+        const std::string data = readFile(*stream, mFilename);
+        stream.reset();
+
+        const std::array<std::uint64_t, 2> fileHash = Files::getHash(data);
         mHash.append(reinterpret_cast<const char*>(fileHash.data()), fileHash.size() * sizeof(std::uint64_t));
 
-        NIFStream nif(*this, std::move(stream), mEncoder);
+        NIFStream nif(*this, data, mEncoder);
 
         // Check the header string
         std::string head = nif.getVersionString();
@@ -1,5 +1,7 @@
 #include "nifstream.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <span>
 
 #include "niffile.hpp"
@@ -23,12 +25,12 @@ namespace
     // This one should be used if the type can be read contiguously as an array of a different type
     // (e.g. osg::VecXf can be read as a float array of X elements)
     template <class elementType, size_t numElements, class T>
-    void readAlignedRange(Files::IStreamPtr& stream, T* dest, size_t size)
+    void readAlignedRange(Nif::NIFStream& stream, T* dest, size_t size)
     {
         static_assert(std::is_standard_layout_v<T>);
         static_assert(std::alignment_of_v<T> == std::alignment_of_v<elementType>);
         static_assert(sizeof(T) == sizeof(elementType) * numElements);
-        Nif::readDynamicBufferOfType(stream, reinterpret_cast<elementType*>(dest), size * numElements);
+        stream.read(reinterpret_cast<elementType*>(dest), size * numElements);
     }
 
 }
@@ -51,18 +53,21 @@ namespace Nif
         return mReader.getBethVersion();
     }
 
+    void NIFStream::throwUnexpectedEnd(std::size_t size, std::string_view what) const
+    {
+        throw std::runtime_error("Failed to read " + std::string(what) + " of " + std::to_string(size)
+            + " bytes: only " + std::to_string(mEnd - mPosition) + " bytes left");
+    }
+
     std::string NIFStream::getSizedString(size_t length)
     {
-        std::string str(length, '\0');
-        mStream->read(str.data(), length);
-        if (mStream->bad())
-            throw std::runtime_error("Failed to read sized string of " + std::to_string(length) + " chars");
-        size_t end = str.find('\0');
-        if (end != std::string::npos)
-            str.erase(end);
+        std::string_view view(consume(length, "sized string"), length);
+        const size_t end = view.find('\0');
+        if (end != std::string_view::npos)
+            view = view.substr(0, end);
         if (mEncoder)
-            str = mEncoder->getUtf8(str, ToUTF8::BufferAllocationPolicy::UseGrowFactor, mBuffer);
-        return str;
+            return std::string(mEncoder->getUtf8(view, ToUTF8::BufferAllocationPolicy::UseGrowFactor, mBuffer));
+        return std::string(view);
     }
 
     void NIFStream::getSizedStrings(std::vector<std::string>& vec, size_t size)
@@ -74,45 +79,40 @@ namespace Nif
 
     std::string NIFStream::getVersionString()
     {
-        std::string result;
-        std::getline(*mStream, result);
-        if (mStream->bad())
-            throw std::runtime_error("Failed to read version string");
+        const char* const end = std::find(mPosition, mEnd, '\n');
+        std::string result(mPosition, end);
+        mPosition = end == mEnd ? end : end + 1;
         return result;
     }
 
     std::string NIFStream::getStringPalette()
     {
-        size_t size = get<uint32_t>();
-        std::string str(size, '\0');
-        mStream->read(str.data(), size);
-        if (mStream->bad())
-            throw std::runtime_error("Failed to read string palette of " + std::to_string(size) + " chars");
-        return str;
+        const size_t size = get<uint32_t>();
+        return std::string(consume(size, "string palette"), size);
     }
 
     template <>
     void NIFStream::read<osg::Vec2f>(osg::Vec2f& vec)
     {
-        readBufferOfType(mStream, vec._v);
+        readBuffer(vec._v, std::size(vec._v));
     }
 
     template <>
     void NIFStream::read<osg::Vec3f>(osg::Vec3f& vec)
     {
-        readBufferOfType(mStream, vec._v);
+        readBuffer(vec._v, std::size(vec._v));
     }
 
     template <>
     void NIFStream::read<osg::Vec4f>(osg::Vec4f& vec)
     {
-        readBufferOfType(mStream, vec._v);
+        readBuffer(vec._v, std::size(vec._v));
     }
 
     template <>
     void NIFStream::read<Matrix3>(Matrix3& mat)
     {
-        readBufferOfType<9>(mStream, reinterpret_cast<float*>(&mat.mValues));
+        readBuffer(reinterpret_cast<float*>(&mat.mValues), 9);
     }
 
     template <>
@@ -178,25 +178,25 @@ namespace Nif
     template <>
     void NIFStream::read<osg::Vec2f>(osg::Vec2f* dest, size_t size)
     {
-        readAlignedRange<float, 2>(mStream, dest, size);
+        readAlignedRange<float, 2>(*this, dest, size);
     }
 
     template <>
     void NIFStream::read<osg::Vec3f>(osg::Vec3f* dest, size_t size)
     {
-        readAlignedRange<float, 3>(mStream, dest, size);
+        readAlignedRange<float, 3>(*this, dest, size);
     }
 
     template <>
     void NIFStream::read<osg::Vec4f>(osg::Vec4f* dest, size_t size)
     {
-        readAlignedRange<float, 4>(mStream, dest, size);
+        readAlignedRange<float, 4>(*this, dest, size);
     }
 
     template <>
     void NIFStream::read<Matrix3>(Matrix3* dest, size_t size)
     {
-        readAlignedRange<float, 9>(mStream, dest, size);
+        readAlignedRange<float, 9>(*this, dest, size);
     }
 
     template <>
@@ -5,14 +5,14 @@
 
 #include <array>
 #include <cassert>
-#include <istream>
+#include <cstring>
 #include <stdexcept>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
-#include <components/files/istreamptr.hpp>
 #include <components/misc/endianness.hpp>
 #include <components/misc/float16.hpp>
 
@@ -33,54 +33,49 @@ namespace Nif
 
     class Reader;
 
-    template <std::size_t numInstances, typename T>
-    inline void readBufferOfType(Files::IStreamPtr& pIStream, T* dest)
-    {
-        static_assert(
-            std::is_arithmetic_v<T> || std::is_same_v<T, Misc::float16_t>, "Buffer element type is not arithmetic");
-        static_assert(!std::is_same_v<T, bool>, "Buffer element type is boolean");
-        pIStream->read((char*)dest, numInstances * sizeof(T));
-        if (pIStream->bad())
-            throw std::runtime_error("Failed to read typed (" + std::string(typeid(T).name()) + ") buffer of "
-                + std::to_string(numInstances) + " instances");
-        if constexpr (Misc::IS_BIG_ENDIAN)
-            for (std::size_t i = 0; i < numInstances; i++)
-                Misc::swapEndiannessInplace(dest[i]);
-    }
-
-    template <std::size_t numInstances, typename T>
-    inline void readBufferOfType(Files::IStreamPtr& pIStream, T (&dest)[numInstances])
-    {
-        readBufferOfType<numInstances>(pIStream, static_cast<T*>(dest));
-    }
-
-    template <typename T>
-    inline void readDynamicBufferOfType(Files::IStreamPtr& pIStream, T* dest, std::size_t numInstances)
-    {
-        static_assert(
-            std::is_arithmetic_v<T> || std::is_same_v<T, Misc::float16_t>, "Buffer element type is not arithmetic");
-        static_assert(!std::is_same_v<T, bool>, "Buffer element type is boolean");
-        pIStream->read((char*)dest, numInstances * sizeof(T));
-        if (pIStream->bad())
-            throw std::runtime_error("Failed to read typed (" + std::string(typeid(T).name()) + ") dynamic buffer of "
-                + std::to_string(numInstances) + " instances");
-        if constexpr (Misc::IS_BIG_ENDIAN)
-            for (std::size_t i = 0; i < numInstances; i++)
-                Misc::swapEndiannessInplace(dest[i]);
-    }
-
+    /// Decodes the whole file loaded into memory. Arrays of arithmetic types are copied with a single memcpy, no
+    /// per-element conversion is done on little endian platforms.
     class NIFStream
     {
         const Reader& mReader;
-        Files::IStreamPtr mStream;
+        const char* mPosition;
+        const char* mEnd;
         const ToUTF8::StatelessUtf8Encoder* mEncoder;
         std::string mBuffer;
 
+        [[noreturn]] void throwUnexpectedEnd(std::size_t size, std::string_view what) const;
+
+        /// Returns the pointer to the next size bytes and moves past them
+        const char* consume(std::size_t size, std::string_view what)
+        {
+            if (size > static_cast<std::size_t>(mEnd - mPosition))
+                throwUnexpectedEnd(size, what);
+            const char* const result = mPosition;
+            mPosition += size;
+            return result;
+        }
+
+        template <typename T>
+        void readBuffer(T* dest, std::size_t numInstances)
+        {
+            static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, Misc::float16_t>,
+                "Buffer element type is not arithmetic");
+            static_assert(!std::is_same_v<T, bool>, "Buffer element type is boolean");
+            if (numInstances > static_cast<std::size_t>(mEnd - mPosition) / sizeof(T))
+                throwUnexpectedEnd(numInstances * sizeof(T), "typed buffer");
+            std::memcpy(dest, mPosition, numInstances * sizeof(T));
+            mPosition += numInstances * sizeof(T);
+            if constexpr (Misc::IS_BIG_ENDIAN)
+                for (std::size_t i = 0; i < numInstances; i++)
+                    Misc::swapEndiannessInplace(dest[i]);
+        }
+
     public:
-        explicit NIFStream(
-            const Reader& reader, Files::IStreamPtr&& stream, const ToUTF8::StatelessUtf8Encoder* encoder)
+        /// The data must outlive the stream
+        explicit NIFStream(const Reader& reader, std::string_view data, const ToUTF8::StatelessUtf8Encoder* encoder)
             : mReader(reader)
-            , mStream(std::move(stream))
+            , mPosition(data.data())
+            , mEnd(data.data() + data.size())
             , mEncoder(encoder)
         {
         }
@@ -97,27 +92,27 @@ namespace Nif
             return (major << 24) + (minor << 16) + (patch << 8) + rev;
         }
 
-        void skip(size_t size) { mStream->ignore(size); }
+        void skip(size_t size) { consume(size, "skipped data"); }
 
         /// Read into a single instance of type
         template <class T>
         void read(T& data)
         {
-            readBufferOfType<1>(mStream, &data);
+            readBuffer(&data, 1);
         }
 
         /// Read multiple instances of type into an array
         template <class T, size_t size>
         void readArray(std::array<T, size>& arr)
         {
-            readBufferOfType<size>(mStream, arr.data());
+            readBuffer(arr.data(), size);
         }
 
         /// Read instances of type into a dynamic buffer
         template <class T>
         void read(T* dest, size_t size)
         {
-            readDynamicBufferOfType<T>(mStream, dest, size);
+            readBuffer(dest, size);
         }
 
         /// Read multiple instances of type into a vector
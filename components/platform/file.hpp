@@ -63,6 +63,25 @@ namespace Platform::File
 
         operator Handle() const { return mHandle; }
     };
+
+    /// Read-only mapping of the whole file contents into memory.
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::filesystem::path& filename);
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+        ~MappedFile();
+
+        const char* data() const { return mData; }
+
+        size_t size() const { return mSize; }
+
+    private:
+        const char* mData = nullptr;
+        size_t mSize = 0;
+        intptr_t mNativeMapping = 0;
+    };
 }
 
 #endif // OPENMW_COMPONENTS_PLATFORM_FILE_HPP
@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <string.h>
 #include <string>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -103,4 +104,25 @@ namespace Platform::File
         return amount;
     }
 
+    MappedFile::MappedFile(const std::filesystem::path& filename)
+    {
+        ScopedHandle handle = open(filename);
+        mSize = File::size(handle);
+        if (mSize == 0)
+            return;
+        void* const data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, getNativeHandle(handle), 0);
+        if (data == MAP_FAILED)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                std::string("Failed to map '") + Files::pathToUnicodeString(filename) + "' into memory");
+        }
+        mData = static_cast<const char*>(data);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (mData != nullptr)
+            ::munmap(const_cast<char*>(mData), mSize);
+    }
+
 }
@@ -93,4 +93,32 @@ namespace Platform::File
         return static_cast<size_t>(amount);
     }
 
+    // There is no portable way to map a file into memory so read the whole file instead.
+    MappedFile::MappedFile(const std::filesystem::path& filename)
+    {
+        ScopedHandle handle = open(filename);
+        mSize = File::size(handle);
+        if (mSize == 0)
+            return;
+        char* const data = new char[mSize];
+        size_t position = 0;
+        while (position < mSize)
+        {
+            const size_t amount = File::read(handle, data + position, mSize - position);
+            if (amount == 0)
+            {
+                delete[] data;
+                throw std::runtime_error(
+                    std::string("Unexpected end of file '") + Files::pathToUnicodeString(filename) + "'");
+            }
+            position += amount;
+        }
+        mData = data;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        delete[] mData;
+    }
+
 }
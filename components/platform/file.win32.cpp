@@ -99,4 +99,36 @@ namespace Platform::File
 
         return bytesRead;
     }
+
+    MappedFile::MappedFile(const std::filesystem::path& filename)
+    {
+        ScopedHandle handle = open(filename);
+        mSize = File::size(handle);
+        if (mSize == 0)
+            return;
+        HANDLE mapping = CreateFileMappingW(getNativeHandle(handle), nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            throw std::runtime_error(std::string("Failed to create mapping for '") + Files::pathToUnicodeString(filename)
+                + "': " + std::to_string(GetLastError()));
+        }
+        const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            const DWORD errCode = GetLastError();
+            CloseHandle(mapping);
+            throw std::runtime_error(std::string("Failed to map '") + Files::pathToUnicodeString(filename)
+                + "' into memory: " + std::to_string(errCode));
+        }
+        mData = static_cast<const char*>(data);
+        mNativeMapping = reinterpret_cast<intptr_t>(mapping);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (mData != nullptr)
+            UnmapViewOfFile(mData);
+        if (mNativeMapping != 0)
+            CloseHandle(reinterpret_cast<HANDLE>(mNativeMapping));
+    }
 }
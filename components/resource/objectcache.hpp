@@ -21,16 +21,25 @@
 #define OPENMW_COMPONENTS_RESOURCE_OBJECTCACHE
 
 #include "cachestats.hpp"
+#include "objectsize.hpp"
 
 #include <osg/Node>
 #include <osg/Referenced>
 #include <osg/ref_ptr>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
 #include <map>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace osg
@@ -47,6 +56,7 @@ namespace Resource
     {
         osg::ref_ptr<osg::Object> mValue;
         double mLastUsage;
+        std::size_t mSize;
     };
 
     template <typename KeyType>
@@ -55,7 +65,8 @@ namespace Resource
     public:
         // Update last usage timestamp using referenceTime for each cache time if they are not nullptr and referenced
         // from somewhere else. Remove items with last usage > expiryTime. Note: last usage might be updated from other
-        // places so nullptr or not references elsewhere items are not always removed.
+        // places so nullptr or not references elsewhere items are not always removed. When estimated size of all items
+        // is still over the budget remove least recently used items not referenced from somewhere else until it fits.
         void update(double referenceTime, double expiryDelay)
         {
             std::vector<osg::ref_ptr<osg::Object>> objectsToRemove;
@@ -69,32 +80,80 @@ namespace Resource
                     if (item.mLastUsage > expiryTime)
                         return false;
                     ++mExpired;
+                    mBytes -= item.mSize;
                     if (item.mValue != nullptr)
                         objectsToRemove.push_back(std::move(item.mValue));
                     return true;
                 });
+                if (mBytes > mMaxBytes)
+                    evict(mMaxBytes, objectsToRemove);
             }
             // note, actual unref happens outside of the lock
             objectsToRemove.clear();
         }
 
+        // Set the estimated size of items to keep. Sizes are estimated only while the budget is limited because it
+        // requires traversing scene graphs, items already in the cache are estimated when the budget is enabled.
+        void setMaxBytes(std::size_t maxBytes)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            const bool wasLimited = isLimited();
+            mMaxBytes = maxBytes;
+            if (wasLimited == isLimited())
+                return;
+            mBytes = 0;
+            for (auto& [k, v] : mItems)
+            {
+                v.mSize = isLimited() && v.mValue != nullptr ? estimateObjectSize(*v.mValue) : 0;
+                mBytes += v.mSize;
+            }
+        }
+
+        // Remove least recently used items not referenced from somewhere else until estimated size of all items fits
+        // into maxBytes.
+        void evict(std::size_t maxBytes)
+        {
+            std::vector<osg::ref_ptr<osg::Object>> objectsToRemove;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mBytes > maxBytes)
+                    evict(maxBytes, objectsToRemove);
+            }
+            objectsToRemove.clear();
+        }
+
+        // Append last usage and estimated size of items that can be evicted.
+        void getEvictionCandidates(std::vector<std::pair<double, std::size_t>>& out) const
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (const auto& [k, v] : mItems)
+                if (isEvictable(v))
+                    out.emplace_back(v.mLastUsage, v.mSize);
+        }
+
         /** Remove all objects in the cache regardless of having external references or expiry times.*/
         void clear()
         {
             std::lock_guard<std::mutex> lock(mMutex);
             mItems.clear();
+            mBytes = 0;
         }
 
         /** Add a key,object,timestamp triple to the Registry::ObjectCache.*/
         template <class K>
         void addEntryToObjectCache(K&& key, osg::Object* object, double timestamp = 0.0)
         {
+            const std::size_t size = object == nullptr || !isLimited() ? 0 : estimateObjectSize(*object);
             std::lock_guard<std::mutex> lock(mMutex);
             const auto it = mItems.find(key);
             if (it == mItems.end())
-                mItems.emplace_hint(it, std::forward<K>(key), Item{ object, timestamp });
+                mItems.emplace_hint(it, std::forward<K>(key), Item{ object, timestamp, size });
             else
-                it->second = Item{ object, timestamp };
+            {
+                mBytes -= it->second.mSize;
+                it->second = Item{ object, timestamp, size };
+            }
+            mBytes += size;
         }
 
         /** Remove Object from cache.*/
@@ -103,7 +162,10 @@ namespace Resource
             std::lock_guard<std::mutex> lock(mMutex);
             const auto itr = mItems.find(key);
             if (itr != mItems.end())
+            {
+                mBytes -= itr->second.mSize;
                 mItems.erase(itr);
+            }
         }
 
         /** Get an ref_ptr<Object> from the object cache*/
@@ -180,6 +242,8 @@ namespace Resource
                 .mGet = mGet,
                 .mHit = mHit,
                 .mExpired = mExpired,
+                .mEvicted = mEvicted,
+                .mBytes = mBytes,
             };
         }
 
@@ -191,6 +255,16 @@ namespace Resource
         std::size_t mGet = 0;
         std::size_t mHit = 0;
         std::size_t mExpired = 0;
+        std::size_t mEvicted = 0;
+        std::size_t mBytes = 0;
+        std::atomic<std::size_t> mMaxBytes = std::numeric_limits<std::size_t>::max();
+
+        bool isLimited() const { return mMaxBytes != std::numeric_limits<std::size_t>::max(); }
+
+        static bool isEvictable(const Item& item)
+        {
+            return item.mSize != 0 && (item.mValue == nullptr || item.mValue->referenceCount() == 1);
+        }
 
         Item* find(const auto& key)
         {
@@ -201,6 +275,183 @@ namespace Resource
             ++mHit;
             return &it->second;
         }
+
+        void evict(std::size_t maxBytes, std::vector<osg::ref_ptr<osg::Object>>& objectsToRemove)
+        {
+            using Iterator = typename decltype(mItems)::iterator;
+            std::vector<Iterator> candidates;
+            for (auto it = mItems.begin(); it != mItems.end(); ++it)
+                if (isEvictable(it->second))
+                    candidates.push_back(it);
+            std::sort(candidates.begin(), candidates.end(),
+                [](Iterator l, Iterator r) { return l->second.mLastUsage < r->second.mLastUsage; });
+            for (Iterator it : candidates)
+            {
+                if (mBytes <= maxBytes)
+                    break;
+                ++mEvicted;
+                mBytes -= it->second.mSize;
+                objectsToRemove.push_back(std::move(it->second.mValue));
+                mItems.erase(it);
+            }
+        }
+    };
+
+    // Same interface as GenericObjectCache but items are distributed over independent caches by key hash so concurrent
+    // access from multiple threads to different keys is unlikely to wait for the same mutex. Hash must produce equal
+    // values for all key types used for lookups. Iteration order is sorted within a shard only.
+    template <typename KeyType, typename Hash = std::hash<KeyType>, std::size_t shardsCount = 16>
+    class ShardedObjectCache : public osg::Referenced
+    {
+    public:
+        using Shard = GenericObjectCache<KeyType>;
+
+        ShardedObjectCache()
+        {
+            for (osg::ref_ptr<Shard>& shard : mShards)
+                shard = new Shard;
+        }
+
+        // Memory budget applies to the total estimated size of all shards.
+        void update(double referenceTime, double expiryDelay)
+        {
+            // Each shard is limited by the total budget on its own so it only evicts when the total is exceeded.
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+                shard->update(referenceTime, expiryDelay);
+            if (mMaxBytes == std::numeric_limits<std::size_t>::max())
+                return;
+            std::array<std::size_t, shardsCount> bytes;
+            std::size_t totalBytes = 0;
+            for (std::size_t i = 0; i < shardsCount; ++i)
+            {
+                bytes[i] = mShards[i]->getStats().mBytes;
+                totalBytes += bytes[i];
+            }
+            if (totalBytes <= mMaxBytes)
+                return;
+            // Find least recently used items over all shards to free enough memory and evict them from each shard.
+            std::vector<std::tuple<double, std::size_t, std::size_t>> candidates;
+            std::vector<std::pair<double, std::size_t>> shardCandidates;
+            for (std::size_t i = 0; i < shardsCount; ++i)
+            {
+                shardCandidates.clear();
+                mShards[i]->getEvictionCandidates(shardCandidates);
+                for (const auto& [lastUsage, size] : shardCandidates)
+                    candidates.emplace_back(lastUsage, size, i);
+            }
+            std::sort(candidates.begin(), candidates.end());
+            std::array<bool, shardsCount> changed{};
+            for (const auto& [lastUsage, size, shard] : candidates)
+            {
+                if (totalBytes <= mMaxBytes)
+                    break;
+                totalBytes -= size;
+                bytes[shard] -= size;
+                changed[shard] = true;
+            }
+            for (std::size_t i = 0; i < shardsCount; ++i)
+                if (changed[i])
+                    mShards[i]->evict(bytes[i]);
+        }
+
+        void setMaxBytes(std::size_t maxBytes)
+        {
+            mMaxBytes = maxBytes;
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+                shard->setMaxBytes(maxBytes);
+        }
+
+        void clear()
+        {
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+                shard->clear();
+        }
+
+        template <class K>
+        void addEntryToObjectCache(K&& key, osg::Object* object, double timestamp = 0.0)
+        {
+            Shard& shard = getShard(key);
+            shard.addEntryToObjectCache(std::forward<K>(key), object, timestamp);
+        }
+
+        void removeFromObjectCache(const auto& key) { getShard(key).removeFromObjectCache(key); }
+
+        osg::ref_ptr<osg::Object> getRefFromObjectCache(const auto& key)
+        {
+            return getShard(key).getRefFromObjectCache(key);
+        }
+
+        std::optional<osg::ref_ptr<osg::Object>> getRefFromObjectCacheOrNone(const auto& key)
+        {
+            return getShard(key).getRefFromObjectCacheOrNone(key);
+        }
+
+        bool checkInObjectCache(const auto& key, double timeStamp)
+        {
+            return getShard(key).checkInObjectCache(key, timeStamp);
+        }
+
+        void releaseGLObjects(osg::State* state)
+        {
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+                shard->releaseGLObjects(state);
+        }
+
+        void accept(osg::NodeVisitor& nv)
+        {
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+                shard->accept(nv);
+        }
+
+        template <class Functor>
+        void call(Functor&& f)
+        {
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+                shard->call(f);
+        }
+
+        template <class K>
+        std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> lowerBound(K&& key)
+        {
+            std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> result;
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+            {
+                auto candidate = shard->lowerBound(key);
+                if (candidate.has_value() && (!result.has_value() || std::less<>()(candidate->first, result->first)))
+                    result = std::move(candidate);
+            }
+            return result;
+        }
+
+        CacheStats getStats() const
+        {
+            CacheStats result;
+            for (const osg::ref_ptr<Shard>& shard : mShards)
+            {
+                const CacheStats stats = shard->getStats();
+                result.mSize += stats.mSize;
+                result.mGet += stats.mGet;
+                result.mHit += stats.mHit;
+                result.mExpired += stats.mExpired;
+                result.mEvicted += stats.mEvicted;
+                result.mBytes += stats.mBytes;
+            }
+            return result;
+        }
+
+    private:
+        std::array<osg::ref_ptr<Shard>, shardsCount> mShards;
+        std::size_t mMaxBytes = std::numeric_limits<std::size_t>::max();
+
+        Shard& getShard(const auto& key)
+        {
+            std::size_t hash;
+            if constexpr (std::is_array_v<std::remove_cvref_t<decltype(key)>>)
+                hash = Hash{}(std::string_view(key));
+            else
+                hash = Hash{}(key);
+            return *mShards[hash % shardsCount];
+        }
     };
 }
 
@@ -0,0 +1,144 @@
+#include "objectsize.hpp"
+
+#include "bulletshape.hpp"
+
+#include <osg/Geometry>
+#include <osg/Image>
+#include <osg/Node>
+#include <osg/NodeVisitor>
+#include <osg/StateSet>
+#include <osg/Texture>
+
+#include <BulletCollision/CollisionShapes/btCompoundShape.h>
+#include <BulletCollision/CollisionShapes/btStridingMeshInterface.h>
+
+#include <unordered_set>
+
+namespace Resource
+{
+    namespace
+    {
+        class SizeVisitor : public osg::NodeVisitor
+        {
+        public:
+            SizeVisitor()
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            {
+            }
+
+            void apply(osg::Node& node) override
+            {
+                addStateSet(node.getStateSet());
+                traverse(node);
+            }
+
+            void apply(osg::Drawable& drawable) override
+            {
+                addStateSet(drawable.getStateSet());
+                if (osg::Geometry* const geometry = drawable.asGeometry())
+                    addGeometry(*geometry);
+            }
+
+            std::size_t getSize() const { return mSize; }
+
+        private:
+            std::unordered_set<const osg::Referenced*> mVisited;
+            std::size_t mSize = 0;
+
+            void addImage(const osg::Image* image)
+            {
+                // Images loaded from files are shared through the image cache and accounted there.
+                if (image != nullptr && image->getFileName().empty() && mVisited.insert(image).second)
+                    mSize += image->getTotalSizeInBytesIncludingMipmaps();
+            }
+
+            void addStateSet(const osg::StateSet* stateSet)
+            {
+                if (stateSet == nullptr || !mVisited.insert(stateSet).second)
+                    return;
+                for (const osg::StateSet::AttributeList& attributes : stateSet->getTextureAttributeList())
+                    for (const auto& [type, attribute] : attributes)
+                        if (const osg::Texture* const texture = attribute.first->asTexture())
+                            for (unsigned i = 0; i < texture->getNumImages(); ++i)
+                                addImage(texture->getImage(i));
+            }
+
+            void addGeometry(const osg::Geometry& geometry)
+            {
+                osg::Geometry::ArrayList arrays;
+                geometry.getArrayList(arrays);
+                for (const osg::ref_ptr<osg::Array>& array : arrays)
+                    if (mVisited.insert(array.get()).second)
+                        mSize += array->getTotalDataSize();
+                for (const osg::ref_ptr<osg::PrimitiveSet>& primitiveSet : geometry.getPrimitiveSetList())
+                    if (mVisited.insert(primitiveSet.get()).second)
+                        mSize += primitiveSet->getTotalDataSize();
+            }
+        };
+
+        std::size_t estimateMeshSize(const btStridingMeshInterface& mesh)
+        {
+            std::size_t result = 0;
+            for (int part = 0, n = mesh.getNumSubParts(); part < n; ++part)
+            {
+                const unsigned char* vertexBase = nullptr;
+                int verticesCount = 0;
+                PHY_ScalarType vertexType;
+                int vertexStride = 0;
+                const unsigned char* indexBase = nullptr;
+                int indexStride = 0;
+                int facesCount = 0;
+                PHY_ScalarType indexType;
+                mesh.getLockedReadOnlyVertexIndexBase(&vertexBase, verticesCount, vertexType, vertexStride, &indexBase,
+                    indexStride, facesCount, indexType, part);
+                result += static_cast<std::size_t>(verticesCount) * static_cast<std::size_t>(vertexStride)
+                    + static_cast<std::size_t>(facesCount) * static_cast<std::size_t>(indexStride);
+                mesh.unLockReadOnlyVertexBase(part);
+            }
+            return result;
+        }
+
+        std::size_t estimateShapeSize(const btCollisionShape* shape)
+        {
+            if (shape == nullptr)
+                return 0;
+
+            if (shape->isCompound())
+            {
+                const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+                std::size_t result = sizeof(btCompoundShape);
+                for (int i = 0, n = compound->getNumChildShapes(); i < n; ++i)
+                    result += estimateShapeSize(compound->getChildShape(i));
+                return result;
+            }
+
+            if (shape->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+            {
+                const btBvhTriangleMeshShape* mesh = static_cast<const btBvhTriangleMeshShape*>(shape);
+                return sizeof(btBvhTriangleMeshShape) + estimateMeshSize(*mesh->getMeshInterface());
+            }
+
+            // Other shapes are either primitives or reference a triangle mesh owned by another shape.
+            return sizeof(btCollisionShape);
+        }
+    }
+
+    std::size_t estimateObjectSize(const osg::Object& object)
+    {
+        if (const osg::Image* const image = dynamic_cast<const osg::Image*>(&object))
+            return image->getTotalSizeInBytesIncludingMipmaps();
+
+        if (const BulletShape* const shape = dynamic_cast<const BulletShape*>(&object))
+            return estimateShapeSize(shape->mCollisionShape.get())
+                + estimateShapeSize(shape->mAvoidCollisionShape.get());
+
+        if (const osg::Node* const node = dynamic_cast<const osg::Node*>(&object))
+        {
+            SizeVisitor visitor;
+            const_cast<osg::Node*>(node)->accept(visitor);
+            return visitor.getSize();
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_OBJECTSIZE_H
+#define OPENMW_COMPONENTS_RESOURCE_OBJECTSIZE_H
+
+#include <cstddef>
+
+namespace osg
+{
+    class Object;
+}
+
+namespace Resource
+{
+    /// Estimate the amount of memory in bytes owned by a cached object: image data, geometry arrays, textures
+    /// referenced by a scene graph and collision meshes of a bullet shape. Data shared by multiple parts of the object
+    /// is counted once. Images with a file name referenced by a scene graph are not counted because they are owned by
+    /// the image cache. Returns 0 for types that are not known to hold a significant amount of memory.
+    std::size_t estimateObjectSize(const osg::Object& object);
+}
+
+#endif
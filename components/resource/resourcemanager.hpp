@@ -3,6 +3,9 @@
 
 #include <osg/ref_ptr>
 
+#include <cstddef>
+#include <limits>
+
 #include <components/vfs/pathutil.hpp>
 
 #include "objectcache.hpp"
@@ -28,6 +31,7 @@ namespace Resource
         virtual void updateCache(double referenceTime) = 0;
         virtual void clearCache() = 0;
         virtual void setExpiryDelay(double expiryDelay) = 0;
+        virtual void setMemoryBudget(std::size_t maxBytes) = 0;
         virtual void reportStats(unsigned int frameNumber, osg::Stats* stats) const = 0;
         virtual void releaseGLObjects(osg::State* state) = 0;
     };
@@ -35,11 +39,11 @@ namespace Resource
     /// @brief Base class for managers that require a virtual file system and object cache.
     /// @par This base class implements clearing of the cache, but populating it and what it's used for is up to the
     /// individual sub classes.
-    template <class KeyType>
+    template <class KeyType, class Cache = GenericObjectCache<KeyType>>
     class GenericResourceManager : public BaseResourceManager
     {
     public:
-        typedef GenericObjectCache<KeyType> CacheType;
+        typedef Cache CacheType;
 
         explicit GenericResourceManager(const VFS::Manager* vfs, double expiryDelay)
             : mVFS(vfs)
@@ -50,8 +54,12 @@ namespace Resource
 
         virtual ~GenericResourceManager() = default;
 
-        /// Clear cache entries that have not been referenced for longer than expiryDelay.
-        void updateCache(double referenceTime) override { mCache->update(referenceTime, mExpiryDelay); }
+        /// Clear cache entries that have not been referenced for longer than expiryDelay and least recently used
+        /// unreferenced entries while estimated size of the cache is over the memory budget.
+        void updateCache(double referenceTime) override
+        {
+            mCache->update(referenceTime, mExpiryDelay);
+        }
 
         /// Clear all cache entries.
         void clearCache() override { mCache->clear(); }
@@ -60,6 +68,14 @@ namespace Resource
         void setExpiryDelay(double expiryDelay) final { mExpiryDelay = expiryDelay; }
         double getExpiryDelay() const { return mExpiryDelay; }
 
+        /// Estimated size of cached objects to keep when they are no longer referenced.
+        void setMemoryBudget(std::size_t maxBytes) final
+        {
+            mMemoryBudget = maxBytes;
+            mCache->setMaxBytes(maxBytes);
+        }
+        std::size_t getMemoryBudget() const { return mMemoryBudget; }
+
         const VFS::Manager* getVFS() const { return mVFS; }
 
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override {}
@@ -70,9 +86,11 @@ namespace Resource
         const VFS::Manager* mVFS;
         osg::ref_ptr<CacheType> mCache;
         double mExpiryDelay;
+        std::size_t mMemoryBudget = std::numeric_limits<std::size_t>::max();
     };
 
-    class ResourceManager : public GenericResourceManager<std::string>
+    /// @note Uses sharded cache because resources are requested concurrently by many worker threads.
+    class ResourceManager : public GenericResourceManager<std::string, ShardedObjectCache<std::string, VFS::Path::Hash>>
     {
     public:
         explicit ResourceManager(const VFS::Manager* vfs, double expiryDelay)
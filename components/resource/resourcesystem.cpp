@@ -81,6 +81,14 @@ namespace Resource
         mNifFileManager->setExpiryDelay(0.0);
     }
 
+    void ResourceSystem::setMemoryBudget(std::size_t maxBytes)
+    {
+        mMemoryBudget = maxBytes;
+
+        for (BaseResourceManager* resourceManager : mResourceManagers)
+            resourceManager->setMemoryBudget(maxBytes);
+    }
+
     void ResourceSystem::updateCache(double referenceTime)
     {
         for (std::vector<BaseResourceManager*>::iterator it = mResourceManagers.begin(); it != mResourceManagers.end();
@@ -97,6 +105,7 @@ namespace Resource
 
     void ResourceSystem::addResourceManager(BaseResourceManager* resourceMgr)
     {
+        resourceMgr->setMemoryBudget(mMemoryBudget);
         mResourceManagers.push_back(resourceMgr);
     }
 
@@ -1,6 +1,8 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 #define OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -67,6 +69,10 @@ namespace Resource
         /// How long to keep objects in cache after no longer being referenced.
         void setExpiryDelay(double expiryDelay);
 
+        /// Estimated size of unreferenced objects to keep in each resource manager cache. Applies to resource managers
+        /// added later as well.
+        void setMemoryBudget(std::size_t maxBytes);
+
         /// @note May be called from any thread.
         const VFS::Manager* getVFS() const;
 
@@ -89,6 +95,8 @@ namespace Resource
 
         const VFS::Manager* mVFS;
 
+        std::size_t mMemoryBudget = std::numeric_limits<std::size_t>::max();
+
         ResourceSystem(const ResourceSystem&);
         void operator=(const ResourceSystem&);
     };
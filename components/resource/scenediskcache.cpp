@@ -0,0 +1,1223 @@
+#include "scenediskcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/files/atomicfile.hpp>
+#include <components/misc/endianness.hpp>
+#include <components/misc/strings/format.hpp>
+#include <components/nifosg/matrixtransform.hpp>
+#include <components/sceneutil/texturetype.hpp>
+#include <components/version/version.hpp>
+#include <components/vfs/manager.hpp>
+#include <components/vfs/recursivedirectoryiterator.hpp>
+
+#include <extern/smhasher/MurmurHash3.h>
+
+#include <osg/AlphaFunc>
+#include <osg/BlendFunc>
+#include <osg/Depth>
+#include <osg/FrontFace>
+#include <osg/Geometry>
+#include <osg/Material>
+#include <osg/PolygonMode>
+#include <osg/PolygonOffset>
+#include <osg/TexEnv>
+#include <osg/TexEnvCombine>
+#include <osg/TexMat>
+#include <osg/Texture2D>
+#include <osg/UserDataContainer>
+#include <osg/ValueObject>
+
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace Resource
+{
+    namespace
+    {
+        constexpr std::string_view fileMagic = "OMWSCENE";
+
+        // Increment when the format or the NIF conversion changes
+        constexpr std::uint32_t formatVersion = 1;
+
+        enum class NodeType : std::uint8_t
+        {
+            Group,
+            NifMatrixTransform,
+            Geometry,
+        };
+
+        enum class AttributeType : std::uint8_t
+        {
+            Texture2D,
+            TextureType,
+            TexEnv,
+            TexEnvCombine,
+            TexMat,
+            Material,
+            AlphaFunc,
+            BlendFunc,
+            Depth,
+            FrontFace,
+            PolygonOffset,
+            PolygonMode,
+        };
+
+        enum class ValueType : std::uint8_t
+        {
+            String,
+            Bool,
+            Int,
+            UInt,
+            Float,
+        };
+
+        enum class UniformDataType : std::uint8_t
+        {
+            Float,
+            Int,
+        };
+
+        // Thrown when the scene has an object not supported by the format
+        struct UnsupportedObject
+        {
+        };
+
+        template <class T>
+        bool isExactly(const auto& object)
+        {
+            return typeid(object) == typeid(T);
+        }
+
+        class Writer
+        {
+        public:
+            explicit Writer(std::string& out)
+                : mOut(out)
+            {
+            }
+
+            template <class T>
+            void write(T value)
+            {
+                static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+                writeBytes(&value, sizeof(T));
+            }
+
+            void writeBytes(const void* data, std::size_t size)
+            {
+                mOut.append(static_cast<const char*>(data), size);
+            }
+
+            void writeString(std::string_view value)
+            {
+                write(static_cast<std::uint32_t>(value.size()));
+                writeBytes(value.data(), value.size());
+            }
+
+            /// Writes id of the shared object, returns true when the object is written for the first time and its
+            /// content has to follow
+            bool writeReference(const osg::Object* object)
+            {
+                if (object == nullptr)
+                {
+                    write(std::uint32_t{ 0 });
+                    return false;
+                }
+                const auto [it, inserted] = mIds.emplace(object, static_cast<std::uint32_t>(mIds.size() + 1));
+                write(it->second);
+                return inserted;
+            }
+
+        private:
+            std::string& mOut;
+            std::unordered_map<const osg::Object*, std::uint32_t> mIds;
+        };
+
+        class Reader
+        {
+        public:
+            explicit Reader(std::string_view data)
+                : mData(data)
+            {
+            }
+
+            template <class T>
+            T read()
+            {
+                static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+                T value;
+                readBytes(&value, sizeof(T));
+                return value;
+            }
+
+            void readBytes(void* data, std::size_t size)
+            {
+                if (mData.size() - mPos < size)
+                    throw std::runtime_error("Unexpected end of scene cache data");
+                std::memcpy(data, mData.data() + mPos, size);
+                mPos += size;
+            }
+
+            std::string readString()
+            {
+                std::string result(read<std::uint32_t>(), '\0');
+                readBytes(result.data(), result.size());
+                return result;
+            }
+
+            /// Reads id of the shared object. Calls read to get the object if it's not read yet.
+            template <class T, class Function>
+            osg::ref_ptr<T> readReference(Function&& read)
+            {
+                const std::uint32_t id = this->read<std::uint32_t>();
+                if (id == 0)
+                    return nullptr;
+                if (id <= mObjects.size())
+                {
+                    T* const object = dynamic_cast<T*>(mObjects[id - 1].get());
+                    if (object == nullptr)
+                        throw std::runtime_error("Invalid scene cache object reference type");
+                    return object;
+                }
+                if (id != mObjects.size() + 1)
+                    throw std::runtime_error("Invalid scene cache object reference id");
+                osg::ref_ptr<T> object = read();
+                mObjects.emplace_back(object);
+                return object;
+            }
+
+            bool isEnd() const { return mPos == mData.size(); }
+
+        private:
+            std::string_view mData;
+            std::size_t mPos = 0;
+            std::vector<osg::ref_ptr<osg::Object>> mObjects;
+        };
+
+        template <class T>
+        void writeVec(Writer& writer, const T& value)
+        {
+            writer.writeBytes(value.ptr(), sizeof(typename T::value_type) * T::num_components);
+        }
+
+        template <class T>
+        T readVec(Reader& reader)
+        {
+            T result;
+            reader.readBytes(result.ptr(), sizeof(typename T::value_type) * T::num_components);
+            return result;
+        }
+
+        void writeMatrix(Writer& writer, const osg::Matrix& value)
+        {
+            writer.writeBytes(value.ptr(), sizeof(osg::Matrix::value_type) * 16);
+        }
+
+        osg::Matrix readMatrix(Reader& reader)
+        {
+            osg::Matrix result;
+            reader.readBytes(result.ptr(), sizeof(osg::Matrix::value_type) * 16);
+            return result;
+        }
+
+        class SceneWriter
+        {
+        public:
+            explicit SceneWriter(std::string& out)
+                : mWriter(out)
+            {
+            }
+
+            void writeNode(const osg::Node& node)
+            {
+                if (node.getUpdateCallback() != nullptr || node.getEventCallback() != nullptr
+                    || node.getCullCallback() != nullptr || node.getComputeBoundingSphereCallback() != nullptr
+                    || node.getInitialBound().valid() || node.getNumParents() > 1)
+                    throw UnsupportedObject{};
+
+                if (isExactly<osg::Group>(node))
+                {
+                    mWriter.write(NodeType::Group);
+                    writeNodeData(node);
+                    writeChildren(static_cast<const osg::Group&>(node));
+                }
+                else if (isExactly<NifOsg::MatrixTransform>(node))
+                {
+                    const auto& transform = static_cast<const NifOsg::MatrixTransform&>(node);
+                    mWriter.write(NodeType::NifMatrixTransform);
+                    writeNodeData(node);
+                    mWriter.write(static_cast<std::uint8_t>(transform.getReferenceFrame()));
+                    writeMatrix(mWriter, transform.getMatrix());
+                    mWriter.write(transform.mScale);
+                    mWriter.writeBytes(transform.mRotationScale.mValues, sizeof(transform.mRotationScale.mValues));
+                    writeChildren(transform);
+                }
+                else if (isExactly<osg::Geometry>(node))
+                {
+                    mWriter.write(NodeType::Geometry);
+                    writeNodeData(node);
+                    writeGeometry(static_cast<const osg::Geometry&>(node));
+                }
+                else
+                    throw UnsupportedObject{};
+            }
+
+        private:
+            Writer mWriter;
+
+            void writeNodeData(const osg::Node& node)
+            {
+                mWriter.writeString(node.getName());
+                mWriter.write(static_cast<std::uint8_t>(node.getDataVariance()));
+                mWriter.write(static_cast<std::uint32_t>(node.getNodeMask()));
+                mWriter.write(node.getCullingActive());
+                writeUserData(node);
+                writeStateSet(node.getStateSet());
+            }
+
+            void writeChildren(const osg::Group& group)
+            {
+                mWriter.write(static_cast<std::uint32_t>(group.getNumChildren()));
+                for (unsigned i = 0; i < group.getNumChildren(); ++i)
+                    writeNode(*group.getChild(i));
+            }
+
+            void writeUserData(const osg::Object& object)
+            {
+                const osg::UserDataContainer* const container = object.getUserDataContainer();
+                if (container == nullptr)
+                {
+                    mWriter.write(false);
+                    return;
+                }
+                if (!isExactly<osg::DefaultUserDataContainer>(*container) || container->getUserData() != nullptr)
+                    throw UnsupportedObject{};
+                mWriter.write(true);
+
+                const osg::UserDataContainer::DescriptionList& descriptions = container->getDescriptions();
+                mWriter.write(static_cast<std::uint32_t>(descriptions.size()));
+                for (const std::string& description : descriptions)
+                    mWriter.writeString(description);
+
+                mWriter.write(static_cast<std::uint32_t>(container->getNumUserObjects()));
+                for (unsigned i = 0; i < container->getNumUserObjects(); ++i)
+                    writeValue(*container->getUserObject(i));
+            }
+
+            void writeValue(const osg::Object& value)
+            {
+                if (isExactly<osg::StringValueObject>(value))
+                {
+                    mWriter.write(ValueType::String);
+                    mWriter.writeString(value.getName());
+                    mWriter.writeString(static_cast<const osg::StringValueObject&>(value).getValue());
+                }
+                else if (isExactly<osg::BoolValueObject>(value))
+                {
+                    mWriter.write(ValueType::Bool);
+                    mWriter.writeString(value.getName());
+                    mWriter.write(static_cast<const osg::BoolValueObject&>(value).getValue());
+                }
+                else if (isExactly<osg::IntValueObject>(value))
+                {
+                    mWriter.write(ValueType::Int);
+                    mWriter.writeString(value.getName());
+                    mWriter.write(static_cast<std::int32_t>(static_cast<const osg::IntValueObject&>(value).getValue()));
+                }
+                else if (isExactly<osg::UIntValueObject>(value))
+                {
+                    mWriter.write(ValueType::UInt);
+                    mWriter.writeString(value.getName());
+                    mWriter.write(
+                        static_cast<std::uint32_t>(static_cast<const osg::UIntValueObject&>(value).getValue()));
+                }
+                else if (isExactly<osg::FloatValueObject>(value))
+                {
+                    mWriter.write(ValueType::Float);
+                    mWriter.writeString(value.getName());
+                    mWriter.write(static_cast<const osg::FloatValueObject&>(value).getValue());
+                }
+                else
+                    throw UnsupportedObject{};
+            }
+
+            void writeStateSet(const osg::StateSet* stateSet)
+            {
+                if (!mWriter.writeReference(stateSet))
+                    return;
+
+                if (stateSet->getUpdateCallback() != nullptr || stateSet->getEventCallback() != nullptr
+                    || !stateSet->getDefineList().empty() || stateSet->getUserDataContainer() != nullptr)
+                    throw UnsupportedObject{};
+
+                mWriter.write(static_cast<std::int32_t>(stateSet->getRenderingHint()));
+                mWriter.write(static_cast<std::int32_t>(stateSet->getRenderBinMode()));
+                mWriter.write(static_cast<std::int32_t>(stateSet->getBinNumber()));
+                mWriter.writeString(stateSet->getBinName());
+                mWriter.write(stateSet->getNestRenderBins());
+
+                writeModes(stateSet->getModeList());
+                writeAttributes(stateSet->getAttributeList());
+
+                const osg::StateSet::TextureModeList& textureModes = stateSet->getTextureModeList();
+                mWriter.write(static_cast<std::uint32_t>(textureModes.size()));
+                for (const osg::StateSet::ModeList& modes : textureModes)
+                    writeModes(modes);
+
+                const osg::StateSet::TextureAttributeList& textureAttributes = stateSet->getTextureAttributeList();
+                mWriter.write(static_cast<std::uint32_t>(textureAttributes.size()));
+                for (const osg::StateSet::AttributeList& attributes : textureAttributes)
+                    writeAttributes(attributes);
+
+                const osg::StateSet::UniformList& uniforms = stateSet->getUniformList();
+                mWriter.write(static_cast<std::uint32_t>(uniforms.size()));
+                for (const auto& [name, uniform] : uniforms)
+                {
+                    writeUniform(dynamic_cast<const osg::Uniform*>(uniform.first.get()));
+                    mWriter.write(static_cast<std::uint32_t>(uniform.second));
+                }
+            }
+
+            void writeModes(const osg::StateSet::ModeList& modes)
+            {
+                mWriter.write(static_cast<std::uint32_t>(modes.size()));
+                for (const auto& [mode, value] : modes)
+                {
+                    mWriter.write(static_cast<std::uint32_t>(mode));
+                    mWriter.write(static_cast<std::uint32_t>(value));
+                }
+            }
+
+            void writeAttributes(const osg::StateSet::AttributeList& attributes)
+            {
+                mWriter.write(static_cast<std::uint32_t>(attributes.size()));
+                for (const auto& [type, attribute] : attributes)
+                {
+                    writeAttribute(attribute.first.get());
+                    mWriter.write(static_cast<std::uint32_t>(attribute.second));
+                }
+            }
+
+            void writeAttribute(const osg::StateAttribute* attribute)
+            {
+                if (!mWriter.writeReference(attribute))
+                    return;
+
+                if (attribute->getUpdateCallback() != nullptr || attribute->getEventCallback() != nullptr
+                    || attribute->getUserDataContainer() != nullptr)
+                    throw UnsupportedObject{};
+
+                if (isExactly<osg::Texture2D>(*attribute))
+                {
+                    const auto& texture = static_cast<const osg::Texture2D&>(*attribute);
+                    const osg::Image* const image = texture.getImage();
+                    // Images are shared through ImageManager, only ones loaded from the VFS can be referenced
+                    if (image == nullptr || image->getFileName().empty())
+                        throw UnsupportedObject{};
+                    mWriter.write(AttributeType::Texture2D);
+                    mWriter.writeString(texture.getName());
+                    mWriter.writeString(image->getFileName());
+                    mWriter.write(static_cast<std::int32_t>(texture.getTextureWidth()));
+                    mWriter.write(static_cast<std::int32_t>(texture.getTextureHeight()));
+                    for (const osg::Texture::WrapParameter wrap :
+                        { osg::Texture::WRAP_S, osg::Texture::WRAP_T, osg::Texture::WRAP_R })
+                        mWriter.write(static_cast<std::uint32_t>(texture.getWrap(wrap)));
+                    mWriter.write(static_cast<std::uint32_t>(texture.getFilter(osg::Texture::MIN_FILTER)));
+                    mWriter.write(static_cast<std::uint32_t>(texture.getFilter(osg::Texture::MAG_FILTER)));
+                    mWriter.write(texture.getMaxAnisotropy());
+                }
+                else if (isExactly<SceneUtil::TextureType>(*attribute))
+                {
+                    mWriter.write(AttributeType::TextureType);
+                    mWriter.writeString(attribute->getName());
+                }
+                else if (isExactly<osg::TexEnv>(*attribute))
+                {
+                    const auto& texEnv = static_cast<const osg::TexEnv&>(*attribute);
+                    mWriter.write(AttributeType::TexEnv);
+                    mWriter.write(static_cast<std::uint32_t>(texEnv.getMode()));
+                    writeVec(mWriter, texEnv.getColor());
+                }
+                else if (isExactly<osg::TexEnvCombine>(*attribute))
+                {
+                    const auto& texEnv = static_cast<const osg::TexEnvCombine&>(*attribute);
+                    mWriter.write(AttributeType::TexEnvCombine);
+                    for (const GLint value : { texEnv.getCombine_RGB(), texEnv.getCombine_Alpha(),
+                             texEnv.getSource0_RGB(), texEnv.getSource1_RGB(), texEnv.getSource2_RGB(),
+                             texEnv.getSource0_Alpha(), texEnv.getSource1_Alpha(), texEnv.getSource2_Alpha(),
+                             texEnv.getOperand0_RGB(), texEnv.getOperand1_RGB(), texEnv.getOperand2_RGB(),
+                             texEnv.getOperand0_Alpha(), texEnv.getOperand1_Alpha(), texEnv.getOperand2_Alpha() })
+                        mWriter.write(static_cast<std::int32_t>(value));
+                    mWriter.write(texEnv.getScale_RGB());
+                    mWriter.write(texEnv.getScale_Alpha());
+                    writeVec(mWriter, texEnv.getConstantColor());
+                }
+                else if (isExactly<osg::TexMat>(*attribute))
+                {
+                    const auto& texMat = static_cast<const osg::TexMat&>(*attribute);
+                    mWriter.write(AttributeType::TexMat);
+                    writeMatrix(mWriter, texMat.getMatrix());
+                    mWriter.write(texMat.getScaleByTextureRectangleSize());
+                }
+                else if (isExactly<osg::Material>(*attribute))
+                {
+                    const auto& material = static_cast<const osg::Material&>(*attribute);
+                    mWriter.write(AttributeType::Material);
+                    mWriter.write(static_cast<std::uint32_t>(material.getColorMode()));
+                    mWriter.write(material.getAmbientFrontAndBack());
+                    mWriter.write(material.getDiffuseFrontAndBack());
+                    mWriter.write(material.getSpecularFrontAndBack());
+                    mWriter.write(material.getEmissionFrontAndBack());
+                    mWriter.write(material.getShininessFrontAndBack());
+                    for (const osg::Material::Face face : { osg::Material::FRONT, osg::Material::BACK })
+                    {
+                        writeVec(mWriter, material.getAmbient(face));
+                        writeVec(mWriter, material.getDiffuse(face));
+                        writeVec(mWriter, material.getSpecular(face));
+                        writeVec(mWriter, material.getEmission(face));
+                        mWriter.write(material.getShininess(face));
+                    }
+                }
+                else if (isExactly<osg::AlphaFunc>(*attribute))
+                {
+                    const auto& alphaFunc = static_cast<const osg::AlphaFunc&>(*attribute);
+                    mWriter.write(AttributeType::AlphaFunc);
+                    mWriter.write(static_cast<std::uint32_t>(alphaFunc.getFunction()));
+                    mWriter.write(alphaFunc.getReferenceValue());
+                }
+                else if (isExactly<osg::BlendFunc>(*attribute))
+                {
+                    const auto& blendFunc = static_cast<const osg::BlendFunc&>(*attribute);
+                    mWriter.write(AttributeType::BlendFunc);
+                    mWriter.write(static_cast<std::uint32_t>(blendFunc.getSourceRGB()));
+                    mWriter.write(static_cast<std::uint32_t>(blendFunc.getSourceAlpha()));
+                    mWriter.write(static_cast<std::uint32_t>(blendFunc.getDestinationRGB()));
+                    mWriter.write(static_cast<std::uint32_t>(blendFunc.getDestinationAlpha()));
+                }
+                else if (isExactly<osg::Depth>(*attribute))
+                {
+                    const auto& depth = static_cast<const osg::Depth&>(*attribute);
+                    mWriter.write(AttributeType::Depth);
+                    mWriter.write(static_cast<std::uint32_t>(depth.getFunction()));
+                    mWriter.write(depth.getZNear());
+                    mWriter.write(depth.getZFar());
+                    mWriter.write(depth.getWriteMask());
+                }
+                else if (isExactly<osg::FrontFace>(*attribute))
+                {
+                    mWriter.write(AttributeType::FrontFace);
+                    mWriter.write(static_cast<std::uint32_t>(static_cast<const osg::FrontFace&>(*attribute).getMode()));
+                }
+                else if (isExactly<osg::PolygonOffset>(*attribute))
+                {
+                    const auto& polygonOffset = static_cast<const osg::PolygonOffset&>(*attribute);
+                    mWriter.write(AttributeType::PolygonOffset);
+                    mWriter.write(polygonOffset.getFactor());
+                    mWriter.write(polygonOffset.getUnits());
+                }
+                else if (isExactly<osg::PolygonMode>(*attribute))
+                {
+                    const auto& polygonMode = static_cast<const osg::PolygonMode&>(*attribute);
+                    mWriter.write(AttributeType::PolygonMode);
+                    mWriter.write(static_cast<std::uint32_t>(polygonMode.getMode(osg::PolygonMode::FRONT)));
+                    mWriter.write(static_cast<std::uint32_t>(polygonMode.getMode(osg::PolygonMode::BACK)));
+                }
+                else
+                    throw UnsupportedObject{};
+            }
+
+            void writeUniform(const osg::Uniform* uniform)
+            {
+                if (uniform == nullptr)
+                    throw UnsupportedObject{};
+                if (!mWriter.writeReference(uniform))
+                    return;
+
+                if (uniform->getUpdateCallback() != nullptr || uniform->getEventCallback() != nullptr
+                    || uniform->getUserDataContainer() != nullptr)
+                    throw UnsupportedObject{};
+
+                mWriter.writeString(uniform->getName());
+                mWriter.write(static_cast<std::int32_t>(uniform->getType()));
+                mWriter.write(static_cast<std::uint32_t>(uniform->getNumElements()));
+                if (const osg::FloatArray* const values = uniform->getFloatArray())
+                {
+                    mWriter.write(UniformDataType::Float);
+                    mWriter.write(static_cast<std::uint32_t>(values->size()));
+                    mWriter.writeBytes(values->getDataPointer(), values->getTotalDataSize());
+                }
+                else if (const osg::IntArray* const values = uniform->getIntArray())
+                {
+                    mWriter.write(UniformDataType::Int);
+                    mWriter.write(static_cast<std::uint32_t>(values->size()));
+                    mWriter.writeBytes(values->getDataPointer(), values->getTotalDataSize());
+                }
+                else
+                    throw UnsupportedObject{};
+            }
+
+            void writeGeometry(const osg::Geometry& geometry)
+            {
+                if (geometry.getDrawCallback() != nullptr || geometry.getComputeBoundingBoxCallback() != nullptr
+                    || geometry.getInitialBound().valid() || geometry.getSecondaryColorArray() != nullptr
+                    || geometry.getFogCoordArray() != nullptr || geometry.getNumVertexAttribArrays() != 0)
+                    throw UnsupportedObject{};
+
+                mWriter.write(geometry.getSupportsDisplayList());
+                mWriter.write(geometry.getUseDisplayList());
+                mWriter.write(geometry.getUseVertexBufferObjects());
+
+                writeArray(geometry.getVertexArray());
+                writeArray(geometry.getNormalArray());
+                writeArray(geometry.getColorArray());
+                mWriter.write(static_cast<std::uint32_t>(geometry.getNumTexCoordArrays()));
+                for (unsigned i = 0; i < geometry.getNumTexCoordArrays(); ++i)
+                    writeArray(geometry.getTexCoordArray(i));
+
+                mWriter.write(static_cast<std::uint32_t>(geometry.getNumPrimitiveSets()));
+                for (unsigned i = 0; i < geometry.getNumPrimitiveSets(); ++i)
+                    writePrimitiveSet(*geometry.getPrimitiveSet(i));
+            }
+
+            void writeArray(const osg::Array* array)
+            {
+                if (array == nullptr)
+                {
+                    mWriter.write(static_cast<std::int32_t>(osg::Array::ArrayType));
+                    return;
+                }
+
+                switch (array->getType())
+                {
+                    case osg::Array::Vec2ArrayType:
+                    case osg::Array::Vec3ArrayType:
+                    case osg::Array::Vec4ArrayType:
+                    case osg::Array::Vec4ubArrayType:
+                        break;
+                    default:
+                        throw UnsupportedObject{};
+                }
+
+                if (array->getUserDataContainer() != nullptr)
+                    throw UnsupportedObject{};
+
+                mWriter.write(static_cast<std::int32_t>(array->getType()));
+                mWriter.write(static_cast<std::int32_t>(array->getBinding()));
+                mWriter.write(array->getNormalize());
+                mWriter.write(static_cast<std::uint32_t>(array->getNumElements()));
+                mWriter.writeBytes(array->getDataPointer(), array->getTotalDataSize());
+            }
+
+            void writePrimitiveSet(const osg::PrimitiveSet& primitiveSet)
+            {
+                if (primitiveSet.getNumInstances() != 0 || primitiveSet.getUserDataContainer() != nullptr)
+                    throw UnsupportedObject{};
+
+                mWriter.write(static_cast<std::int32_t>(primitiveSet.getType()));
+                mWriter.write(static_cast<std::uint32_t>(primitiveSet.getMode()));
+                switch (primitiveSet.getType())
+                {
+                    case osg::PrimitiveSet::DrawArraysPrimitiveType:
+                    {
+                        const auto& drawArrays = static_cast<const osg::DrawArrays&>(primitiveSet);
+                        mWriter.write(static_cast<std::int32_t>(drawArrays.getFirst()));
+                        mWriter.write(static_cast<std::int32_t>(drawArrays.getCount()));
+                        break;
+                    }
+                    case osg::PrimitiveSet::DrawElementsUShortPrimitiveType:
+                    case osg::PrimitiveSet::DrawElementsUIntPrimitiveType:
+                        mWriter.write(static_cast<std::uint32_t>(primitiveSet.getNumIndices()));
+                        mWriter.writeBytes(primitiveSet.getDataPointer(), primitiveSet.getTotalDataSize());
+                        break;
+                    default:
+                        throw UnsupportedObject{};
+                }
+            }
+        };
+
+        class SceneReader
+        {
+        public:
+            explicit SceneReader(std::string_view data, const GetSceneImage& getImage)
+                : mReader(data)
+                , mGetImage(getImage)
+            {
+            }
+
+            osg::ref_ptr<osg::Node> readNode()
+            {
+                switch (mReader.read<NodeType>())
+                {
+                    case NodeType::Group:
+                    {
+                        osg::ref_ptr<osg::Group> group = new osg::Group;
+                        readNodeData(*group);
+                        readChildren(*group);
+                        return group;
+                    }
+                    case NodeType::NifMatrixTransform:
+                    {
+                        osg::ref_ptr<NifOsg::MatrixTransform> transform = new NifOsg::MatrixTransform;
+                        readNodeData(*transform);
+                        transform->setReferenceFrame(
+                            static_cast<osg::Transform::ReferenceFrame>(mReader.read<std::uint8_t>()));
+                        transform->setMatrix(readMatrix(mReader));
+                        transform->mScale = mReader.read<float>();
+                        mReader.readBytes(
+                            transform->mRotationScale.mValues, sizeof(transform->mRotationScale.mValues));
+                        readChildren(*transform);
+                        return transform;
+                    }
+                    case NodeType::Geometry:
+                    {
+                        osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry;
+                        readNodeData(*geometry);
+                        readGeometry(*geometry);
+                        return geometry;
+                    }
+                }
+                throw std::runtime_error("Invalid scene cache node type");
+            }
+
+            bool isEnd() const { return mReader.isEnd(); }
+
+        private:
+            Reader mReader;
+            const GetSceneImage& mGetImage;
+
+            void readNodeData(osg::Node& node)
+            {
+                node.setName(mReader.readString());
+                node.setDataVariance(static_cast<osg::Object::DataVariance>(mReader.read<std::uint8_t>()));
+                node.setNodeMask(mReader.read<std::uint32_t>());
+                node.setCullingActive(mReader.read<bool>());
+                readUserData(node);
+                node.setStateSet(readStateSet());
+            }
+
+            void readChildren(osg::Group& group)
+            {
+                const std::uint32_t count = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < count; ++i)
+                    group.addChild(readNode());
+            }
+
+            void readUserData(osg::Object& object)
+            {
+                if (!mReader.read<bool>())
+                    return;
+
+                osg::UserDataContainer* const container = object.getOrCreateUserDataContainer();
+
+                const std::uint32_t descriptionsCount = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < descriptionsCount; ++i)
+                    container->addDescription(mReader.readString());
+
+                const std::uint32_t valuesCount = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < valuesCount; ++i)
+                {
+                    const ValueType type = mReader.read<ValueType>();
+                    const std::string name = mReader.readString();
+                    switch (type)
+                    {
+                        case ValueType::String:
+                            object.setUserValue(name, mReader.readString());
+                            break;
+                        case ValueType::Bool:
+                            object.setUserValue(name, mReader.read<bool>());
+                            break;
+                        case ValueType::Int:
+                            object.setUserValue(name, static_cast<int>(mReader.read<std::int32_t>()));
+                            break;
+                        case ValueType::UInt:
+                            object.setUserValue(name, static_cast<unsigned int>(mReader.read<std::uint32_t>()));
+                            break;
+                        case ValueType::Float:
+                            object.setUserValue(name, mReader.read<float>());
+                            break;
+                        default:
+                            throw std::runtime_error("Invalid scene cache user value type");
+                    }
+                }
+            }
+
+            osg::ref_ptr<osg::StateSet> readStateSet()
+            {
+                return mReader.readReference<osg::StateSet>([&] {
+                    osg::ref_ptr<osg::StateSet> stateSet = new osg::StateSet;
+
+                    // Rendering hint overrides render bin details so has to be set first
+                    stateSet->setRenderingHint(mReader.read<std::int32_t>());
+                    const auto binMode = static_cast<osg::StateSet::RenderBinMode>(mReader.read<std::int32_t>());
+                    const std::int32_t binNumber = mReader.read<std::int32_t>();
+                    stateSet->setRenderBinDetails(binNumber, mReader.readString(), binMode);
+                    stateSet->setNestRenderBins(mReader.read<bool>());
+
+                    readModes([&](GLenum mode, unsigned value) { stateSet->setMode(mode, value); });
+                    readAttributes([&](osg::StateAttribute* attribute, unsigned value) {
+                        stateSet->setAttribute(attribute, value);
+                    });
+
+                    const std::uint32_t textureModesCount = mReader.read<std::uint32_t>();
+                    for (std::uint32_t unit = 0; unit < textureModesCount; ++unit)
+                        readModes(
+                            [&](GLenum mode, unsigned value) { stateSet->setTextureMode(unit, mode, value); });
+
+                    const std::uint32_t textureAttributesCount = mReader.read<std::uint32_t>();
+                    for (std::uint32_t unit = 0; unit < textureAttributesCount; ++unit)
+                        readAttributes([&](osg::StateAttribute* attribute, unsigned value) {
+                            stateSet->setTextureAttribute(unit, attribute, value);
+                        });
+
+                    const std::uint32_t uniformsCount = mReader.read<std::uint32_t>();
+                    for (std::uint32_t i = 0; i < uniformsCount; ++i)
+                    {
+                        osg::ref_ptr<osg::Uniform> uniform = readUniform();
+                        stateSet->addUniform(uniform, mReader.read<std::uint32_t>());
+                    }
+
+                    return stateSet;
+                });
+            }
+
+            template <class Function>
+            void readModes(Function&& function)
+            {
+                const std::uint32_t count = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    const GLenum mode = mReader.read<std::uint32_t>();
+                    function(mode, mReader.read<std::uint32_t>());
+                }
+            }
+
+            template <class Function>
+            void readAttributes(Function&& function)
+            {
+                const std::uint32_t count = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    osg::ref_ptr<osg::StateAttribute> attribute = readAttribute();
+                    function(attribute.get(), mReader.read<std::uint32_t>());
+                }
+            }
+
+            osg::ref_ptr<osg::StateAttribute> readAttribute()
+            {
+                return mReader.readReference<osg::StateAttribute>([&]() -> osg::ref_ptr<osg::StateAttribute> {
+                    switch (mReader.read<AttributeType>())
+                    {
+                        case AttributeType::Texture2D:
+                        {
+                            osg::ref_ptr<osg::Texture2D> texture = new osg::Texture2D;
+                            texture->setName(mReader.readString());
+                            texture->setImage(mGetImage(VFS::Path::toNormalized(mReader.readString())));
+                            const std::int32_t width = mReader.read<std::int32_t>();
+                            texture->setTextureSize(width, mReader.read<std::int32_t>());
+                            for (const osg::Texture::WrapParameter wrap :
+                                { osg::Texture::WRAP_S, osg::Texture::WRAP_T, osg::Texture::WRAP_R })
+                                texture->setWrap(
+                                    wrap, static_cast<osg::Texture::WrapMode>(mReader.read<std::uint32_t>()));
+                            texture->setFilter(osg::Texture::MIN_FILTER,
+                                static_cast<osg::Texture::FilterMode>(mReader.read<std::uint32_t>()));
+                            texture->setFilter(osg::Texture::MAG_FILTER,
+                                static_cast<osg::Texture::FilterMode>(mReader.read<std::uint32_t>()));
+                            texture->setMaxAnisotropy(mReader.read<float>());
+                            return texture;
+                        }
+                        case AttributeType::TextureType:
+                            return new SceneUtil::TextureType(mReader.readString());
+                        case AttributeType::TexEnv:
+                        {
+                            osg::ref_ptr<osg::TexEnv> texEnv = new osg::TexEnv;
+                            texEnv->setMode(static_cast<osg::TexEnv::Mode>(mReader.read<std::uint32_t>()));
+                            texEnv->setColor(readVec<osg::Vec4f>(mReader));
+                            return texEnv;
+                        }
+                        case AttributeType::TexEnvCombine:
+                            return readTexEnvCombine();
+                        case AttributeType::TexMat:
+                        {
+                            osg::ref_ptr<osg::TexMat> texMat = new osg::TexMat(readMatrix(mReader));
+                            texMat->setScaleByTextureRectangleSize(mReader.read<bool>());
+                            return texMat;
+                        }
+                        case AttributeType::Material:
+                            return readMaterial();
+                        case AttributeType::AlphaFunc:
+                        {
+                            const auto function
+                                = static_cast<osg::AlphaFunc::ComparisonFunction>(mReader.read<std::uint32_t>());
+                            return new osg::AlphaFunc(function, mReader.read<float>());
+                        }
+                        case AttributeType::BlendFunc:
+                        {
+                            const GLenum sourceRgb = mReader.read<std::uint32_t>();
+                            const GLenum sourceAlpha = mReader.read<std::uint32_t>();
+                            const GLenum destinationRgb = mReader.read<std::uint32_t>();
+                            const GLenum destinationAlpha = mReader.read<std::uint32_t>();
+                            return new osg::BlendFunc(sourceRgb, destinationRgb, sourceAlpha, destinationAlpha);
+                        }
+                        case AttributeType::Depth:
+                        {
+                            osg::ref_ptr<osg::Depth> depth = new osg::Depth;
+                            depth->setFunction(static_cast<osg::Depth::Function>(mReader.read<std::uint32_t>()));
+                            const double zNear = mReader.read<double>();
+                            depth->setRange(zNear, mReader.read<double>());
+                            depth->setWriteMask(mReader.read<bool>());
+                            return depth;
+                        }
+                        case AttributeType::FrontFace:
+                            return new osg::FrontFace(static_cast<osg::FrontFace::Mode>(mReader.read<std::uint32_t>()));
+                        case AttributeType::PolygonOffset:
+                        {
+                            const float factor = mReader.read<float>();
+                            return new osg::PolygonOffset(factor, mReader.read<float>());
+                        }
+                        case AttributeType::PolygonMode:
+                        {
+                            osg::ref_ptr<osg::PolygonMode> polygonMode = new osg::PolygonMode;
+                            polygonMode->setMode(osg::PolygonMode::FRONT,
+                                static_cast<osg::PolygonMode::Mode>(mReader.read<std::uint32_t>()));
+                            polygonMode->setMode(osg::PolygonMode::BACK,
+                                static_cast<osg::PolygonMode::Mode>(mReader.read<std::uint32_t>()));
+                            return polygonMode;
+                        }
+                    }
+                    throw std::runtime_error("Invalid scene cache state attribute type");
+                });
+            }
+
+            osg::ref_ptr<osg::Material> readMaterial()
+            {
+                osg::ref_ptr<osg::Material> material = new osg::Material;
+                material->setColorMode(static_cast<osg::Material::ColorMode>(mReader.read<std::uint32_t>()));
+                const bool ambientFrontAndBack = mReader.read<bool>();
+                const bool diffuseFrontAndBack = mReader.read<bool>();
+                const bool specularFrontAndBack = mReader.read<bool>();
+                const bool emissionFrontAndBack = mReader.read<bool>();
+                const bool shininessFrontAndBack = mReader.read<bool>();
+                // Setting a single face resets the front and back flag, so values shared by both faces are set once
+                for (const osg::Material::Face face : { osg::Material::FRONT, osg::Material::BACK })
+                {
+                    const osg::Vec4f ambient = readVec<osg::Vec4f>(mReader);
+                    const osg::Vec4f diffuse = readVec<osg::Vec4f>(mReader);
+                    const osg::Vec4f specular = readVec<osg::Vec4f>(mReader);
+                    const osg::Vec4f emission = readVec<osg::Vec4f>(mReader);
+                    const float shininess = mReader.read<float>();
+                    const auto apply = [&](bool frontAndBack, auto&& set) {
+                        if (!frontAndBack)
+                            set(face);
+                        else if (face == osg::Material::FRONT)
+                            set(osg::Material::FRONT_AND_BACK);
+                    };
+                    apply(ambientFrontAndBack, [&](osg::Material::Face f) { material->setAmbient(f, ambient); });
+                    apply(diffuseFrontAndBack, [&](osg::Material::Face f) { material->setDiffuse(f, diffuse); });
+                    apply(specularFrontAndBack, [&](osg::Material::Face f) { material->setSpecular(f, specular); });
+                    apply(emissionFrontAndBack, [&](osg::Material::Face f) { material->setEmission(f, emission); });
+                    apply(shininessFrontAndBack, [&](osg::Material::Face f) { material->setShininess(f, shininess); });
+                }
+                return material;
+            }
+
+            osg::ref_ptr<osg::TexEnvCombine> readTexEnvCombine()
+            {
+                osg::ref_ptr<osg::TexEnvCombine> texEnv = new osg::TexEnvCombine;
+                const auto read = [&] { return static_cast<GLint>(mReader.read<std::int32_t>()); };
+                texEnv->setCombine_RGB(read());
+                texEnv->setCombine_Alpha(read());
+                texEnv->setSource0_RGB(read());
+                texEnv->setSource1_RGB(read());
+                texEnv->setSource2_RGB(read());
+                texEnv->setSource0_Alpha(read());
+                texEnv->setSource1_Alpha(read());
+                texEnv->setSource2_Alpha(read());
+                texEnv->setOperand0_RGB(read());
+                texEnv->setOperand1_RGB(read());
+                texEnv->setOperand2_RGB(read());
+                texEnv->setOperand0_Alpha(read());
+                texEnv->setOperand1_Alpha(read());
+                texEnv->setOperand2_Alpha(read());
+                texEnv->setScale_RGB(mReader.read<float>());
+                texEnv->setScale_Alpha(mReader.read<float>());
+                texEnv->setConstantColor(readVec<osg::Vec4f>(mReader));
+                return texEnv;
+            }
+
+            osg::ref_ptr<osg::Uniform> readUniform()
+            {
+                return mReader.readReference<osg::Uniform>([&] {
+                    const std::string name = mReader.readString();
+                    const auto type = static_cast<osg::Uniform::Type>(mReader.read<std::int32_t>());
+                    const std::uint32_t numElements = mReader.read<std::uint32_t>();
+                    osg::ref_ptr<osg::Uniform> uniform = new osg::Uniform(type, name, static_cast<int>(numElements));
+                    const UniformDataType dataType = mReader.read<UniformDataType>();
+                    const std::uint32_t size = mReader.read<std::uint32_t>();
+                    if (dataType == UniformDataType::Float && uniform->getFloatArray() != nullptr
+                        && uniform->getFloatArray()->size() == size)
+                        mReader.readBytes(uniform->getFloatArray()->asVector().data(), size * sizeof(GLfloat));
+                    else if (dataType == UniformDataType::Int && uniform->getIntArray() != nullptr
+                        && uniform->getIntArray()->size() == size)
+                        mReader.readBytes(uniform->getIntArray()->asVector().data(), size * sizeof(GLint));
+                    else
+                        throw std::runtime_error("Invalid scene cache uniform data");
+                    uniform->dirty();
+                    return uniform;
+                });
+            }
+
+            void readGeometry(osg::Geometry& geometry)
+            {
+                geometry.setSupportsDisplayList(mReader.read<bool>());
+                geometry.setUseDisplayList(mReader.read<bool>());
+                geometry.setUseVertexBufferObjects(mReader.read<bool>());
+
+                geometry.setVertexArray(readArray());
+                geometry.setNormalArray(readArray());
+                geometry.setColorArray(readArray());
+                const std::uint32_t texCoordArraysCount = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < texCoordArraysCount; ++i)
+                    geometry.setTexCoordArray(i, readArray());
+
+                const std::uint32_t primitiveSetsCount = mReader.read<std::uint32_t>();
+                for (std::uint32_t i = 0; i < primitiveSetsCount; ++i)
+                    geometry.addPrimitiveSet(readPrimitiveSet());
+            }
+
+            template <class T>
+            osg::ref_ptr<osg::Array> readArrayData()
+            {
+                const auto binding = static_cast<osg::Array::Binding>(mReader.read<std::int32_t>());
+                const bool normalize = mReader.read<bool>();
+                const std::uint32_t count = mReader.read<std::uint32_t>();
+                osg::ref_ptr<T> array = new T(count);
+                if (count > 0)
+                    mReader.readBytes(array->asVector().data(), count * sizeof(typename T::ElementDataType));
+                array->setBinding(binding);
+                array->setNormalize(normalize);
+                return array;
+            }
+
+            osg::ref_ptr<osg::Array> readArray()
+            {
+                switch (static_cast<osg::Array::Type>(mReader.read<std::int32_t>()))
+                {
+                    case osg::Array::ArrayType:
+                        return nullptr;
+                    case osg::Array::Vec2ArrayType:
+                        return readArrayData<osg::Vec2Array>();
+                    case osg::Array::Vec3ArrayType:
+                        return readArrayData<osg::Vec3Array>();
+                    case osg::Array::Vec4ArrayType:
+                        return readArrayData<osg::Vec4Array>();
+                    case osg::Array::Vec4ubArrayType:
+                        return readArrayData<osg::Vec4ubArray>();
+                    default:
+                        break;
+                }
+                throw std::runtime_error("Invalid scene cache array type");
+            }
+
+            template <class T>
+            osg::ref_ptr<osg::PrimitiveSet> readDrawElements(GLenum mode)
+            {
+                const std::uint32_t count = mReader.read<std::uint32_t>();
+                osg::ref_ptr<T> drawElements = new T(mode, count);
+                if (count > 0)
+                    mReader.readBytes(drawElements->asVector().data(), count * sizeof(typename T::value_type));
+                return drawElements;
+            }
+
+            osg::ref_ptr<osg::PrimitiveSet> readPrimitiveSet()
+            {
+                const auto type = static_cast<osg::PrimitiveSet::Type>(mReader.read<std::int32_t>());
+                const GLenum mode = mReader.read<std::uint32_t>();
+                switch (type)
+                {
+                    case osg::PrimitiveSet::DrawArraysPrimitiveType:
+                    {
+                        const std::int32_t first = mReader.read<std::int32_t>();
+                        return new osg::DrawArrays(mode, first, mReader.read<std::int32_t>());
+                    }
+                    case osg::PrimitiveSet::DrawElementsUShortPrimitiveType:
+                        return readDrawElements<osg::DrawElementsUShort>(mode);
+                    case osg::PrimitiveSet::DrawElementsUIntPrimitiveType:
+                        return readDrawElements<osg::DrawElementsUInt>(mode);
+                    default:
+                        break;
+                }
+                throw std::runtime_error("Invalid scene cache primitive set type");
+            }
+        };
+
+        struct Header
+        {
+            std::uint32_t mFormatVersion;
+            std::uint64_t mSessionKey;
+            SceneDiskCacheKey mKey;
+            std::string mPath;
+        };
+
+        void writeHeader(Writer& writer, const Header& header)
+        {
+            writer.writeBytes(fileMagic.data(), fileMagic.size());
+            writer.write(header.mFormatVersion);
+            writer.write(header.mSessionKey);
+            writer.write(header.mKey.mFileHash[0]);
+            writer.write(header.mKey.mFileHash[1]);
+            writer.write(header.mKey.mSettings);
+            writer.writeString(header.mPath);
+        }
+
+        std::optional<Header> readHeader(Reader& reader)
+        {
+            std::string magic(fileMagic.size(), '\0');
+            reader.readBytes(magic.data(), magic.size());
+            if (magic != fileMagic)
+                return std::nullopt;
+            Header result;
+            result.mFormatVersion = reader.read<std::uint32_t>();
+            if (result.mFormatVersion != formatVersion)
+                return std::nullopt;
+            result.mSessionKey = reader.read<std::uint64_t>();
+            result.mKey.mFileHash[0] = reader.read<std::uint64_t>();
+            result.mKey.mFileHash[1] = reader.read<std::uint64_t>();
+            result.mKey.mSettings = reader.read<std::uint64_t>();
+            result.mPath = reader.readString();
+            return result;
+        }
+
+        std::size_t getHeaderSize(const Header& header)
+        {
+            return fileMagic.size() + sizeof(header.mFormatVersion) + sizeof(header.mSessionKey)
+                + sizeof(header.mKey.mFileHash) + sizeof(header.mKey.mSettings) + sizeof(std::uint32_t)
+                + header.mPath.size();
+        }
+    }
+
+    bool serializeScene(const osg::Node& node, std::string& out)
+    {
+        // Bulk data is stored in the native layout
+        if constexpr (!Misc::IS_LITTLE_ENDIAN)
+            return false;
+
+        const std::size_t initialSize = out.size();
+        try
+        {
+            SceneWriter(out).writeNode(node);
+            return true;
+        }
+        catch (const UnsupportedObject&)
+        {
+            out.resize(initialSize);
+            return false;
+        }
+    }
+
+    osg::ref_ptr<osg::Node> deserializeScene(std::string_view data, const GetSceneImage& getImage)
+    {
+        if constexpr (!Misc::IS_LITTLE_ENDIAN)
+            throw std::runtime_error("Scene cache is not supported on big-endian platforms");
+
+        SceneReader reader(data, getImage);
+        osg::ref_ptr<osg::Node> result = reader.readNode();
+        if (!reader.isEnd())
+            throw std::runtime_error("Unexpected data after the end of the scene");
+        return result;
+    }
+
+    std::uint64_t makeSceneDiskCacheKey(const VFS::Manager& vfs)
+    {
+        std::array<std::uint64_t, 2> hash{ 0, 0 };
+        // Format version is not changed for every change of the NIF loader, so scenes of other builds are not used
+        for (const std::string_view value : { Version::getVersion(), Version::getCommitHash() })
+        {
+            std::array<std::uint64_t, 2> valueHash{ 0, 0 };
+            MurmurHash3_x64_128(value.data(), static_cast<int>(value.size()), hash.data(), valueHash.data());
+            hash = valueHash;
+        }
+        for (const VFS::Path::Normalized& path : vfs.getRecursiveDirectoryIterator())
+        {
+            std::array<std::uint64_t, 2> pathHash{ 0, 0 };
+            MurmurHash3_x64_128(path.value().data(), static_cast<int>(path.value().size()), hash.data(),
+                pathHash.data());
+            hash = pathHash;
+        }
+        return hash[0] ^ hash[1];
+    }
+
+    SceneDiskCache::SceneDiskCache(const std::filesystem::path& directory, std::uint64_t sessionKey)
+        : mDirectory(directory)
+        , mSessionKey(sessionKey)
+    {
+        std::filesystem::create_directories(mDirectory);
+    }
+
+    osg::ref_ptr<osg::Node> SceneDiskCache::read(
+        VFS::Path::NormalizedView path, const SceneDiskCacheKey& key, const GetSceneImage& getImage) const
+    {
+        const std::filesystem::path filePath = getFilePath(path);
+        try
+        {
+            const std::optional<std::string> data = Files::readFileContent(filePath);
+            if (!data.has_value())
+                return nullptr;
+
+            Reader reader(*data);
+            const std::optional<Header> header = readHeader(reader);
+            if (!header.has_value() || header->mSessionKey != mSessionKey
+                || header->mKey.mFileHash != key.mFileHash || header->mKey.mSettings != key.mSettings
+                || header->mPath != path.value())
+                return nullptr;
+
+            return deserializeScene(std::string_view(*data).substr(getHeaderSize(*header)), getImage);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read scene cache " << filePath << " for " << path << ": " << e.what();
+            return nullptr;
+        }
+    }
+
+    void SceneDiskCache::write(
+        VFS::Path::NormalizedView path, const SceneDiskCacheKey& key, const osg::Node& node) const
+    {
+        const Header header{
+            .mFormatVersion = formatVersion,
+            .mSessionKey = mSessionKey,
+            .mKey = key,
+            .mPath = std::string(path.value()),
+        };
+        std::string data;
+        Writer writer(data);
+        writeHeader(writer, header);
+        if (!serializeScene(node, data))
+            return;
+
+        const std::filesystem::path filePath = getFilePath(path);
+        try
+        {
+            Files::writeFileAtomically(filePath, data);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to write scene cache " << filePath << " for " << path << ": " << e.what();
+        }
+    }
+
+    std::filesystem::path SceneDiskCache::getFilePath(VFS::Path::NormalizedView path) const
+    {
+        const std::array<std::uint64_t, 2> seed{ 0, 0 };
+        std::array<std::uint64_t, 2> hash{ 0, 0 };
+        MurmurHash3_x64_128(path.value().data(), static_cast<int>(path.value().size()), seed.data(), hash.data());
+        return mDirectory
+            / Misc::StringUtils::format("%016llx%016llx.scene", static_cast<unsigned long long>(hash[0]),
+                static_cast<unsigned long long>(hash[1]));
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_SCENEDISKCACHE_H
+#define OPENMW_COMPONENTS_RESOURCE_SCENEDISKCACHE_H
+
+#include <components/vfs/pathutil.hpp>
+
+#include <osg/ref_ptr>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace osg
+{
+    class Image;
+    class Node;
+}
+
+namespace VFS
+{
+    class Manager;
+}
+
+namespace Resource
+{
+    using GetSceneImage = std::function<osg::ref_ptr<osg::Image>(VFS::Path::NormalizedView path)>;
+
+    /// Serializes a converted scene template. Returns false if the scene has objects not supported by the format. Only
+    /// groups, NIF transforms and geometry with plain state and without callbacks are supported.
+    bool serializeScene(const osg::Node& node, std::string& out);
+
+    /// Restores the scene written by serializeScene. Images are referenced by the VFS path and loaded using getImage.
+    /// Throws on corrupted data.
+    osg::ref_ptr<osg::Node> deserializeScene(std::string_view data, const GetSceneImage& getImage);
+
+    /// Combines everything except the file content that affects the converted scene and is fixed for the game session:
+    /// the build version and the set of files in the VFS (texture paths are resolved depending on which files exist).
+    std::uint64_t makeSceneDiskCacheKey(const VFS::Manager& vfs);
+
+    struct SceneDiskCacheKey
+    {
+        std::array<std::uint64_t, 2> mFileHash;
+        // Loader settings changing the converted scene, may be changed at runtime
+        std::uint64_t mSettings;
+    };
+
+    /// @brief Stores converted scene templates in the directory, one file per VFS path. Entry is used only if it was
+    /// written with the same format version, session key and SceneDiskCacheKey.
+    /// @note May be used from any thread.
+    class SceneDiskCache
+    {
+    public:
+        explicit SceneDiskCache(const std::filesystem::path& directory, std::uint64_t sessionKey);
+
+        /// Returns nullptr if there is no valid entry
+        osg::ref_ptr<osg::Node> read(
+            VFS::Path::NormalizedView path, const SceneDiskCacheKey& key, const GetSceneImage& getImage) const;
+
+        /// Does nothing if the scene is not supported by the format
+        void write(VFS::Path::NormalizedView path, const SceneDiskCacheKey& key, const osg::Node& node) const;
+
+    private:
+        std::filesystem::path mDirectory;
+        std::uint64_t mSessionKey;
+
+        std::filesystem::path getFilePath(VFS::Path::NormalizedView path) const;
+    };
+}
+
+#endif
@@ -30,6 +30,7 @@
 #include <components/nif/niffile.hpp>
 
 #include <components/misc/algorithm.hpp>
+#include <components/misc/hash.hpp>
 #include <components/misc/osguservalues.hpp>
 #include <components/misc/pathhelpers.hpp>
 #include <components/misc/strings/algorithm.hpp>
@@ -60,6 +61,7 @@
 #include "imagemanager.hpp"
 #include "niffilemanager.hpp"
 #include "objectcache.hpp"
+#include "scenediskcache.hpp"
 
 namespace
 {
@@ -597,6 +599,11 @@ namespace Resource
         mShaderManager->setShaderPath(path);
     }
 
+    void SceneManager::setDiskCache(std::unique_ptr<SceneDiskCache>&& diskCache)
+    {
+        mDiskCache = std::move(diskCache);
+    }
+
     bool SceneManager::checkLoaded(const std::string& name, double timeStamp)
     {
         return mCache->checkInObjectCache(VFS::Path::normalizeFilename(name), timeStamp);
@@ -979,6 +986,25 @@ namespace Resource
         return static_cast<osg::Node*>(mErrorMarker->clone(osg::CopyOp::DEEP_COPY_ALL));
     }
 
+    osg::ref_ptr<osg::Node> SceneManager::loadTemplate(VFS::Path::NormalizedView path)
+    {
+        if (mDiskCache == nullptr || Misc::getFileExtension(path.value()) != "nif")
+            return load(path, mVFS, mImageManager, mNifFileManager, mBgsmFileManager);
+
+        SceneDiskCacheKey key{ .mFileHash = Files::getHash(path.value(), *mVFS->get(path)), .mSettings = 0 };
+        Misc::hashCombine(key.mSettings, NifOsg::Loader::getShowMarkers());
+        Misc::hashCombine(key.mSettings, NifOsg::Loader::getHiddenNodeMask());
+        Misc::hashCombine(key.mSettings, NifOsg::Loader::getIntersectionDisabledNodeMask());
+
+        const auto getImage = [&](VFS::Path::NormalizedView imagePath) { return mImageManager->getImage(imagePath); };
+        if (osg::ref_ptr<osg::Node> cached = mDiskCache->read(path, key, getImage))
+            return cached;
+
+        osg::ref_ptr<osg::Node> loaded = load(path, mVFS, mImageManager, mNifFileManager, mBgsmFileManager);
+        mDiskCache->write(path, key, *loaded);
+        return loaded;
+    }
+
     osg::ref_ptr<const osg::Node> SceneManager::getTemplate(VFS::Path::NormalizedView path, bool compile)
     {
         osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(path);
@@ -989,7 +1015,7 @@ namespace Resource
             osg::ref_ptr<osg::Node> loaded;
             try
             {
-                loaded = load(path, mVFS, mImageManager, mNifFileManager, mBgsmFileManager);
+                loaded = loadTemplate(path);
 
                 SceneUtil::ProcessExtraDataVisitor extraDataVisitor(this);
                 loaded->accept(extraDataVisitor);
@@ -32,6 +32,7 @@ namespace Resource
 {
     class ImageManager;
     class NifFileManager;
+    class SceneDiskCache;
     class BgsmFileManager;
     class SharedStateManager;
 }
@@ -232,10 +233,15 @@ namespace Resource
 
         void setWeatherParticleOcclusion(bool value) { mWeatherParticleOcclusion = value; }
 
+        /// Store converted NIF files in the disk cache and use them instead of converting again. Should be called
+        /// before any scene is loaded.
+        void setDiskCache(std::unique_ptr<SceneDiskCache>&& diskCache);
+
     private:
         osg::ref_ptr<Shader::ShaderVisitor> createShaderVisitor(const std::string& shaderPrefix = "objects");
         osg::ref_ptr<osg::Node> loadErrorMarker();
         osg::ref_ptr<osg::Node> cloneErrorMarker();
+        osg::ref_ptr<osg::Node> loadTemplate(VFS::Path::NormalizedView path);
 
         std::unique_ptr<Shader::ShaderManager> mShaderManager;
         bool mForceShaders;
@@ -272,6 +278,8 @@ namespace Resource
         unsigned int mParticleSystemMask;
         mutable osg::ref_ptr<osg::Node> mErrorMarker;
 
+        std::unique_ptr<SceneDiskCache> mDiskCache;
+
         SceneManager(const SceneManager&);
         void operator=(const SceneManager&);
     };
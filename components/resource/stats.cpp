@@ -58,6 +58,9 @@ namespace Resource
                 "Compiling",
                 "WorkQueue",
                 "WorkThread",
+                "WorkQueue Latency",
+                "WorkQueue MaxLatency",
+                "WorkQueue Cancelled",
                 "UnrefQueue",
                 "",
                 "Texture",
@@ -73,9 +76,6 @@ namespace Resource
                 "Physics HeightFields",
                 "",
                 "Lua UsedMemory",
-                "",
-                "",
-                "",
             };
 
             static_assert(std::size(firstPage) == itemsPerPage);
@@ -102,6 +102,8 @@ namespace Resource
                 "CellPreloader Evicted",
                 "CellPreloader Loaded",
                 "CellPreloader Expired",
+                "CellPreloader Cancelled",
+                "CellPreloader Latency",
             };
 
             constexpr std::string_view navMesh[] = {
@@ -124,6 +126,12 @@ namespace Resource
                 "NavMesh Recast Objects",
                 "NavMesh Recast Heightfields",
                 "NavMesh Recast Water",
+                "NavMesh PathFinder Queued",
+                "NavMesh PathFinder Processing",
+                "NavMesh PathFinder Done",
+                "NavMesh PathFinder Cancelled",
+                "NavMesh PathFinder Latency",
+                "NavMesh PathFinder MaxLatency",
             };
 
             std::vector<std::string> statNames;
@@ -134,8 +142,11 @@ namespace Resource
             for (std::size_t i = 0; i < std::size(caches); ++i)
             {
                 Resource::addCacheStatsAttibutes(caches[i], statNames);
-                if ((i + 1) % 5 != 0)
+                if ((i + 1) % 3 != 0)
                     statNames.emplace_back();
+                else
+                    while (statNames.size() % itemsPerPage != 0)
+                        statNames.emplace_back();
             }
 
             for (std::string_view name : cellPreloader)
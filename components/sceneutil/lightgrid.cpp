@@ -0,0 +1,111 @@
+#include "lightgrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace SceneUtil
+{
+    namespace
+    {
+        // More clusters make each of them hold less lights but make the grid more expensive to build
+        constexpr float clustersPerLight = 2;
+
+        // Clusters much smaller than lights make each light to be stored in too many of them
+        constexpr float minClusterSizeToRadius = 1;
+
+        constexpr int maxClustersPerAxis = 32;
+
+        // Checking all lights of a single cluster is faster than looking up clusters when there are only a few lights
+        constexpr std::size_t minLightsForClusters = 32;
+
+        int toCell(float value, int size, int fallback)
+        {
+            if (std::isnan(value))
+                return fallback;
+            return static_cast<int>(std::clamp(std::floor(value), 0.0f, static_cast<float>(size - 1)));
+        }
+    }
+
+    void LightGrid::build(std::span<const osg::BoundingSphere> bounds)
+    {
+        mBox.init();
+        mLights.clear();
+        mCellOffsets.clear();
+        mCellLights.clear();
+        mSize = { 0, 0, 0 };
+
+        float radiusSum = 0;
+        for (std::size_t i = 0; i < bounds.size(); ++i)
+        {
+            if (!bounds[i].valid())
+                continue;
+            mLights.push_back(static_cast<std::uint32_t>(i));
+            mBox.expandBy(bounds[i]);
+            radiusSum += bounds[i].radius();
+        }
+
+        if (mLights.empty())
+            return;
+
+        const osg::Vec3f extents = mBox._max - mBox._min;
+        const float volume = std::max(extents.x(), 1.0f) * std::max(extents.y(), 1.0f) * std::max(extents.z(), 1.0f);
+        const float clusterSize
+            = std::max(std::cbrt(volume / (static_cast<float>(mLights.size()) * clustersPerLight)),
+                radiusSum / static_cast<float>(mLights.size()) * minClusterSizeToRadius);
+        const bool useClusters = mLights.size() >= minLightsForClusters;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float size = useClusters ? std::ceil(extents[axis] / clusterSize) : 1.0f;
+            mSize[axis] = std::isnan(size) ? 1 : static_cast<int>(std::clamp(size, 1.0f, float{ maxClustersPerAxis }));
+            mInvCellSize[axis] = extents[axis] > 0 ? static_cast<float>(mSize[axis]) / extents[axis] : 0.0f;
+        }
+
+        mCandidates.assign((bounds.size() + 63) / 64, 0);
+
+        // Counting sort of lights by clusters keeps lights of each cluster in the ascending order
+        mCellOffsets.resize(static_cast<std::size_t>(mSize[0]) * mSize[1] * mSize[2] + 1, 0);
+        std::vector<CellRange> ranges(bounds.size());
+        for (const std::uint32_t index : mLights)
+        {
+            CellRange& range = ranges[index];
+            getCellRange(bounds[index], range);
+            for (int z = range.mBegin[2]; z < range.mEnd[2]; ++z)
+                for (int y = range.mBegin[1]; y < range.mEnd[1]; ++y)
+                    for (int x = range.mBegin[0]; x < range.mEnd[0]; ++x)
+                        ++mCellOffsets[getCellIndex(x, y, z) + 1];
+        }
+
+        std::partial_sum(mCellOffsets.begin(), mCellOffsets.end(), mCellOffsets.begin());
+        mCellLights.resize(mCellOffsets.back());
+
+        std::vector<std::uint32_t> positions(mCellOffsets.begin(), mCellOffsets.end() - 1);
+        for (const std::uint32_t index : mLights)
+        {
+            const CellRange& range = ranges[index];
+            for (int z = range.mBegin[2]; z < range.mEnd[2]; ++z)
+                for (int y = range.mBegin[1]; y < range.mEnd[1]; ++y)
+                    for (int x = range.mBegin[0]; x < range.mEnd[0]; ++x)
+                        mCellLights[positions[getCellIndex(x, y, z)]++] = index;
+        }
+    }
+
+    bool LightGrid::getCellRange(const osg::BoundingSphere& bound, CellRange& range) const
+    {
+        const osg::Vec3f center(bound.center());
+        const float radius = bound.radius();
+        const osg::Vec3f min = center - osg::Vec3f(radius, radius, radius);
+        const osg::Vec3f max = center + osg::Vec3f(radius, radius, radius);
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (max[axis] < mBox._min[axis] || min[axis] > mBox._max[axis])
+                return false;
+            range.mBegin[axis] = toCell((min[axis] - mBox._min[axis]) * mInvCellSize[axis], mSize[axis], 0);
+            range.mEnd[axis]
+                = toCell((max[axis] - mBox._min[axis]) * mInvCellSize[axis], mSize[axis], mSize[axis] - 1) + 1;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_LIGHTGRID_H
+#define OPENMW_COMPONENTS_SCENEUTIL_LIGHTGRID_H
+
+#include <osg/BoundingBox>
+#include <osg/BoundingSphere>
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace SceneUtil
+{
+    /// \class LightGrid
+    /// Uniform grid of clusters over the view space bounding box of the lights visible by a camera. Each cluster keeps
+    /// indices of the lights with bounds overlapping it, so the lights affecting a node are found by looking up the
+    /// clusters overlapped by the node bound instead of checking all lights.
+    /// Built once per camera per frame by LightManager.
+    /// @note Not thread safe, queries use a shared buffer.
+    class LightGrid
+    {
+    public:
+        /// Replaces content by the given light bounds. Lights with invalid bounds are never returned.
+        void build(std::span<const osg::BoundingSphere> bounds);
+
+        /// Calls function once with the index of each light from the clusters overlapping the bound in ascending
+        /// order. It's a broad phase, the caller is responsible to check exact intersection.
+        template <class Function>
+        void forEachCandidate(const osg::BoundingSphere& bound, Function&& function) const
+        {
+            if (!bound.valid() || mLights.empty())
+                return;
+
+            // Few lights are stored in a single cluster which always overlaps the bound when the exact check passes
+            if (getCellCount() == 1)
+                return forEachLight(function);
+
+            CellRange range;
+            if (!getCellRange(bound, range))
+                return;
+
+            // Looking into each cluster is pointless when the bound covers more clusters than there are lights
+            if (range.getCount() >= mLights.size())
+                return forEachLight(function);
+
+            // Lights overlapping multiple clusters are merged by a bit set which also sorts them
+            std::size_t firstWord = mCandidates.size();
+            std::size_t lastWord = 0;
+            for (int z = range.mBegin[2]; z < range.mEnd[2]; ++z)
+                for (int y = range.mBegin[1]; y < range.mEnd[1]; ++y)
+                {
+                    const std::size_t row = getCellIndex(0, y, z);
+                    const std::uint32_t* it = mCellLights.data() + mCellOffsets[row + range.mBegin[0]];
+                    const std::uint32_t* const end = mCellLights.data() + mCellOffsets[row + range.mEnd[0]];
+                    for (; it != end; ++it)
+                    {
+                        const std::size_t word = *it / 64;
+                        mCandidates[word] |= std::uint64_t{ 1 } << (*it % 64);
+                        firstWord = std::min(firstWord, word);
+                        lastWord = std::max(lastWord, word);
+                    }
+                }
+
+            for (std::size_t word = firstWord; word <= lastWord && word < mCandidates.size(); ++word)
+            {
+                for (std::uint64_t bits = mCandidates[word]; bits != 0; bits &= bits - 1)
+                    function(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+                mCandidates[word] = 0;
+            }
+        }
+
+        std::size_t getCellCount() const { return mCellOffsets.empty() ? 0 : mCellOffsets.size() - 1; }
+
+    private:
+        struct CellRange
+        {
+            std::array<int, 3> mBegin;
+            std::array<int, 3> mEnd;
+
+            std::size_t getCount() const
+            {
+                return static_cast<std::size_t>(mEnd[0] - mBegin[0]) * static_cast<std::size_t>(mEnd[1] - mBegin[1])
+                    * static_cast<std::size_t>(mEnd[2] - mBegin[2]);
+            }
+        };
+
+        osg::BoundingBox mBox;
+        osg::Vec3f mInvCellSize;
+        std::array<int, 3> mSize{ 0, 0, 0 };
+        // Indices of the lights with valid bounds
+        std::vector<std::uint32_t> mLights;
+        // Lights of the cell i are mCellLights[mCellOffsets[i]] .. mCellLights[mCellOffsets[i + 1]]. Cells of the
+        // same row are adjacent, so a row of cells is a single range.
+        std::vector<std::uint32_t> mCellOffsets;
+        std::vector<std::uint32_t> mCellLights;
+        // Bit per light, all bits are cleared after each query
+        mutable std::vector<std::uint64_t> mCandidates;
+
+        std::size_t getCellIndex(int x, int y, int z) const
+        {
+            return (static_cast<std::size_t>(z) * static_cast<std::size_t>(mSize[1]) + static_cast<std::size_t>(y))
+                * static_cast<std::size_t>(mSize[0])
+                + static_cast<std::size_t>(x);
+        }
+
+        template <class Function>
+        void forEachLight(Function&& function) const
+        {
+            for (const std::uint32_t index : mLights)
+                function(static_cast<std::size_t>(index));
+        }
+
+        /// Returns false if the bound doesn't overlap the grid
+        bool getCellRange(const osg::BoundingSphere& bound, CellRange& range) const;
+    };
+}
+
+#endif
@@ -1119,7 +1119,7 @@ namespace SceneUtil
         return stateset;
     }
 
-    const std::vector<LightManager::LightSourceViewBound>& LightManager::getLightsInViewSpace(
+    const LightManager::LightsInViewSpace& LightManager::getLightsInViewSpace(
         osgUtil::CullVisitor* cv, const osg::RefMatrix* viewMatrix, size_t frameNum)
     {
         osg::Camera* camera = cv->getCurrentCamera();
@@ -1129,7 +1129,8 @@ namespace SceneUtil
 
         if (it == mLightsInViewSpace.end())
         {
-            it = mLightsInViewSpace.insert(std::make_pair(camPtr, LightSourceViewBoundCollection())).first;
+            it = mLightsInViewSpace.insert(std::make_pair(camPtr, LightsInViewSpace())).first;
+            std::vector<LightSourceViewBound>& bounds = it->second.mBounds;
 
             for (const auto& transform : mLights)
             {
@@ -1157,12 +1158,12 @@ namespace SceneUtil
                 LightSourceViewBound l;
                 l.mLightSource = transform.mLightSource;
                 l.mViewBound = viewBound;
-                it->second.push_back(l);
+                bounds.push_back(l);
             }
 
             const bool fillPPLights = mPPLightBuffer && it->first->getName() == Constants::SceneCamera;
             const bool sceneLimitReached = getLightingMethod() == LightingMethod::SingleUBO
-                && it->second.size() > static_cast<size_t>(getMaxLightsInScene() - 1);
+                && bounds.size() > static_cast<size_t>(getMaxLightsInScene() - 1);
 
             if (fillPPLights || sceneLimitReached)
             {
@@ -1171,12 +1172,12 @@ namespace SceneUtil
                         < right.mViewBound.center().length2() - right.mViewBound.radius2();
                 };
 
-                std::sort(it->second.begin(), it->second.end(), sorter);
+                std::sort(bounds.begin(), bounds.end(), sorter);
 
                 if (fillPPLights)
                 {
                     osg::CullingSet& cullingSet = cv->getModelViewCullingStack().front();
-                    for (const auto& bound : it->second)
+                    for (const auto& bound : bounds)
                     {
                         if (bound.mLightSource->getEmpty())
                             continue;
@@ -1195,8 +1196,13 @@ namespace SceneUtil
                 }
 
                 if (sceneLimitReached)
-                    it->second.resize(getMaxLightsInScene() - 1);
+                    bounds.resize(getMaxLightsInScene() - 1);
             }
+
+            mLightGridBounds.clear();
+            for (const LightSourceViewBound& bound : bounds)
+                mLightGridBounds.push_back(bound.mViewBound);
+            it->second.mGrid.build(mLightGridBounds);
         }
 
         return it->second;
@@ -1273,9 +1279,6 @@ namespace SceneUtil
         if (!(cv->getTraversalMask() & mLightManager->getLightingMask()))
             return false;
 
-        // Possible optimizations:
-        // - organize lights in a quad tree
-
         // Don't use Camera::getViewMatrix, that one might be relative to another camera!
         const osg::RefMatrix* viewMatrix = cv->getCurrentRenderStage()->getInitialViewMatrix();
 
@@ -1299,18 +1302,19 @@ namespace SceneUtil
 
             transformBoundingSphere(*cv->getModelViewMatrix(), nodeBound);
 
-            const std::vector<LightManager::LightSourceViewBound>& lights
+            const LightManager::LightsInViewSpace& lights
                 = mLightManager->getLightsInViewSpace(cv, viewMatrix, mLastFrameNumber);
 
             mLightList.clear();
-            for (const LightManager::LightSourceViewBound& light : lights)
-            {
+            lights.mGrid.forEachCandidate(nodeBound, [&](std::size_t index) {
+                const LightManager::LightSourceViewBound& light = lights.mBounds[index];
+
                 if (mIgnoredLightSources.contains(light.mLightSource))
-                    continue;
+                    return;
 
                 if (light.mViewBound.intersects(nodeBound))
                     mLightList.push_back(&light);
-            }
+            });
 
             const size_t maxLights = mLightManager->getMaxLights() - mLightManager->getStartLight();
 
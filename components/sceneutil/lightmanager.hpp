@@ -13,6 +13,7 @@
 
 #include <components/sceneutil/nodecallback.hpp>
 
+#include "lightgrid.hpp"
 #include "lightingmethod.hpp"
 
 namespace SceneUtil
@@ -210,6 +211,13 @@ namespace SceneUtil
             osg::BoundingSphere mViewBound;
         };
 
+        struct LightsInViewSpace
+        {
+            std::vector<LightSourceViewBound> mBounds;
+            // Indices of mBounds by view space clusters
+            LightGrid mGrid;
+        };
+
         using LightList = std::vector<const LightSourceViewBound*>;
         using SupportedMethods = std::array<bool, 3>;
 
@@ -237,7 +245,7 @@ namespace SceneUtil
         /// Internal use only, called automatically by the LightSource's UpdateCallback
         void addLight(LightSource* lightSource, const osg::Matrixf& worldMat, size_t frameNum);
 
-        const std::vector<LightSourceViewBound>& getLightsInViewSpace(
+        const LightsInViewSpace& getLightsInViewSpace(
             osgUtil::CullVisitor* cv, const osg::RefMatrix* viewMatrix, size_t frameNum);
 
         osg::ref_ptr<osg::StateSet> getLightListStateSet(
@@ -294,8 +302,8 @@ namespace SceneUtil
 
         std::vector<LightSourceTransform> mLights;
 
-        using LightSourceViewBoundCollection = std::vector<LightSourceViewBound>;
-        std::map<osg::observer_ptr<osg::Camera>, LightSourceViewBoundCollection> mLightsInViewSpace;
+        std::map<osg::observer_ptr<osg::Camera>, LightsInViewSpace> mLightsInViewSpace;
+        std::vector<osg::BoundingSphere> mLightGridBounds;
 
         using LightIdList = std::vector<int>;
         struct HashLightIdList
@@ -2,10 +2,26 @@
 
 #include <components/debug/debuglog.hpp>
 
+#include <osg/Stats>
+
+#include <algorithm>
 #include <numeric>
 
 namespace SceneUtil
 {
+    namespace
+    {
+        // Allows work items added from a work thread to go to the queue of this thread.
+        thread_local const WorkQueue* sCurrentQueue = nullptr;
+        thread_local std::size_t sCurrentThreadIndex = 0;
+
+        void updateMax(std::atomic<std::int64_t>& max, std::int64_t value)
+        {
+            std::int64_t current = max.load(std::memory_order_relaxed);
+            while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                ;
+        }
+    }
 
     void WorkItem::waitTillDone()
     {
@@ -33,6 +49,17 @@ namespace SceneUtil
         return mDone;
     }
 
+    void WorkItem::cancel()
+    {
+        mCancelled = true;
+        abort();
+    }
+
+    bool WorkItem::isCancelled() const
+    {
+        return mCancelled;
+    }
+
     WorkQueue::WorkQueue(std::size_t workerThreads)
         : mIsReleased(false)
     {
@@ -46,20 +73,24 @@ namespace SceneUtil
 
     void WorkQueue::start(std::size_t workerThreads)
     {
+        if (!mThreads.empty())
+            return;
         {
             const std::lock_guard lock(mMutex);
             mIsReleased = false;
         }
+        // There is always at least one queue to keep items added while there are no threads.
+        while (mQueues.size() < std::max<std::size_t>(workerThreads, 1))
+            mQueues.emplace_back(std::make_unique<ThreadQueue>());
         while (mThreads.size() < workerThreads)
-            mThreads.emplace_back(std::make_unique<WorkThread>(*this));
+            mThreads.emplace_back(std::make_unique<WorkThread>(*this, mThreads.size()));
     }
 
     void WorkQueue::stop()
     {
         {
             std::unique_lock<std::mutex> lock(mMutex);
-            while (!mQueue.empty())
-                mQueue.pop_back();
+            clearQueues();
             mIsReleased = true;
             mCondition.notify_all();
         }
@@ -67,7 +98,7 @@ namespace SceneUtil
         mThreads.clear();
     }
 
-    void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, bool front)
+    void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, WorkPriority priority)
     {
         if (item->isDone())
         {
@@ -75,34 +106,89 @@ namespace SceneUtil
             return;
         }
 
-        std::unique_lock<std::mutex> lock(mMutex);
-        if (front)
-            mQueue.push_front(std::move(item));
-        else
-            mQueue.push_back(std::move(item));
+        const std::size_t queueIndex = sCurrentQueue == this
+            ? sCurrentThreadIndex
+            : mNextQueue.fetch_add(1, std::memory_order_relaxed) % mQueues.size();
+
+        {
+            ThreadQueue& queue = *mQueues[queueIndex];
+            const std::lock_guard lock(queue.mMutex);
+            queue.mEntries[static_cast<std::size_t>(priority)].push_back(Entry{ std::move(item), Clock::now() });
+        }
+
+        {
+            const std::lock_guard lock(mMutex);
+            ++mNumItems;
+        }
         mCondition.notify_one();
     }
 
-    osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem()
+    osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem(std::size_t threadIndex)
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        while (mQueue.empty() && !mIsReleased)
+        while (true)
         {
-            mCondition.wait(lock);
+            if (osg::ref_ptr<WorkItem> item = tryRemoveWorkItem(threadIndex))
+                return item;
+
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [&] { return mNumItems > 0 || mIsReleased; });
+            if (mIsReleased)
+                return nullptr;
         }
-        if (!mQueue.empty())
+    }
+
+    osg::ref_ptr<WorkItem> WorkQueue::tryRemoveWorkItem(std::size_t threadIndex)
+    {
+        const std::size_t queuesCount = mQueues.size();
+        for (std::size_t priority = std::tuple_size_v<decltype(ThreadQueue::mEntries)>; priority > 0; --priority)
         {
-            osg::ref_ptr<WorkItem> item = std::move(mQueue.front());
-            mQueue.pop_front();
-            return item;
+            // Take from own queue first then steal from the others.
+            for (std::size_t i = 0; i < queuesCount; ++i)
+            {
+                ThreadQueue& queue = *mQueues[(threadIndex + i) % queuesCount];
+                Entry entry;
+                {
+                    const std::lock_guard lock(queue.mMutex);
+                    std::deque<Entry>& entries = queue.mEntries[priority - 1];
+                    if (entries.empty())
+                        continue;
+                    entry = std::move(entries.front());
+                    entries.pop_front();
+                }
+                --mNumItems;
+                if (entry.mItem->isCancelled())
+                {
+                    ++mCancelled;
+                    entry.mItem->signalDone();
+                    continue;
+                }
+                const std::int64_t latency
+                    = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - entry.mQueuedAt).count();
+                ++mStarted;
+                mTotalLatency += latency;
+                updateMax(mMaxLatency, latency);
+                return std::move(entry.mItem);
+            }
         }
         return nullptr;
     }
 
+    void WorkQueue::clearQueues()
+    {
+        for (const std::unique_ptr<ThreadQueue>& queue : mQueues)
+        {
+            const std::lock_guard lock(queue->mMutex);
+            for (std::deque<Entry>& entries : queue->mEntries)
+            {
+                mNumItems -= static_cast<std::int64_t>(entries.size());
+                entries.clear();
+            }
+        }
+    }
+
     unsigned int WorkQueue::getNumItems() const
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        return mQueue.size();
+        return static_cast<unsigned int>(std::max<std::int64_t>(mNumItems, 0));
     }
 
     unsigned int WorkQueue::getNumActiveThreads() const
@@ -111,8 +197,23 @@ namespace SceneUtil
             mThreads.begin(), mThreads.end(), 0u, [](auto r, const auto& t) { return r + t->isActive(); });
     }
 
-    WorkThread::WorkThread(WorkQueue& workQueue)
+    void WorkQueue::reportStats(unsigned int frameNumber, osg::Stats& stats)
+    {
+        const std::size_t started = mStarted.exchange(0);
+        const std::int64_t totalLatency = mTotalLatency.exchange(0);
+        const std::int64_t maxLatency = mMaxLatency.exchange(0);
+
+        stats.setAttribute(frameNumber, "WorkQueue", getNumItems());
+        stats.setAttribute(frameNumber, "WorkThread", getNumActiveThreads());
+        stats.setAttribute(frameNumber, "WorkQueue Latency",
+            started == 0 ? 0.0 : static_cast<double>(totalLatency) / static_cast<double>(started));
+        stats.setAttribute(frameNumber, "WorkQueue MaxLatency", static_cast<double>(maxLatency));
+        stats.setAttribute(frameNumber, "WorkQueue Cancelled", static_cast<double>(mCancelled.load()));
+    }
+
+    WorkThread::WorkThread(WorkQueue& workQueue, std::size_t index)
         : mWorkQueue(&workQueue)
+        , mIndex(index)
         , mActive(false)
         , mThread([this] { run(); })
     {
@@ -125,9 +226,11 @@ namespace SceneUtil
 
     void WorkThread::run()
     {
+        sCurrentQueue = mWorkQueue;
+        sCurrentThreadIndex = mIndex;
         while (true)
         {
-            osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem();
+            osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem(mIndex);
             if (!item)
                 return;
             mActive = true;
@@ -4,13 +4,23 @@
 #include <osg/Referenced>
 #include <osg/ref_ptr>
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
+namespace osg
+{
+    class Stats;
+}
+
 namespace SceneUtil
 {
 
@@ -31,56 +41,105 @@ namespace SceneUtil
         /// Set abort flag in order to return from doWork() as soon as possible. May not be respected by all WorkItems.
         virtual void abort() {}
 
+        /// Mark the item as no longer needed. WorkQueue skips doWork() for the item if it is not started yet,
+        /// otherwise abort() is called.
+        void cancel();
+
+        bool isCancelled() const;
+
     private:
         std::atomic_bool mDone{ false };
+        std::atomic_bool mCancelled{ false };
         std::mutex mMutex;
         std::condition_variable mCondition;
     };
 
+    enum class WorkPriority
+    {
+        Low,
+        Normal,
+        High,
+    };
+
     class WorkThread;
 
     /// @brief A work queue that users can push work items onto, to be completed by one or more background threads.
-    /// @note Work items will be processed in the order that they were given in, however
-    /// if multiple work threads are involved then it is possible for a later item to complete before earlier items.
+    /// @par Each thread has its own queue, items are distributed over them and idle threads steal items from the
+    /// queues of other threads.
+    /// @note Work items with the same priority will be processed in the order that they were given in by the same
+    /// thread, however if multiple work threads are involved then it is possible for a later item to complete before
+    /// earlier items. Items with higher priority are taken before items with lower priority.
     class WorkQueue : public osg::Referenced
     {
     public:
         WorkQueue(std::size_t workerThreads);
         ~WorkQueue();
 
+        /// Start worker threads. Does nothing if the queue is already started.
         void start(std::size_t workerThreads);
 
         void stop();
 
-        /// Add a new work item to the back of the queue.
+        /// Add a new work item to the back of the queue with given priority.
         /// @par The work item's waitTillDone() method may be used by the caller to wait until the work is complete.
-        /// @param front If true, add item to the front of the queue. If false (default), add to the back.
-        void addWorkItem(osg::ref_ptr<WorkItem> item, bool front = false);
+        void addWorkItem(osg::ref_ptr<WorkItem> item, WorkPriority priority = WorkPriority::Normal);
 
-        /// Get the next work item from the front of the queue. If the queue is empty, waits until a new item is added.
-        /// If the workqueue is in the process of being destroyed, may return nullptr.
+        /// Get the next work item with the highest priority from the queue of given thread or steal it from other
+        /// threads. If there is no items, waits until a new item is added. If the workqueue is in the process of
+        /// being destroyed, may return nullptr.
         /// @par Used internally by the WorkThread.
-        osg::ref_ptr<WorkItem> removeWorkItem();
+        osg::ref_ptr<WorkItem> removeWorkItem(std::size_t threadIndex);
 
         unsigned int getNumItems() const;
 
         unsigned int getNumActiveThreads() const;
 
+        std::size_t getNumThreads() const { return mThreads.size(); }
+
+        /// Report number of queued items, active threads, cancelled items and average and maximum time in
+        /// microseconds items waited in the queue since the previous report.
+        void reportStats(unsigned int frameNumber, osg::Stats& stats);
+
     private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Entry
+        {
+            osg::ref_ptr<WorkItem> mItem;
+            Clock::time_point mQueuedAt;
+        };
+
+        struct ThreadQueue
+        {
+            std::mutex mMutex;
+            std::array<std::deque<Entry>, 3> mEntries;
+        };
+
         bool mIsReleased;
-        std::deque<osg::ref_ptr<WorkItem>> mQueue;
+        std::vector<std::unique_ptr<ThreadQueue>> mQueues;
+        std::atomic<std::size_t> mNextQueue{ 0 };
+        std::atomic<std::int64_t> mNumItems{ 0 };
 
         mutable std::mutex mMutex;
         std::condition_variable mCondition;
 
+        std::atomic<std::size_t> mCancelled{ 0 };
+        std::atomic<std::size_t> mStarted{ 0 };
+        std::atomic<std::int64_t> mTotalLatency{ 0 };
+        std::atomic<std::int64_t> mMaxLatency{ 0 };
+
         std::vector<std::unique_ptr<WorkThread>> mThreads;
+
+        osg::ref_ptr<WorkItem> tryRemoveWorkItem(std::size_t threadIndex);
+
+        void clearQueues();
     };
 
     /// Internally used by WorkQueue.
     class WorkThread
     {
     public:
-        WorkThread(WorkQueue& workQueue);
+        WorkThread(WorkQueue& workQueue, std::size_t index);
 
         ~WorkThread();
 
@@ -88,6 +147,7 @@ namespace SceneUtil
 
     private:
         WorkQueue* mWorkQueue;
+        std::size_t mIndex;
         std::atomic<bool> mActive;
         std::thread mThread;
 
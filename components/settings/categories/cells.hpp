@@ -31,8 +31,10 @@ namespace Settings
             makeMaxSanitizerFloat(0) };
         SettingValue<float> mPredictionTime{ mIndex, "Cells", "prediction time", makeMaxSanitizerFloat(0) };
         SettingValue<float> mCacheExpiryDelay{ mIndex, "Cells", "cache expiry delay", makeMaxSanitizerFloat(0) };
+        SettingValue<int> mCacheMemoryBudget{ mIndex, "Cells", "cache memory budget", makeMaxSanitizerInt(0) };
         SettingValue<float> mTargetFramerate{ mIndex, "Cells", "target framerate", makeMaxStrictSanitizerFloat(0) };
         SettingValue<int> mPointersCacheSize{ mIndex, "Cells", "pointers cache size", makeClampSanitizerInt(40, 1000) };
+        SettingValue<bool> mReferencesDiskCache{ mIndex, "Cells", "references disk cache" };
     };
 }
 
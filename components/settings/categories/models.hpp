@@ -35,6 +35,7 @@ namespace Settings
         SettingValue<VFS::Path::Normalized> mWeathersnow{ mIndex, "Models", "weathersnow" };
         SettingValue<VFS::Path::Normalized> mWeatherblizzard{ mIndex, "Models", "weatherblizzard" };
         SettingValue<bool> mWriteNifDebugLog{ mIndex, "Models", "write nif debug log" };
+        SettingValue<bool> mSceneDiskCache{ mIndex, "Models", "scene disk cache" };
     };
 }
 
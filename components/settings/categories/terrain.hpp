@@ -27,6 +27,7 @@ namespace Settings
         SettingValue<float> mMaxCompositeGeometrySize{ mIndex, "Terrain", "max composite geometry size",
             makeMaxSanitizerFloat(1) };
         SettingValue<bool> mDebugChunks{ mIndex, "Terrain", "debug chunks" };
+        SettingValue<bool> mChunkDiskCache{ mIndex, "Terrain", "chunk disk cache" };
         SettingValue<bool> mObjectPaging{ mIndex, "Terrain", "object paging" };
         SettingValue<bool> mObjectPagingActiveGrid{ mIndex, "Terrain", "object paging active grid" };
         SettingValue<float> mObjectPagingMergeFactor{ mIndex, "Terrain", "object paging merge factor",
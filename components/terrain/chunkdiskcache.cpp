@@ -0,0 +1,296 @@
+#include "chunkdiskcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/files/atomicfile.hpp>
+#include <components/misc/strings/format.hpp>
+#include <components/serialization/binaryreader.hpp>
+#include <components/serialization/binarywriter.hpp>
+#include <components/serialization/format.hpp>
+#include <components/serialization/sizeaccumulator.hpp>
+
+#include <extern/smhasher/MurmurHash3.h>
+
+#include <osg/Image>
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Terrain
+{
+    namespace
+    {
+        constexpr std::array<char, 8> fileMagic{ 'O', 'M', 'W', 'T', 'E', 'R', 'R', 'N' };
+
+        // Increment when the format or the terrain chunk generation changes
+        constexpr std::uint32_t formatVersion = 1;
+
+        // Protects from allocating too much memory for corrupted data
+        constexpr std::int32_t maxImageSize = 4096;
+
+        enum class EntryType : std::uint8_t
+        {
+            VertexBuffers,
+            Blendmaps,
+        };
+
+        struct Header
+        {
+            std::array<char, 8> mMagic{};
+            std::uint32_t mFormatVersion = 0;
+            std::uint8_t mType = 0;
+            std::string mWorldspace;
+            float mSize = 0;
+            osg::Vec2f mCenter;
+            std::uint8_t mLod = 0;
+            std::array<std::uint64_t, 2> mDataHash{};
+
+            friend bool operator==(const Header& l, const Header& r) = default;
+        };
+
+        template <Serialization::Mode mode>
+        struct Format : Serialization::Format<mode, Format<mode>>
+        {
+            using Serialization::Format<mode, Format<mode>>::operator();
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, std::string>>
+            {
+                if constexpr (mode == Serialization::Mode::Write)
+                    visitor(*this, static_cast<std::uint64_t>(value.size()));
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    std::uint64_t size = 0;
+                    visitor(*this, size);
+                    value.resize(static_cast<std::size_t>(size));
+                }
+                visitor(*this, value.data(), value.size());
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, osg::Vec2f>>
+            {
+                visitor(*this, value.ptr(), 2);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, osg::Vec3Array>
+                    || std::is_same_v<std::decay_t<T>, osg::Vec4ubArray>>
+            {
+                using Element = typename std::decay_t<T>::ElementDataType;
+                if constexpr (mode == Serialization::Mode::Write)
+                    visitor(*this, static_cast<std::uint64_t>(value.size()));
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    std::uint64_t size = 0;
+                    visitor(*this, size);
+                    value.resize(static_cast<std::size_t>(size));
+                }
+                if (!value.empty())
+                    visitor(*this, value.front().ptr(), value.size() * Element::num_components);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, osg::ref_ptr<osg::Image>>>
+            {
+                if constexpr (mode == Serialization::Mode::Write)
+                {
+                    visitor(*this, static_cast<std::int32_t>(value->s()));
+                    visitor(*this, static_cast<std::int32_t>(value->t()));
+                    visitor(*this, static_cast<std::uint32_t>(value->getPixelFormat()));
+                    visitor(*this, static_cast<std::uint32_t>(value->getDataType()));
+                }
+                else
+                {
+                    static_assert(mode == Serialization::Mode::Read);
+                    std::int32_t width = 0;
+                    std::int32_t height = 0;
+                    std::uint32_t pixelFormat = 0;
+                    std::uint32_t dataType = 0;
+                    visitor(*this, width);
+                    visitor(*this, height);
+                    visitor(*this, pixelFormat);
+                    visitor(*this, dataType);
+                    if (width <= 0 || height <= 0 || width > maxImageSize || height > maxImageSize)
+                        throw std::runtime_error("Invalid terrain blendmap size");
+                    value = new osg::Image;
+                    value->allocateImage(width, height, 1, pixelFormat, dataType);
+                    if (value->data() == nullptr)
+                        throw std::runtime_error("Invalid terrain blendmap format");
+                }
+                visitor(*this, value->data(), value->getTotalDataSize());
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, LayerInfo>>
+            {
+                visitor(*this, value.mDiffuseMap);
+                visitor(*this, value.mNormalMap);
+                visitor(*this, value.mParallax);
+                visitor(*this, value.mSpecular);
+            }
+
+            template <class Visitor, class T>
+            auto operator()(Visitor&& visitor, T& value) const
+                -> std::enable_if_t<std::is_same_v<std::decay_t<T>, Header>>
+            {
+                visitor(*this, value.mMagic.data(), value.mMagic.size());
+                visitor(*this, value.mFormatVersion);
+                // Entries of other versions may have different header layout
+                if (value.mMagic != fileMagic || value.mFormatVersion != formatVersion)
+                    return;
+                visitor(*this, value.mType);
+                visitor(*this, value.mWorldspace);
+                visitor(*this, value.mSize);
+                visitor(*this, value.mCenter);
+                visitor(*this, value.mLod);
+                visitor(*this, value.mDataHash.data(), value.mDataHash.size());
+            }
+        };
+
+        template <class... T>
+        std::vector<std::byte> serialize(const T&... values)
+        {
+            constexpr Format<Serialization::Mode::Write> format;
+            Serialization::SizeAccumulator sizeAccumulator;
+            (format(sizeAccumulator, values), ...);
+            std::vector<std::byte> result(sizeAccumulator.value());
+            Serialization::BinaryWriter writer(result.data(), result.data() + result.size());
+            (format(writer, values), ...);
+            return result;
+        }
+
+        Header makeHeader(EntryType type, const ChunkDiskCacheKey& key, unsigned char lod)
+        {
+            return Header{
+                .mMagic = fileMagic,
+                .mFormatVersion = formatVersion,
+                .mType = static_cast<std::uint8_t>(type),
+                .mWorldspace = key.mWorldspace.serializeText(),
+                .mSize = key.mSize,
+                .mCenter = key.mCenter,
+                .mLod = lod,
+                .mDataHash = key.mDataHash,
+            };
+        }
+
+        // Entry with a different data hash is stored in the same file to replace the outdated one
+        std::filesystem::path getFilePath(const std::filesystem::path& directory, const Header& header)
+        {
+            Header location = header;
+            location.mDataHash = {};
+            const std::vector<std::byte> data = serialize(location);
+            const std::array<std::uint64_t, 2> seed{ 0, 0 };
+            std::array<std::uint64_t, 2> hash{ 0, 0 };
+            MurmurHash3_x64_128(data.data(), static_cast<int>(data.size()), seed.data(), hash.data());
+            return directory
+                / Misc::StringUtils::format("%016llx%016llx.chunk", static_cast<unsigned long long>(hash[0]),
+                    static_cast<unsigned long long>(hash[1]));
+        }
+
+        // Returns false if there is no file or it has a different header. Throws on corrupted data.
+        template <class... T>
+        bool readEntry(const std::filesystem::path& filePath, const Header& expected, T&... values)
+        {
+            const std::optional<std::string> data = Files::readFileContent(filePath);
+            if (!data.has_value())
+                return false;
+
+            const std::byte* const begin = reinterpret_cast<const std::byte*>(data->data());
+            Serialization::BinaryReader reader(begin, begin + data->size());
+            constexpr Format<Serialization::Mode::Read> format;
+            Header header;
+            format(reader, header);
+            if (header != expected)
+                return false;
+            (format(reader, values), ...);
+            return true;
+        }
+
+        void writeEntry(const std::filesystem::path& filePath, const std::vector<std::byte>& data)
+        {
+            try
+            {
+                Files::writeFileAtomically(
+                    filePath, std::string_view(reinterpret_cast<const char*>(data.data()), data.size()));
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Failed to write terrain chunk cache " << filePath << ": " << e.what();
+            }
+        }
+    }
+
+    ChunkDiskCache::ChunkDiskCache(const std::filesystem::path& directory)
+        : mDirectory(directory)
+    {
+        std::filesystem::create_directories(mDirectory);
+    }
+
+    bool ChunkDiskCache::readVertexBuffers(const ChunkDiskCacheKey& key, unsigned char lod, osg::Vec3Array& positions,
+        osg::Vec3Array& normals, osg::Vec4ubArray& colours) const
+    {
+        const Header header = makeHeader(EntryType::VertexBuffers, key, lod);
+        const std::filesystem::path filePath = getFilePath(mDirectory, header);
+        try
+        {
+            return readEntry(filePath, header, positions, normals, colours);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read terrain chunk cache " << filePath << ": " << e.what();
+            positions.clear();
+            normals.clear();
+            colours.clear();
+            return false;
+        }
+    }
+
+    void ChunkDiskCache::writeVertexBuffers(const ChunkDiskCacheKey& key, unsigned char lod,
+        const osg::Vec3Array& positions, const osg::Vec3Array& normals, const osg::Vec4ubArray& colours) const
+    {
+        const Header header = makeHeader(EntryType::VertexBuffers, key, lod);
+        writeEntry(getFilePath(mDirectory, header), serialize(header, positions, normals, colours));
+    }
+
+    bool ChunkDiskCache::readBlendmaps(
+        const ChunkDiskCacheKey& key, Storage::ImageVector& blendmaps, std::vector<LayerInfo>& layerList) const
+    {
+        const Header header = makeHeader(EntryType::Blendmaps, key, 0);
+        const std::filesystem::path filePath = getFilePath(mDirectory, header);
+        try
+        {
+            Storage::ImageVector images;
+            std::vector<LayerInfo> layers;
+            if (!readEntry(filePath, header, images, layers))
+                return false;
+            if (images.size() > layers.size())
+                throw std::runtime_error("Number of blendmaps exceeds number of layers");
+            blendmaps = std::move(images);
+            layerList = std::move(layers);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read terrain chunk cache " << filePath << ": " << e.what();
+            return false;
+        }
+    }
+
+    void ChunkDiskCache::writeBlendmaps(const ChunkDiskCacheKey& key, const Storage::ImageVector& blendmaps,
+        const std::vector<LayerInfo>& layerList) const
+    {
+        const Header header = makeHeader(EntryType::Blendmaps, key, 0);
+        writeEntry(getFilePath(mDirectory, header), serialize(header, blendmaps, layerList));
+    }
+}
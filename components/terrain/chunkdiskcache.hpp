@@ -0,0 +1,54 @@
+#ifndef OPENMW_COMPONENTS_TERRAIN_CHUNKDISKCACHE_H
+#define OPENMW_COMPONENTS_TERRAIN_CHUNKDISKCACHE_H
+
+#include "storage.hpp"
+
+#include <components/esm/refid.hpp>
+
+#include <osg/Array>
+#include <osg/Vec2f>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Terrain
+{
+    struct ChunkDiskCacheKey
+    {
+        ESM::RefId mWorldspace;
+        float mSize;
+        osg::Vec2f mCenter;
+        // See Storage::getChunkHash
+        std::array<std::uint64_t, 2> mDataHash;
+    };
+
+    /// @brief Stores vertex buffers and blendmaps of terrain chunks in the directory, one file per chunk and LOD level.
+    /// Entry is used only if it was written with the same format version and key.
+    /// @note May be used from any thread.
+    class ChunkDiskCache
+    {
+    public:
+        explicit ChunkDiskCache(const std::filesystem::path& directory);
+
+        /// Returns false if there is no valid entry
+        bool readVertexBuffers(const ChunkDiskCacheKey& key, unsigned char lod, osg::Vec3Array& positions,
+            osg::Vec3Array& normals, osg::Vec4ubArray& colours) const;
+
+        void writeVertexBuffers(const ChunkDiskCacheKey& key, unsigned char lod, const osg::Vec3Array& positions,
+            const osg::Vec3Array& normals, const osg::Vec4ubArray& colours) const;
+
+        /// Returns false if there is no valid entry
+        bool readBlendmaps(
+            const ChunkDiskCacheKey& key, Storage::ImageVector& blendmaps, std::vector<LayerInfo>& layerList) const;
+
+        void writeBlendmaps(const ChunkDiskCacheKey& key, const Storage::ImageVector& blendmaps,
+            const std::vector<LayerInfo>& layerList) const;
+
+    private:
+        std::filesystem::path mDirectory;
+    };
+}
+
+#endif
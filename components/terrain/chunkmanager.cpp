@@ -10,6 +10,7 @@
 
 #include <components/sceneutil/lightmanager.hpp>
 
+#include "chunkdiskcache.hpp"
 #include "compositemaprenderer.hpp"
 #include "material.hpp"
 #include "storage.hpp"
@@ -137,12 +138,52 @@ namespace Terrain
         }
     }
 
+    std::optional<ChunkDiskCacheKey> ChunkManager::makeDiskCacheKey(
+        unsigned char lod, float chunkSize, const osg::Vec2f& chunkCenter) const
+    {
+        if (mDiskCache == nullptr)
+            return std::nullopt;
+        const std::optional<std::array<std::uint64_t, 2>> hash
+            = mStorage->getChunkHash(lod, chunkSize, chunkCenter, mWorldspace);
+        if (!hash.has_value())
+            return std::nullopt;
+        return ChunkDiskCacheKey{
+            .mWorldspace = mWorldspace,
+            .mSize = chunkSize,
+            .mCenter = chunkCenter,
+            .mDataHash = *hash,
+        };
+    }
+
+    void ChunkManager::fillVertexBuffers(unsigned char lod, float chunkSize, const osg::Vec2f& chunkCenter,
+        osg::Vec3Array& positions, osg::Vec3Array& normals, osg::Vec4ubArray& colours) const
+    {
+        const std::optional<ChunkDiskCacheKey> key = makeDiskCacheKey(lod, chunkSize, chunkCenter);
+        if (key.has_value() && mDiskCache->readVertexBuffers(*key, lod, positions, normals, colours))
+            return;
+        mStorage->fillVertexBuffers(lod, chunkSize, chunkCenter, mWorldspace, positions, normals, colours);
+        if (key.has_value())
+            mDiskCache->writeVertexBuffers(*key, lod, positions, normals, colours);
+    }
+
+    void ChunkManager::getBlendmaps(float chunkSize, const osg::Vec2f& chunkCenter,
+        std::vector<osg::ref_ptr<osg::Image>>& blendmaps, std::vector<LayerInfo>& layerList) const
+    {
+        // Blendmaps are built from all cells of the chunk regardless of LOD
+        const std::optional<ChunkDiskCacheKey> key = makeDiskCacheKey(0, chunkSize, chunkCenter);
+        if (key.has_value() && mDiskCache->readBlendmaps(*key, blendmaps, layerList))
+            return;
+        mStorage->getBlendmaps(chunkSize, chunkCenter, blendmaps, layerList, mWorldspace);
+        if (key.has_value())
+            mDiskCache->writeBlendmaps(*key, blendmaps, layerList);
+    }
+
     std::vector<osg::ref_ptr<osg::StateSet>> ChunkManager::createPasses(
         float chunkSize, const osg::Vec2f& chunkCenter, bool forCompositeMap)
     {
         std::vector<LayerInfo> layerList;
         std::vector<osg::ref_ptr<osg::Image>> blendmaps;
-        mStorage->getBlendmaps(chunkSize, chunkCenter, blendmaps, layerList, mWorldspace);
+        getBlendmaps(chunkSize, chunkCenter, blendmaps, layerList);
 
         bool useShaders = mSceneManager->getForceShaders();
         if (!mSceneManager->getClampLighting())
@@ -201,7 +242,7 @@ namespace Terrain
             osg::ref_ptr<osg::Vec4ubArray> colors(new osg::Vec4ubArray);
             colors->setNormalize(true);
 
-            mStorage->fillVertexBuffers(lod, chunkSize, chunkCenter, mWorldspace, *positions, *normals, *colors);
+            fillVertexBuffers(lod, chunkSize, chunkCenter, *positions, *normals, *colors);
 
             osg::ref_ptr<osg::VertexBufferObject> vbo(new osg::VertexBufferObject);
             positions->setVertexBufferObject(vbo);
@@ -1,16 +1,20 @@
 #ifndef OPENMW_COMPONENTS_TERRAIN_CHUNKMANAGER_H
 #define OPENMW_COMPONENTS_TERRAIN_CHUNKMANAGER_H
 
+#include <memory>
+#include <optional>
 #include <tuple>
 
 #include <components/resource/resourcemanager.hpp>
 
 #include "buffercache.hpp"
+#include "defs.hpp"
 #include "quadtreeworld.hpp"
 
 namespace osg
 {
     class Group;
+    class Image;
     class Texture2D;
 }
 
@@ -27,6 +31,8 @@ namespace Terrain
     class Storage;
     class CompositeMap;
     class TerrainDrawable;
+    class ChunkDiskCache;
+    struct ChunkDiskCacheKey;
 
     struct TemplateKey
     {
@@ -85,6 +91,11 @@ namespace Terrain
         void setCompositeMapLevel(float level) { mCompositeMapLevel = level; }
         void setMaxCompositeGeometrySize(float maxCompGeometrySize) { mMaxCompGeometrySize = maxCompGeometrySize; }
 
+        /// Vertex buffers and blendmaps of new chunks are read from the disk cache if possible and written there
+        /// otherwise
+        /// @note Not thread safe, set before creating chunks.
+        void setDiskCache(std::shared_ptr<const ChunkDiskCache> diskCache) { mDiskCache = std::move(diskCache); }
+
         void setNodeMask(unsigned int mask) { mNodeMask = mask; }
         unsigned int getNodeMask() override { return mNodeMask; }
 
@@ -106,11 +117,21 @@ namespace Terrain
         std::vector<osg::ref_ptr<osg::StateSet>> createPasses(
             float chunkSize, const osg::Vec2f& chunkCenter, bool forCompositeMap);
 
+        std::optional<ChunkDiskCacheKey> makeDiskCacheKey(
+            unsigned char lod, float chunkSize, const osg::Vec2f& chunkCenter) const;
+
+        void fillVertexBuffers(unsigned char lod, float chunkSize, const osg::Vec2f& chunkCenter,
+            osg::Vec3Array& positions, osg::Vec3Array& normals, osg::Vec4ubArray& colours) const;
+
+        void getBlendmaps(float chunkSize, const osg::Vec2f& chunkCenter,
+            std::vector<osg::ref_ptr<osg::Image>>& blendmaps, std::vector<LayerInfo>& layerList) const;
+
         Terrain::Storage* mStorage;
         Resource::SceneManager* mSceneManager;
         TextureManager* mTextureManager;
         CompositeMapRenderer* mCompositeMapRenderer;
         BufferCache mBufferCache;
+        std::shared_ptr<const ChunkDiskCache> mDiskCache;
 
         osg::ref_ptr<osg::StateSet> mMultiPassRoot;
 
@@ -1,6 +1,9 @@
 #ifndef COMPONENTS_TERRAIN_STORAGE_H
 #define COMPONENTS_TERRAIN_STORAGE_H
 
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <vector>
 
 #include <osg/Array>
@@ -80,6 +83,16 @@ namespace Terrain
             std::vector<LayerInfo>& layerList, ESM::RefId worldspace)
             = 0;
 
+        /// Get a hash of the terrain data read by fillVertexBuffers with the same arguments. With lodLevel = 0 it
+        /// also covers the data read by getBlendmaps. Used to check whether a stored terrain chunk is still valid.
+        /// @note May be called from background threads.
+        /// @return std::nullopt if the data can't be hashed, then the chunk is not stored
+        virtual std::optional<std::array<std::uint64_t, 2>> getChunkHash(
+            int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace)
+        {
+            return std::nullopt;
+        }
+
         virtual float getHeightAt(const osg::Vec3f& worldPos, ESM::RefId worldspace) = 0;
 
         /// Get the transformation factor for mapping cell units to world units.
@@ -3,6 +3,8 @@
 #include <osg/Camera>
 #include <osg/Group>
 
+#include <utility>
+
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/settings/values.hpp>
@@ -126,6 +128,12 @@ namespace Terrain
         mCompositeMapRenderer->setTargetFrameRate(rate);
     }
 
+    void World::setChunkDiskCache(std::shared_ptr<const ChunkDiskCache> diskCache)
+    {
+        if (mChunkManager)
+            mChunkManager->setDiskCache(std::move(diskCache));
+    }
+
     float World::getHeightAt(const osg::Vec3f& worldPos)
     {
         return mStorage->getHeightAt(worldPos, mWorldspace);
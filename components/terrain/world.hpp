@@ -34,6 +34,7 @@ namespace Terrain
 
     class TextureManager;
     class ChunkManager;
+    class ChunkDiskCache;
     class CompositeMapRenderer;
     class View;
     class HeightCullCallback;
@@ -58,6 +59,10 @@ namespace Terrain
         /// See CompositeMapRenderer::setTargetFrameRate
         void setTargetFrameRate(float rate);
 
+        /// See ChunkManager::setDiskCache
+        /// @note Not thread safe.
+        void setChunkDiskCache(std::shared_ptr<const ChunkDiskCache> diskCache);
+
         /// Apply the scene manager's texture filtering settings to all cached textures.
         /// @note Thread safe.
         void updateTextureFiltering();
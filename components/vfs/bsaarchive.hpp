@@ -42,7 +42,7 @@ namespace VFS
             : Archive()
         {
             mFile = std::make_unique<BSAFileType>();
-            mFile->open(filename);
+            mFile->open(filename, true);
 
             const Bsa::BSAFile::FileList& filelist = mFile->getList();
             for (Bsa::BSAFile::FileList::const_iterator it = filelist.begin(); it != filelist.end(); ++it)
@@ -0,0 +1,68 @@
+#include "fileindex.hpp"
+
+#include <bit>
+#include <cassert>
+
+#include "pathutil.hpp"
+
+namespace VFS
+{
+    namespace
+    {
+        // Keep load factor at most 0.5 to have short probe sequences for both hits and misses.
+        constexpr std::size_t minSlotsPerEntry = 2;
+
+        std::size_t getHash(std::string_view normalizedPath)
+        {
+            return Path::Hash{}(normalizedPath);
+        }
+    }
+
+    void FileIndex::build(const FileMap& files)
+    {
+        clear();
+
+        if (files.empty())
+            return;
+
+        const std::size_t slotsCount = std::bit_ceil(files.size() * minSlotsPerEntry);
+        mSlots.resize(slotsCount);
+        mMask = slotsCount - 1;
+
+        for (const Entry& entry : files)
+        {
+            const std::size_t hash = getHash(entry.first.view());
+            std::size_t position = hash & mMask;
+            while (mSlots[position].mEntry != nullptr)
+                position = (position + 1) & mMask;
+            mSlots[position] = Slot{ .mHash = hash, .mEntry = &entry };
+        }
+
+        mSize = files.size();
+    }
+
+    void FileIndex::clear()
+    {
+        mSlots.clear();
+        mMask = 0;
+        mSize = 0;
+    }
+
+    const FileIndex::Entry* FileIndex::find(std::string_view normalizedPath) const
+    {
+        assert(Path::isNormalized(normalizedPath));
+
+        if (mSize == 0)
+            return nullptr;
+
+        const std::size_t hash = getHash(normalizedPath);
+        for (std::size_t position = hash & mMask;; position = (position + 1) & mMask)
+        {
+            const Slot& slot = mSlots[position];
+            if (slot.mEntry == nullptr)
+                return nullptr;
+            if (slot.mHash == hash && slot.mEntry->first.view() == normalizedPath)
+                return slot.mEntry;
+        }
+    }
+}
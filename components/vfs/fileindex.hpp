@@ -0,0 +1,45 @@
+#ifndef OPENMW_COMPONENTS_VFS_FILEINDEX_H
+#define OPENMW_COMPONENTS_VFS_FILEINDEX_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "filemap.hpp"
+
+namespace VFS
+{
+    /// @brief Hash index over the entries of a FileMap used for exact lookups.
+    /// @par Open addressing with linear probing. Each slot stores the precomputed hash of the path so probing compares
+    /// strings only when hashes are equal. Entries point into the FileMap the index was built from, so the map must
+    /// not be modified while the index is in use. The map itself remains the sorted view for ordered iteration.
+    class FileIndex
+    {
+    public:
+        using Entry = FileMap::value_type;
+
+        void build(const FileMap& files);
+
+        void clear();
+
+        /// Find an entry by normalized path, returns nullptr if there is no such entry.
+        const Entry* find(std::string_view normalizedPath) const;
+
+        std::size_t size() const { return mSize; }
+
+        std::size_t capacity() const { return mSlots.size(); }
+
+    private:
+        struct Slot
+        {
+            std::size_t mHash = 0;
+            const Entry* mEntry = nullptr;
+        };
+
+        std::vector<Slot> mSlots;
+        std::size_t mMask = 0;
+        std::size_t mSize = 0;
+    };
+}
+
+#endif
@@ -20,6 +20,7 @@ namespace VFS
 
     void Manager::reset()
     {
+        mFileIndex.clear();
         mIndex.clear();
         mArchives.clear();
     }
@@ -31,10 +32,13 @@ namespace VFS
 
     void Manager::buildIndex()
     {
+        mFileIndex.clear();
         mIndex.clear();
 
         for (const auto& archive : mArchives)
             archive->listResources(mIndex);
+
+        mFileIndex.build(mIndex);
     }
 
     Files::IStreamPtr Manager::find(Path::NormalizedView name) const
@@ -63,12 +67,12 @@ namespace VFS
 
     bool Manager::exists(const Path::Normalized& name) const
     {
-        return mIndex.find(name) != mIndex.end();
+        return mFileIndex.find(name.view()) != nullptr;
     }
 
     bool Manager::exists(Path::NormalizedView name) const
     {
-        return mIndex.find(name) != mIndex.end();
+        return mFileIndex.find(name.value()) != nullptr;
     }
 
     std::string Manager::getArchive(const Path::Normalized& name) const
@@ -86,8 +90,8 @@ namespace VFS
         std::string normalized = Files::pathToUnicodeString(name);
         Path::normalizeFilenameInPlace(normalized);
 
-        const auto found = mIndex.find(normalized);
-        if (found == mIndex.end())
+        const FileIndex::Entry* const found = mFileIndex.find(normalized);
+        if (found == nullptr)
             throw std::runtime_error("Resource '" + normalized + "' is not found");
         return found->second->getPath();
     }
@@ -124,9 +128,9 @@ namespace VFS
     Files::IStreamPtr Manager::findNormalized(std::string_view normalizedPath) const
     {
         assert(Path::isNormalized(normalizedPath));
-        const auto it = mIndex.find(normalizedPath);
-        if (it == mIndex.end())
+        const FileIndex::Entry* const found = mFileIndex.find(normalizedPath);
+        if (found == nullptr)
             return nullptr;
-        return it->second->open();
+        return found->second->open();
     }
 }
@@ -9,6 +9,7 @@
 #include <string_view>
 #include <vector>
 
+#include "fileindex.hpp"
 #include "filemap.hpp"
 #include "pathutil.hpp"
 
@@ -80,8 +81,12 @@ namespace VFS
     private:
         std::vector<std::unique_ptr<Archive>> mArchives;
 
+        // Sorted view of all files, used for iteration.
         FileMap mIndex;
 
+        // Hash index over mIndex entries, used for lookups by exact path.
+        FileIndex mFileIndex;
+
         inline Files::IStreamPtr findNormalized(std::string_view normalizedPath) const;
     };
 